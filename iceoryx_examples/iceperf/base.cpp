@@ -16,16 +16,31 @@
 // SPDX-License-Identifier: Apache-2.0
 #include "base.hpp"
 
+void IcePerfBase::waitForFollowers(const uint32_t numberOfFollowers) noexcept
+{
+    for (uint32_t i = 0U; i < numberOfFollowers; ++i)
+    {
+        receivePerfTopic();
+    }
+}
+
+void IcePerfBase::signalReadiness() noexcept
+{
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
+}
 
 void IcePerfBase::preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept
 {
     sendPerfTopic(payloadSizeInBytes, RunFlag::RUN);
 }
 
-void IcePerfBase::postLatencyPerfTestLeader() noexcept
+void IcePerfBase::postLatencyPerfTestLeader(const uint32_t numberOfFollowers) noexcept
 {
-    // Wait for the last response
-    receivePerfTopic();
+    // Wait for the last responses
+    for (uint32_t i = 0U; i < numberOfFollowers; ++i)
+    {
+        receivePerfTopic();
+    }
 }
 
 void IcePerfBase::releaseFollower() noexcept
@@ -33,27 +48,78 @@ void IcePerfBase::releaseFollower() noexcept
     sendPerfTopic(sizeof(PerfTopic), RunFlag::STOP);
 }
 
-iox::units::Duration IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept
+std::vector<iox::units::Duration> IcePerfBase::latencyPerfTestLeader(const uint64_t numRoundTrips,
+                                                                     const uint32_t numberOfFollowers) noexcept
 {
+    std::vector<iox::units::Duration> latencies;
+    latencies.reserve(numRoundTrips);
+
     auto start = std::chrono::steady_clock::now();
 
     // run the performance test
     for (auto i = 0U; i < numRoundTrips; ++i)
     {
-        auto perfTopic = receivePerfTopic();
+        PerfTopic perfTopic;
+        for (uint32_t follower = 0U; follower < numberOfFollowers; ++follower)
+        {
+            perfTopic = receivePerfTopic();
+        }
         sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+
+        auto finish = std::chrono::steady_clock::now();
+
+        constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
+        latencies.push_back(toDuration((finish - start) / TRANSMISSIONS_PER_ROUNDTRIP));
+        start = finish;
+    }
+
+    return latencies;
+}
+
+iox::units::Duration IcePerfBase::throughputPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                           const uint64_t numberOfSamples,
+                                                           const uint32_t numberOfFollowers) noexcept
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        sendPerfTopic(payloadSizeInBytes, RunFlag::BURST);
+    }
+
+    // the answer to the last sample indicates that the follower received the whole burst
+    sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
+    for (uint32_t follower = 0U; follower < numberOfFollowers; ++follower)
+    {
+        receivePerfTopic();
     }
 
     auto finish = std::chrono::steady_clock::now();
+    return toDuration(finish - start);
+}
+
+iox::units::Duration IcePerfBase::multiProducerPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                              const uint32_t numberOfFollowers) noexcept
+{
+    auto start = std::chrono::steady_clock::now();
+
+    sendPerfTopic(payloadSizeInBytes, RunFlag::REQUEST_BURST);
+
+    // each follower terminates its burst with a RUN sample
+    uint32_t numberOfFinishedBursts{0U};
+    while (numberOfFinishedBursts < numberOfFollowers)
+    {
+        if (receivePerfTopic().runFlag == RunFlag::RUN)
+        {
+            ++numberOfFinishedBursts;
+        }
+    }
 
-    constexpr uint64_t TRANSMISSIONS_PER_ROUNDTRIP{2U};
-    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start);
-    auto latencyInNanoSeconds =
-        (static_cast<uint64_t>(duration.count()) / (numRoundTrips * TRANSMISSIONS_PER_ROUNDTRIP));
-    return iox::units::Duration::fromNanoseconds(latencyInNanoSeconds);
+    auto finish = std::chrono::steady_clock::now();
+    return toDuration(finish - start);
 }
 
-void IcePerfBase::latencyPerfTestFollower() noexcept
+void IcePerfBase::perfTestFollower(const uint64_t numberOfSamples) noexcept
 {
     while (true)
     {
@@ -65,6 +131,47 @@ void IcePerfBase::latencyPerfTestFollower() noexcept
             break;
         }
 
-        sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+        if (perfTopic.runFlag == RunFlag::RUN)
+        {
+            sendPerfTopic(perfTopic.payloadSize, RunFlag::RUN);
+        }
+        else if (perfTopic.runFlag == RunFlag::REQUEST_BURST)
+        {
+            for (uint64_t i = 0U; i < numberOfSamples; ++i)
+            {
+                sendPerfTopic(perfTopic.payloadSize, RunFlag::BURST);
+            }
+            sendPerfTopic(sizeof(PerfTopic), RunFlag::RUN);
+        }
     }
 }
+
+void IcePerfBase::recordSplitTimings(const bool enable, const uint64_t expectedNumberOfSamples) noexcept
+{
+    if (enable)
+    {
+        m_splitTimings.loan.reserve(expectedNumberOfSamples);
+        m_splitTimings.publish.reserve(expectedNumberOfSamples);
+        m_splitTimings.take.reserve(expectedNumberOfSamples);
+    }
+    m_recordSplitTimings = enable;
+}
+
+iox::units::Duration IcePerfBase::toDuration(const std::chrono::steady_clock::duration duration) noexcept
+{
+    return iox::units::Duration::fromNanoseconds(
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+}
+
+std::chrono::steady_clock::time_point IcePerfBase::splitTimestamp() const noexcept
+{
+    // the clock is only read when required to not distort the other measurements
+    return m_recordSplitTimings ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+}
+
+IcePerfBase::SplitTimings IcePerfBase::takeSplitTimings() noexcept
+{
+    SplitTimings splitTimings{std::move(m_splitTimings)};
+    m_splitTimings = SplitTimings();
+    return splitTimings;
+}
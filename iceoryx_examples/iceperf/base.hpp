@@ -24,23 +24,67 @@
 
 #include <chrono>
 #include <iostream>
+#include <vector>
 
 class IcePerfBase
 {
   public:
     static constexpr uint32_t ONE_KILOBYTE = 1024U;
 
+    /// @brief The durations of the single steps of a transmission; they are only recorded by the iceoryx technologies
+    struct SplitTimings
+    {
+        std::vector<iox::units::Duration> loan;
+        std::vector<iox::units::Duration> publish;
+        std::vector<iox::units::Duration> take;
+    };
+
     virtual ~IcePerfBase() = default;
 
     virtual void initLeader() noexcept = 0;
     virtual void initFollower() noexcept = 0;
     virtual void shutdown() noexcept = 0;
 
+    /// @brief Waits until every follower has signaled its readiness; only required with more than one follower
+    void waitForFollowers(const uint32_t numberOfFollowers) noexcept;
+    void signalReadiness() noexcept;
+
     void preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept;
-    void postLatencyPerfTestLeader() noexcept;
+    void postLatencyPerfTestLeader(const uint32_t numberOfFollowers) noexcept;
     void releaseFollower() noexcept;
-    iox::units::Duration latencyPerfTestLeader(const uint64_t numRoundTrips) noexcept;
-    void latencyPerfTestFollower() noexcept;
+
+    /// @brief Performs the round trips with all followers
+    /// @return the latency of each round trip, i.e. half of the duration of the round trip
+    std::vector<iox::units::Duration> latencyPerfTestLeader(const uint64_t numRoundTrips,
+                                                            const uint32_t numberOfFollowers) noexcept;
+
+    /// @brief Sends a burst of samples to all followers
+    /// @return the duration until all followers received the whole burst
+    iox::units::Duration throughputPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                  const uint64_t numberOfSamples,
+                                                  const uint32_t numberOfFollowers) noexcept;
+
+    /// @brief Requests a burst of samples from each follower which send them concurrently
+    /// @return the duration until the bursts of all followers were received
+    iox::units::Duration multiProducerPerfTestLeader(const uint32_t payloadSizeInBytes,
+                                                     const uint32_t numberOfFollowers) noexcept;
+
+    /// @brief Reacts on the samples of the leader until the leader releases the follower
+    /// @param[in] numberOfSamples is the number of samples of a requested burst
+    void perfTestFollower(const uint64_t numberOfSamples) noexcept;
+
+    /// @brief Starts or stops the recording of the split timings
+    void recordSplitTimings(const bool enable, const uint64_t expectedNumberOfSamples) noexcept;
+    SplitTimings takeSplitTimings() noexcept;
+
+  protected:
+    static iox::units::Duration toDuration(const std::chrono::steady_clock::duration duration) noexcept;
+
+    /// @brief Returns the current time if the split timings are recorded
+    std::chrono::steady_clock::time_point splitTimestamp() const noexcept;
+
+    bool m_recordSplitTimings{false};
+    SplitTimings m_splitTimings;
 
   private:
     virtual void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept = 0;
@@ -29,6 +29,7 @@ enum class Technology
     ALL,
     ICEORYX_CPP_API,
     ICEORYX_CPP_WAIT_API,
+    ICEORYX_CPP_LISTENER_API,
     ICEORYX_C_API,
     POSIX_MESSAGE_QUEUE,
     UNIX_DOMAIN_SOCKET
@@ -36,8 +37,14 @@ enum class Technology
 
 enum class RunFlag
 {
+    /// @brief stops the follower
     STOP,
-    RUN
+    /// @brief the sample is answered by the follower
+    RUN,
+    /// @brief a sample of a throughput measurement which is not answered
+    BURST,
+    /// @brief the follower answers with 'numberOfSamples' BURST samples of the requested size followed by a RUN sample
+    REQUEST_BURST
 };
 
 #endif
@@ -26,12 +26,31 @@ Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName, const iox::capro::
 }
 Iceoryx::Iceoryx(const iox::capro::IdString_t& publisherName,
                  const iox::capro::IdString_t& subscriberName,
-                 const iox::capro::IdString_t& eventName) noexcept
-    : m_publisher({"IcePerf", publisherName, eventName}, iox::popo::PublisherOptions{1U})
-    , m_subscriber({"IcePerf", subscriberName, eventName}, iox::popo::SubscriberOptions{1U, 1U})
+                 const iox::capro::IdString_t& eventName,
+                 const iox::popo::SubscriberOptions& options) noexcept
+    : m_publisher({"IcePerf", publisherName, eventName}, publisherOptions())
+    , m_subscriber({"IcePerf", subscriberName, eventName}, options)
 {
 }
 
+iox::popo::PublisherOptions Iceoryx::publisherOptions() noexcept
+{
+    // the samples of a throughput measurement must not be discarded
+    iox::popo::PublisherOptions options;
+    options.historyCapacity = 1U;
+    options.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    return options;
+}
+
+iox::popo::SubscriberOptions Iceoryx::subscriberOptions() noexcept
+{
+    iox::popo::SubscriberOptions options;
+    options.queueCapacity = QUEUE_CAPACITY;
+    options.historyRequest = 1U;
+    options.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
+    return options;
+}
+
 void Iceoryx::initLeader() noexcept
 {
     init();
@@ -62,8 +81,10 @@ void Iceoryx::shutdown() noexcept
 {
     m_subscriber.unsubscribe();
 
+    // waiting for the subscribers of the publisher would not terminate with multiple followers since the leader might
+    // already have unsubscribed
     std::cout << "Waiting for: unsubscribe " << std::flush;
-    while (!m_publisher.hasSubscribers())
+    while (m_subscriber.getSubscriptionState() != iox::SubscribeState::NOT_SUBSCRIBED)
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
@@ -75,13 +96,23 @@ void Iceoryx::shutdown() noexcept
 
 void Iceoryx::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
 {
+    auto loanStart = splitTimestamp();
     m_publisher.loan(payloadSizeInBytes).and_then([&](auto& userPayload) {
+        auto loanFinish = splitTimestamp();
         auto sendSample = static_cast<PerfTopic*>(userPayload);
         sendSample->payloadSize = payloadSizeInBytes;
         sendSample->runFlag = runFlag;
         sendSample->subPackets = 1;
 
+        auto publishStart = splitTimestamp();
         m_publisher.publish(userPayload);
+
+        if (m_recordSplitTimings)
+        {
+            auto publishFinish = std::chrono::steady_clock::now();
+            m_splitTimings.loan.push_back(toDuration(loanFinish - loanStart));
+            m_splitTimings.publish.push_back(toDuration(publishFinish - publishStart));
+        }
     });
 }
 
@@ -92,7 +123,12 @@ PerfTopic Iceoryx::receivePerfTopic() noexcept
 
     do
     {
+        auto takeStart = splitTimestamp();
         m_subscriber.take().and_then([&](const void* data) {
+            if (m_recordSplitTimings)
+            {
+                m_splitTimings.take.push_back(toDuration(std::chrono::steady_clock::now() - takeStart));
+            }
             receivedSample = *(static_cast<const PerfTopic*>(data));
             hasReceivedSample = true;
             m_subscriber.release(data);
@@ -31,9 +31,17 @@ class Iceoryx : public IcePerfBase
     void shutdown() noexcept override;
 
   protected:
+    /// @brief the publisher blocks when the queue is full; the capacity is small enough for the chunks of the
+    /// largest mempool of the iceperf RouDi config with several followers
+    static constexpr uint64_t QUEUE_CAPACITY{2U};
+
+    static iox::popo::PublisherOptions publisherOptions() noexcept;
+    static iox::popo::SubscriberOptions subscriberOptions() noexcept;
+
     Iceoryx(const iox::capro::IdString_t& publisherName,
             const iox::capro::IdString_t& subscriberName,
-            const iox::capro::IdString_t& eventName) noexcept;
+            const iox::capro::IdString_t& eventName,
+            const iox::popo::SubscriberOptions& options = subscriberOptions()) noexcept;
     virtual void init() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
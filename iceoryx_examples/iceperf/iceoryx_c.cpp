@@ -24,12 +24,15 @@ IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro
     iox_pub_options_t publisherOptions;
     iox_pub_options_init(&publisherOptions);
     publisherOptions.historyCapacity = 1U;
+    // the samples of a throughput measurement must not be discarded
+    publisherOptions.subscriberTooSlowPolicy = ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER;
     m_publisher = iox_pub_init(&m_publisherStorage, "IcePerf", publisherName.c_str(), "C-API", &publisherOptions);
 
     iox_sub_options_t subscriberOptions;
     iox_sub_options_init(&subscriberOptions);
-    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.queueCapacity = QUEUE_CAPACITY;
     subscriberOptions.historyRequest = 1U;
+    subscriberOptions.queueFullPolicy = QueueFullPolicy_BLOCK_PRODUCER;
     m_subscriber = iox_sub_init(&m_subscriberStorage, "IcePerf", subscriberName.c_str(), "C-API", &subscriberOptions);
 }
 
@@ -72,8 +75,10 @@ void IceoryxC::shutdown() noexcept
 {
     iox_sub_unsubscribe(m_subscriber);
 
+    // waiting for the subscribers of the publisher would not terminate with multiple followers since the leader might
+    // already have unsubscribed
     std::cout << "Waiting for: unsubscribe " << std::flush;
-    while (!iox_pub_has_subscribers(m_publisher))
+    while (iox_sub_get_subscription_state(m_subscriber) != SubscribeState_NOT_SUBSCRIBED)
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
@@ -86,13 +91,24 @@ void IceoryxC::shutdown() noexcept
 void IceoryxC::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
 {
     void* userPayload = nullptr;
+    auto loanStart = splitTimestamp();
     if (iox_pub_loan_chunk(m_publisher, &userPayload, payloadSizeInBytes) == AllocationResult_SUCCESS)
     {
+        auto loanFinish = splitTimestamp();
         auto sendSample = static_cast<PerfTopic*>(userPayload);
         sendSample->payloadSize = payloadSizeInBytes;
         sendSample->runFlag = runFlag;
         sendSample->subPackets = 1;
+
+        auto publishStart = splitTimestamp();
         iox_pub_publish_chunk(m_publisher, userPayload);
+
+        if (m_recordSplitTimings)
+        {
+            auto publishFinish = std::chrono::steady_clock::now();
+            m_splitTimings.loan.push_back(toDuration(loanFinish - loanStart));
+            m_splitTimings.publish.push_back(toDuration(publishFinish - publishStart));
+        }
     }
 }
 
@@ -104,8 +120,13 @@ PerfTopic IceoryxC::receivePerfTopic() noexcept
     do
     {
         const void* userPayload = nullptr;
+        auto takeStart = splitTimestamp();
         if (iox_sub_take_chunk(m_subscriber, &userPayload) == ChunkReceiveResult_SUCCESS)
         {
+            if (m_recordSplitTimings)
+            {
+                m_splitTimings.take.push_back(toDuration(std::chrono::steady_clock::now() - takeStart));
+            }
             receivedSample = *(static_cast<const PerfTopic*>(userPayload));
             hasReceivedSample = true;
             iox_sub_release_chunk(m_subscriber, userPayload);
@@ -34,6 +34,9 @@ class IceoryxC : public IcePerfBase
     void shutdown() noexcept override;
 
   private:
+    /// @brief the publisher blocks when the queue is full, see Iceoryx
+    static constexpr uint64_t QUEUE_CAPACITY{2U};
+
     void init() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
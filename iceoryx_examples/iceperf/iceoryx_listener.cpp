@@ -0,0 +1,82 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_listener.hpp"
+
+IceoryxListener::IceoryxListener(const iox::capro::IdString_t& publisherName,
+                                 const iox::capro::IdString_t& subscriberName) noexcept
+    : Iceoryx(publisherName, subscriberName, "C++-Listener-API", listenerSubscriberOptions())
+{
+}
+
+iox::popo::SubscriberOptions IceoryxListener::listenerSubscriberOptions() noexcept
+{
+    // the subscriber is subscribed after it was attached since the event is only triggered by new samples
+    auto options = subscriberOptions();
+    options.subscribeOnCreate = false;
+    return options;
+}
+
+void IceoryxListener::init() noexcept
+{
+    m_listener
+        .attachEvent(m_subscriber,
+                     iox::popo::SubscriberEvent::DATA_RECEIVED,
+                     iox::popo::createNotificationCallback(onSampleReceived, *this))
+        .or_else([](auto) {
+            std::cerr << "failed to attach subscriber" << std::endl;
+            std::exit(EXIT_FAILURE);
+        });
+    m_subscriber.subscribe();
+
+    Iceoryx::init();
+}
+
+void IceoryxListener::shutdown() noexcept
+{
+    m_listener.detachEvent(m_subscriber, iox::popo::SubscriberEvent::DATA_RECEIVED);
+
+    Iceoryx::shutdown();
+}
+
+void IceoryxListener::onSampleReceived(iox::popo::UntypedSubscriber* subscriber, IceoryxListener* self) noexcept
+{
+    // the notifications are coalesced, therefore all samples have to be taken
+    bool hasReceivedSample{true};
+    while (hasReceivedSample)
+    {
+        hasReceivedSample = false;
+        subscriber->take().and_then([&](const void* data) {
+            {
+                std::lock_guard<std::mutex> lock(self->m_receivedSamplesMutex);
+                self->m_receivedSamples.push_back(*(static_cast<const PerfTopic*>(data)));
+            }
+            self->m_receivedSamplesCondition.notify_one();
+            hasReceivedSample = true;
+            subscriber->release(data);
+        });
+    }
+}
+
+PerfTopic IceoryxListener::receivePerfTopic() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_receivedSamplesMutex);
+    m_receivedSamplesCondition.wait(lock, [this] { return !m_receivedSamples.empty(); });
+
+    auto receivedSample = m_receivedSamples.front();
+    m_receivedSamples.pop_front();
+    return receivedSample;
+}
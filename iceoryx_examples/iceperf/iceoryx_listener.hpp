@@ -0,0 +1,50 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_ICEORYX_LISTENER_HPP
+#define IOX_EXAMPLES_ICEPERF_ICEORYX_LISTENER_HPP
+
+#include "iceoryx.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+/// @brief Receives the samples in the callback of a Listener and hands them over to the measurement; the take is
+/// therefore not part of the split timings
+class IceoryxListener : public Iceoryx
+{
+  public:
+    IceoryxListener(const iox::capro::IdString_t& publisherName,
+                    const iox::capro::IdString_t& subscriberName) noexcept;
+    void shutdown() noexcept override;
+
+  private:
+    void init() noexcept override;
+    PerfTopic receivePerfTopic() noexcept override;
+
+    static iox::popo::SubscriberOptions listenerSubscriberOptions() noexcept;
+    static void onSampleReceived(iox::popo::UntypedSubscriber* subscriber, IceoryxListener* self) noexcept;
+
+    std::mutex m_receivedSamplesMutex;
+    std::condition_variable m_receivedSamplesCondition;
+    std::deque<PerfTopic> m_receivedSamples;
+
+    // the listener must be destroyed first since its thread accesses the other members
+    iox::popo::Listener m_listener;
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_ICEORYX_LISTENER_HPP
@@ -34,19 +34,30 @@ void IceoryxWait::init() noexcept
 
 PerfTopic IceoryxWait::receivePerfTopic() noexcept
 {
+    bool hasReceivedSample{false};
     PerfTopic receivedSample;
 
-    auto notificationVector = waitset.wait();
-    for (auto& notification : notificationVector)
+    // a wake up does not guarantee a sample when several publishers deliver to the subscriber
+    do
     {
-        if (notification->doesOriginateFrom(&m_subscriber))
+        auto notificationVector = waitset.wait();
+        for (auto& notification : notificationVector)
         {
-            m_subscriber.take().and_then([&](const void* data) {
-                receivedSample = *(static_cast<const PerfTopic*>(data));
-                m_subscriber.release(data);
-            });
+            if (notification->doesOriginateFrom(&m_subscriber))
+            {
+                auto takeStart = splitTimestamp();
+                m_subscriber.take().and_then([&](const void* data) {
+                    if (m_recordSplitTimings)
+                    {
+                        m_splitTimings.take.push_back(toDuration(std::chrono::steady_clock::now() - takeStart));
+                    }
+                    receivedSample = *(static_cast<const PerfTopic*>(data));
+                    hasReceivedSample = true;
+                    m_subscriber.release(data);
+                });
+            }
         }
-    }
+    } while (!hasReceivedSample);
 
     return receivedSample;
 }
@@ -18,6 +18,7 @@
 #include "iceperf_follower.hpp"
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
+#include "iceoryx_listener.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_wait.hpp"
 #include "mq.hpp"
@@ -25,6 +26,8 @@
 #include "uds.hpp"
 
 #include <iostream>
+#include <thread>
+#include <vector>
 
 //! [use constants instead of magic values]
 constexpr const char APP_NAME[]{"iceperf-bench-follower"};
@@ -36,13 +39,37 @@ constexpr const char SUBSCRIBER[]{"Leader"};
 void IcePerfFollower::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 {
     ipcTechnology.initFollower();
+    if (m_settings.numberOfFollowers > 1U)
+    {
+        ipcTechnology.signalReadiness();
+    }
 
-    ipcTechnology.latencyPerfTestFollower();
+    ipcTechnology.perfTestFollower(m_settings.numberOfSamples);
 
     ipcTechnology.shutdown();
 }
 //! [do the measurement for a single technology]
 
+//! [do the measurement with all followers]
+template <typename IpcTechnology>
+void IcePerfFollower::doMeasurementWithAllFollowers() noexcept
+{
+    std::vector<std::thread> followers;
+    for (uint32_t i = 0U; i < m_settings.numberOfFollowers; ++i)
+    {
+        followers.emplace_back([this] {
+            IpcTechnology ipcTechnology(PUBLISHER, SUBSCRIBER);
+            doMeasurement(ipcTechnology);
+        });
+    }
+
+    for (auto& follower : followers)
+    {
+        follower.join();
+    }
+}
+//! [do the measurement with all followers]
+
 //! [get the settings for the performance measurement]
 PerfSettings IcePerfFollower::getSettings(iox::popo::Subscriber<PerfSettings>& subscriber) noexcept
 {
@@ -86,12 +113,17 @@ int IcePerfFollower::run() noexcept
     //! [get settings from leader]
 
     //! [create an run technologies]
+    // the message queue and the unix domain socket connect exactly two endpoints
+    const bool hasMultipleFollowers{m_settings.numberOfFollowers > 1U};
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
     {
 #ifndef __APPLE__
-        std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
-        MQ mq(PUBLISHER, SUBSCRIBER);
-        doMeasurement(mq);
+        if (!hasMultipleFollowers)
+        {
+            std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
+            MQ mq(PUBLISHER, SUBSCRIBER);
+            doMeasurement(mq);
+        }
 #else
         if (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
         {
@@ -102,32 +134,37 @@ int IcePerfFollower::run() noexcept
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET)
     {
-        std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
-        UDS uds(PUBLISHER, SUBSCRIBER);
-        doMeasurement(uds);
+        if (!hasMultipleFollowers)
+        {
+            std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
+            UDS uds(PUBLISHER, SUBSCRIBER);
+            doMeasurement(uds);
+        }
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
-        Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryx);
+        doMeasurementWithAllFollowers<Iceoryx>();
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
-        IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxc);
+        doMeasurementWithAllFollowers<IceoryxC>();
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_WAIT_API)
     {
         std::cout << std::endl << "******   ICEORYX WAITSET  ********" << std::endl;
-        IceoryxWait iceoryxwait(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxwait);
+        doMeasurementWithAllFollowers<IceoryxWait>();
     }
 
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_LISTENER_API)
+    {
+        std::cout << std::endl << "******  ICEORYX LISTENER  ********" << std::endl;
+        doMeasurementWithAllFollowers<IceoryxListener>();
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
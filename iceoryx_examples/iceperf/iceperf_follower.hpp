@@ -34,6 +34,10 @@ class IcePerfFollower
     PerfSettings getSettings(iox::popo::Subscriber<PerfSettings>& subscriber) noexcept;
     void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
 
+    /// @brief Runs the measurement with each of the configured number of followers on a dedicated thread
+    template <typename IpcTechnology>
+    void doMeasurementWithAllFollowers() noexcept;
+
   private:
     PerfSettings m_settings;
 };
@@ -19,6 +19,7 @@
 #include "iceperf_leader.hpp"
 #include "iceoryx.hpp"
 #include "iceoryx_c.hpp"
+#include "iceoryx_listener.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
@@ -28,8 +29,11 @@
 #include "topic_data.hpp"
 #include "uds.hpp"
 
+#include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <tuple>
 #include <vector>
 
 //! [use constants instead of magic values]
@@ -38,8 +42,105 @@ constexpr const char PUBLISHER[]{"Leader"};
 constexpr const char SUBSCRIBER[]{"Follower"};
 //! [use constants instead of magic values]
 
-IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
+namespace
+{
+std::tuple<uint64_t, iox::string<2>> humanReadableMemorySize(const uint64_t memorySize) noexcept
+{
+    constexpr const uint64_t UNIT_DIVIDER{1024};
+    auto humanReadalbeMemorySize = memorySize;
+    for (const auto& unit : {iox::string<2>("B"),
+                             iox::string<2>("kB"),
+                             iox::string<2>("MB"),
+                             iox::string<2>("GB"),
+                             iox::string<2>("TB")})
+    {
+        if (humanReadalbeMemorySize >= UNIT_DIVIDER)
+        {
+            humanReadalbeMemorySize /= UNIT_DIVIDER;
+            continue;
+        }
+        return std::make_tuple(humanReadalbeMemorySize, unit);
+    }
+    return (std::make_tuple(memorySize, iox::string<2>("B")));
+}
+
+void printPayloadSize(const uint32_t payloadSize) noexcept
+{
+    uint64_t humanReadablePayloadSize{0};
+    iox::string<2> memorySizeUnit{};
+    std::tie(humanReadablePayloadSize, memorySizeUnit) = humanReadableMemorySize(payloadSize);
+    iox::string<10> unitString{"["};
+    unitString.append(iox::TruncateToCapacity, memorySizeUnit);
+    unitString.append(iox::TruncateToCapacity, "]");
+    std::cout << "| " << std::setw(7) << humanReadablePayloadSize << " " << std::setw(4) << std::left << unitString
+              << std::right << " |";
+}
+
+double toMicroseconds(const iox::units::Duration duration) noexcept
+{
+    return static_cast<double>(duration.toNanoseconds()) / 1000.0;
+}
+
+double messagesPerSecond(const uint64_t numberOfSamples, const iox::units::Duration duration) noexcept
+{
+    const auto durationInNanoseconds = std::max<uint64_t>(duration.toNanoseconds(), 1U);
+    return static_cast<double>(numberOfSamples) * 1.0e9 / static_cast<double>(durationInNanoseconds);
+}
+
+double gigabytesPerSecond(const uint64_t numberOfSamples,
+                          const uint32_t payloadSize,
+                          const iox::units::Duration duration) noexcept
+{
+    return messagesPerSecond(numberOfSamples, duration) * static_cast<double>(payloadSize) / 1.0e9;
+}
+
+struct Percentile
+{
+    const char* name;
+    double percent;
+};
+
+constexpr Percentile PERCENTILES[]{{"min", 0.0}, {"p50", 50.0}, {"p90", 90.0}, {"p99", 99.0}, {"p99.9", 99.9}};
+
+void writeJsonStatistics(std::ostream& stream, const DurationStatistics& statistics) noexcept
+{
+    stream << "{\"samples\": " << statistics.numberOfSamples();
+    for (const auto& percentile : PERCENTILES)
+    {
+        stream << ", \"" << percentile.name << "\": " << statistics.percentile(percentile.percent).toNanoseconds();
+    }
+    stream << ", \"max\": " << statistics.max().toNanoseconds() << ", \"mean\": " << statistics.mean().toNanoseconds()
+           << "}";
+}
+
+void writeJsonThroughput(std::ostream& stream,
+                         const uint32_t payloadSize,
+                         const uint64_t numberOfSamples,
+                         const iox::units::Duration duration) noexcept
+{
+    stream << "{\"samples\": " << numberOfSamples << ", \"durationNs\": " << duration.toNanoseconds()
+           << ", \"messagesPerSecond\": " << messagesPerSecond(numberOfSamples, duration)
+           << ", \"gigabytesPerSecond\": " << gigabytesPerSecond(numberOfSamples, payloadSize, duration) << "}";
+}
+
+const char* toString(const Benchmark benchmark) noexcept
+{
+    switch (benchmark)
+    {
+    case Benchmark::LATENCY:
+        return "latency";
+    case Benchmark::THROUGHPUT:
+        return "throughput";
+    case Benchmark::ALL:
+        break;
+    }
+    return "all";
+}
+} // namespace
+
+IcePerfLeader::IcePerfLeader(const PerfSettings settings, const std::string& jsonResultFile) noexcept
     : m_settings(settings)
+    , m_jsonResultFile(jsonResultFile)
 {
     //! [cleanup outdated resources]
 #ifndef __APPLE__
@@ -49,31 +150,26 @@ IcePerfLeader::IcePerfLeader(const PerfSettings settings) noexcept
     //! [cleanup outdated resources]
 }
 
+bool IcePerfLeader::isLatencyMeasured() const noexcept
+{
+    return m_settings.benchmark == Benchmark::ALL || m_settings.benchmark == Benchmark::LATENCY;
+}
+
+bool IcePerfLeader::isThroughputMeasured() const noexcept
+{
+    return m_settings.benchmark == Benchmark::ALL || m_settings.benchmark == Benchmark::THROUGHPUT;
+}
+
 //! [do the measurement for a single technology]
-void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
+void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology, const char* technologyName) noexcept
 {
     ipcTechnology.initLeader();
+    if (m_settings.numberOfFollowers > 1U)
+    {
+        ipcTechnology.waitForFollowers(m_settings.numberOfFollowers);
+    }
 
-    auto humanReadableMemorySize = [](const uint64_t memorySize) {
-        constexpr const uint64_t UNIT_DIVIDER{1024};
-        auto humanReadalbeMemorySize = memorySize;
-        for (const auto& unit : {iox::string<2>("B"),
-                                 iox::string<2>("kB"),
-                                 iox::string<2>("MB"),
-                                 iox::string<2>("GB"),
-                                 iox::string<2>("TB")})
-        {
-            if (humanReadalbeMemorySize >= UNIT_DIVIDER)
-            {
-                humanReadalbeMemorySize /= UNIT_DIVIDER;
-                continue;
-            }
-            return std::make_tuple(humanReadalbeMemorySize, unit);
-        }
-        return (std::make_tuple(memorySize, iox::string<2>("B")));
-    };
-
-    std::vector<std::tuple<uint32_t, iox::units::Duration>> latencyMeasurements;
+    TechnologyResult result{technologyName, {}};
     const std::vector<uint32_t> payloadSizes{16,
                                              32,
                                              64,
@@ -103,13 +199,40 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
         std::cout << separator << humanReadablePayloadSize << " [" << memorySizeUnit << "]" << std::flush;
         separator = ", ";
 
-        ipcTechnology.preLatencyPerfTestLeader(payloadSize);
+        PayloadResult payloadResult;
+        payloadResult.payloadSize = payloadSize;
+
+        if (isLatencyMeasured())
+        {
+            ipcTechnology.preLatencyPerfTestLeader(payloadSize);
+
+            ipcTechnology.recordSplitTimings(m_settings.splitTiming, m_settings.numberOfSamples);
+            auto latencies = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples,
+                                                                 m_settings.numberOfFollowers);
+            ipcTechnology.recordSplitTimings(false, 0U);
 
-        auto latency = ipcTechnology.latencyPerfTestLeader(m_settings.numberOfSamples);
+            ipcTechnology.postLatencyPerfTestLeader(m_settings.numberOfFollowers);
 
-        latencyMeasurements.push_back(std::make_tuple(payloadSize, latency));
+            auto splitTimings = ipcTechnology.takeSplitTimings();
+            payloadResult.latency = DurationStatistics(std::move(latencies));
+            payloadResult.loan = DurationStatistics(std::move(splitTimings.loan));
+            payloadResult.publish = DurationStatistics(std::move(splitTimings.publish));
+            payloadResult.take = DurationStatistics(std::move(splitTimings.take));
+        }
+
+        if (isThroughputMeasured())
+        {
+            payloadResult.leaderToFollowers.numberOfSamples = m_settings.numberOfSamples;
+            payloadResult.leaderToFollowers.duration = ipcTechnology.throughputPerfTestLeader(
+                payloadSize, m_settings.numberOfSamples, m_settings.numberOfFollowers);
 
-        ipcTechnology.postLatencyPerfTestLeader();
+            payloadResult.followersToLeader.numberOfSamples =
+                m_settings.numberOfSamples * m_settings.numberOfFollowers;
+            payloadResult.followersToLeader.duration =
+                ipcTechnology.multiProducerPerfTestLeader(payloadSize, m_settings.numberOfFollowers);
+        }
+
+        result.payloads.push_back(std::move(payloadResult));
     }
     std::cout << std::endl;
 
@@ -119,28 +242,169 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
 
     std::cout << std::endl;
     std::cout << "#### Measurement Result ####" << std::endl;
-    std::cout << m_settings.numberOfSamples << " round trips for each payload." << std::endl;
+    std::cout << m_settings.numberOfSamples << " samples for each payload and " << m_settings.numberOfFollowers
+              << " follower(s)." << std::endl;
+    printLatencyResults(result);
+    printSplitTimingResults(result);
+    printThroughputResults(result);
+
+    std::cout << std::endl;
+    std::cout << "Finished!" << std::endl;
+
+    m_results.push_back(std::move(result));
+}
+//! [do the measurement for a single technology]
+
+void IcePerfLeader::printLatencyResults(const TechnologyResult& result) const noexcept
+{
+    if (!isLatencyMeasured())
+    {
+        return;
+    }
+
     std::cout << std::endl;
-    std::cout << "| Payload Size | Average Latency [µs] |" << std::endl;
-    std::cout << "|-------------:|---------------------:|" << std::endl;
-    for (const auto& latencyMeasuement : latencyMeasurements)
+    std::cout << "Latency of a round trip divided by two [µs]" << std::endl;
+    std::cout << "| Payload Size |";
+    for (const auto& percentile : PERCENTILES)
     {
-        uint64_t humanReadablePayloadSize{0};
-        iox::string<2> memorySizeUnit{};
-        std::tie(humanReadablePayloadSize, memorySizeUnit) = humanReadableMemorySize(std::get<0>(latencyMeasuement));
-        auto latencyInMicroseconds = static_cast<double>(std::get<1>(latencyMeasuement).toNanoseconds()) / 1000.0;
-        iox::string<10> unitString{"["};
-        unitString.append(iox::TruncateToCapacity, memorySizeUnit);
-        unitString.append(iox::TruncateToCapacity, "]");
-        std::cout << "| " << std::setw(7) << humanReadablePayloadSize << " " << std::setw(4) << std::left << unitString
-                  << std::right << " | " << std::setw(20) << std::setprecision(2) << latencyInMicroseconds << " |"
+        std::cout << std::setw(9) << percentile.name << " |";
+    }
+    std::cout << "      max |     mean |" << std::endl;
+    std::cout << "|-------------:|---------:|---------:|---------:|---------:|---------:|---------:|---------:|"
+              << std::endl;
+    for (const auto& payloadResult : result.payloads)
+    {
+        printPayloadSize(payloadResult.payloadSize);
+        for (const auto& percentile : PERCENTILES)
+        {
+            std::cout << std::setw(9) << std::fixed << std::setprecision(2)
+                      << toMicroseconds(payloadResult.latency.percentile(percentile.percent)) << " |";
+        }
+        std::cout << std::setw(9) << toMicroseconds(payloadResult.latency.max()) << " |" << std::setw(9)
+                  << toMicroseconds(payloadResult.latency.mean()) << " |"
                   << std::endl;
     }
+}
+
+void IcePerfLeader::printSplitTimingResults(const TechnologyResult& result) const noexcept
+{
+    if (!isLatencyMeasured() || !m_settings.splitTiming || result.payloads.empty()
+        || result.payloads.front().loan.numberOfSamples() == 0U)
+    {
+        return;
+    }
 
     std::cout << std::endl;
-    std::cout << "Finished!" << std::endl;
+    std::cout << "Duration of the single steps of the leader [µs]" << std::endl;
+    std::cout << "| Payload Size | loan p50 | loan p99 | publish p50 | publish p99 | take p50 | take p99 |"
+              << std::endl;
+    std::cout << "|-------------:|---------:|---------:|------------:|------------:|---------:|---------:|"
+              << std::endl;
+    for (const auto& payloadResult : result.payloads)
+    {
+        printPayloadSize(payloadResult.payloadSize);
+        std::cout << std::fixed << std::setprecision(2) << std::setw(9)
+                  << toMicroseconds(payloadResult.loan.percentile(50.0)) << " |" << std::setw(9)
+                  << toMicroseconds(payloadResult.loan.percentile(99.0)) << " |" << std::setw(12)
+                  << toMicroseconds(payloadResult.publish.percentile(50.0)) << " |" << std::setw(12)
+                  << toMicroseconds(payloadResult.publish.percentile(99.0)) << " |" << std::setw(9)
+                  << toMicroseconds(payloadResult.take.percentile(50.0)) << " |" << std::setw(9)
+                  << toMicroseconds(payloadResult.take.percentile(99.0)) << " |" << std::endl;
+    }
+}
+
+void IcePerfLeader::printThroughputResults(const TechnologyResult& result) const noexcept
+{
+    if (!isThroughputMeasured())
+    {
+        return;
+    }
+
+    std::cout << std::endl;
+    std::cout << "Throughput from the leader to each follower (1:" << m_settings.numberOfFollowers
+              << ") and from all followers to the leader (" << m_settings.numberOfFollowers << ":1)" << std::endl;
+    std::cout << "| Payload Size | 1:N [msg/s] | 1:N [GB/s] | N:1 [msg/s] | N:1 [GB/s] |" << std::endl;
+    std::cout << "|-------------:|------------:|-----------:|------------:|-----------:|" << std::endl;
+    for (const auto& payloadResult : result.payloads)
+    {
+        const auto& leaderToFollowers = payloadResult.leaderToFollowers;
+        const auto& followersToLeader = payloadResult.followersToLeader;
+        printPayloadSize(payloadResult.payloadSize);
+        std::cout << std::fixed << std::setprecision(0) << std::setw(12)
+                  << messagesPerSecond(leaderToFollowers.numberOfSamples, leaderToFollowers.duration) << " |"
+                  << std::setprecision(3) << std::setw(11)
+                  << gigabytesPerSecond(
+                         leaderToFollowers.numberOfSamples, payloadResult.payloadSize, leaderToFollowers.duration)
+                  << " |" << std::setprecision(0) << std::setw(12)
+                  << messagesPerSecond(followersToLeader.numberOfSamples, followersToLeader.duration) << " |"
+                  << std::setprecision(3) << std::setw(11)
+                  << gigabytesPerSecond(
+                         followersToLeader.numberOfSamples, payloadResult.payloadSize, followersToLeader.duration)
+                  << " |" << std::endl;
+    }
+}
+
+bool IcePerfLeader::writeJsonResults() const noexcept
+{
+    std::ofstream stream(m_jsonResultFile);
+    if (!stream)
+    {
+        return false;
+    }
+
+    stream << "{\n";
+    stream << "  \"settings\": {\"benchmark\": \"" << toString(m_settings.benchmark)
+           << "\", \"numberOfSamples\": " << m_settings.numberOfSamples
+           << ", \"numberOfFollowers\": " << m_settings.numberOfFollowers
+           << ", \"splitTiming\": " << (m_settings.splitTiming ? "true" : "false") << "},\n";
+    stream << "  \"results\": [";
+    const char* technologySeparator = "\n";
+    for (const auto& result : m_results)
+    {
+        stream << technologySeparator << "    {\"technology\": \"" << result.technology << "\", \"payloads\": [";
+        const char* payloadSeparator = "\n";
+        for (const auto& payloadResult : result.payloads)
+        {
+            stream << payloadSeparator << "      {\"payloadSize\": " << payloadResult.payloadSize;
+            if (isLatencyMeasured())
+            {
+                stream << ", \"latencyNs\": ";
+                writeJsonStatistics(stream, payloadResult.latency);
+                if (payloadResult.loan.numberOfSamples() > 0U)
+                {
+                    stream << ", \"splitTimingNs\": {\"loan\": ";
+                    writeJsonStatistics(stream, payloadResult.loan);
+                    stream << ", \"publish\": ";
+                    writeJsonStatistics(stream, payloadResult.publish);
+                    stream << ", \"take\": ";
+                    writeJsonStatistics(stream, payloadResult.take);
+                    stream << "}";
+                }
+            }
+            if (isThroughputMeasured())
+            {
+                stream << ", \"throughput\": {\"leaderToFollowers\": ";
+                writeJsonThroughput(stream,
+                                    payloadResult.payloadSize,
+                                    payloadResult.leaderToFollowers.numberOfSamples,
+                                    payloadResult.leaderToFollowers.duration);
+                stream << ", \"followersToLeader\": ";
+                writeJsonThroughput(stream,
+                                    payloadResult.payloadSize,
+                                    payloadResult.followersToLeader.numberOfSamples,
+                                    payloadResult.followersToLeader.duration);
+                stream << "}";
+            }
+            stream << "}";
+            payloadSeparator = ",\n";
+        }
+        stream << "\n    ]}";
+        technologySeparator = ",\n";
+    }
+    stream << "\n  ]\n}\n";
+
+    return static_cast<bool>(stream);
 }
-//! [do the measurement for a single technology]
 
 //! [run all technologies]
 int IcePerfLeader::run() noexcept
@@ -160,12 +424,17 @@ int IcePerfLeader::run() noexcept
     //! [send setting to follower application]
 
     //! [create an run technologies]
+    // the message queue and the unix domain socket connect exactly two endpoints
+    const bool hasMultipleFollowers{m_settings.numberOfFollowers > 1U};
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
     {
 #ifndef __APPLE__
-        std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
-        MQ mq(PUBLISHER, SUBSCRIBER);
-        doMeasurement(mq);
+        if (!hasMultipleFollowers)
+        {
+            std::cout << std::endl << "******   MESSAGE QUEUE    ********" << std::endl;
+            MQ mq(PUBLISHER, SUBSCRIBER);
+            doMeasurement(mq, "posix-message-queue");
+        }
 #else
         if (m_settings.technology == Technology::POSIX_MESSAGE_QUEUE)
         {
@@ -176,33 +445,49 @@ int IcePerfLeader::run() noexcept
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::UNIX_DOMAIN_SOCKET)
     {
-        std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
-        UDS uds(PUBLISHER, SUBSCRIBER);
-        doMeasurement(uds);
+        if (!hasMultipleFollowers)
+        {
+            std::cout << std::endl << "****** UNIX DOMAIN SOCKET ********" << std::endl;
+            UDS uds(PUBLISHER, SUBSCRIBER);
+            doMeasurement(uds, "unix-domain-sockets");
+        }
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_API)
     {
         std::cout << std::endl << "******      ICEORYX       ********" << std::endl;
         Iceoryx iceoryx(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryx);
+        doMeasurement(iceoryx, "iceoryx-cpp-api");
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_API)
     {
         std::cout << std::endl << "******   ICEORYX C API    ********" << std::endl;
         IceoryxC iceoryxc(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxc);
+        doMeasurement(iceoryxc, "iceoryx-c-api");
     }
 
     if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_WAIT_API)
     {
         std::cout << std::endl << "******   ICEORYX WAITSET  ********" << std::endl;
         IceoryxWait iceoryxwait(PUBLISHER, SUBSCRIBER);
-        doMeasurement(iceoryxwait);
+        doMeasurement(iceoryxwait, "iceoryx-cpp-waitset-api");
+    }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_CPP_LISTENER_API)
+    {
+        std::cout << std::endl << "******  ICEORYX LISTENER  ********" << std::endl;
+        IceoryxListener iceoryxlistener(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxlistener, "iceoryx-cpp-listener-api");
     }
     //! [create an run technologies]
 
+    if (!m_jsonResultFile.empty() && !writeJsonResults())
+    {
+        std::cerr << "Could not write the results to '" << m_jsonResultFile << "'!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
     return EXIT_SUCCESS;
 }
 //! [run all technologies]
@@ -19,21 +19,59 @@
 
 #include "base.hpp"
 #include "example_common.hpp"
+#include "statistics.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 
+#include <string>
+#include <vector>
+
 class IcePerfLeader
 {
   public:
-    IcePerfLeader(const PerfSettings settings) noexcept;
+    /// @param[in] settings of the benchmark
+    /// @param[in] jsonResultFile is the file to which the results are written in JSON format; no file is written if
+    /// the path is empty
+    IcePerfLeader(const PerfSettings settings, const std::string& jsonResultFile) noexcept;
 
     int run() noexcept;
 
   private:
-    void doMeasurement(IcePerfBase& ipcTechnology) noexcept;
+    struct ThroughputResult
+    {
+        uint64_t numberOfSamples{0U};
+        iox::units::Duration duration{iox::units::Duration::fromNanoseconds(0U)};
+    };
+
+    struct PayloadResult
+    {
+        uint32_t payloadSize{0U};
+        DurationStatistics latency;
+        DurationStatistics loan;
+        DurationStatistics publish;
+        DurationStatistics take;
+        ThroughputResult leaderToFollowers;
+        ThroughputResult followersToLeader;
+    };
+
+    struct TechnologyResult
+    {
+        std::string technology;
+        std::vector<PayloadResult> payloads;
+    };
+
+    void doMeasurement(IcePerfBase& ipcTechnology, const char* technologyName) noexcept;
+    bool isLatencyMeasured() const noexcept;
+    bool isThroughputMeasured() const noexcept;
+    void printLatencyResults(const TechnologyResult& result) const noexcept;
+    void printSplitTimingResults(const TechnologyResult& result) const noexcept;
+    void printThroughputResults(const TechnologyResult& result) const noexcept;
+    bool writeJsonResults() const noexcept;
 
   private:
     const PerfSettings m_settings;
+    const std::string m_jsonResultFile;
+    std::vector<TechnologyResult> m_results;
 };
 
 #endif // IOX_EXAMPLES_ICEPERF_LEADER_HPP
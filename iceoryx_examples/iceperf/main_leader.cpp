@@ -24,19 +24,24 @@
 
 #include <cstring>
 #include <iostream>
+#include <string>
 
 int main(int argc, char* argv[])
 {
     PerfSettings settings;
+    std::string jsonResultFile;
 
     constexpr option longOptions[] = {{"help", no_argument, nullptr, 'h'},
                                       {"benchmark", required_argument, nullptr, 'b'},
                                       {"technology", required_argument, nullptr, 't'},
-                                      {"number-of-samples", required_argument, nullptr, 't'},
+                                      {"number-of-samples", required_argument, nullptr, 'n'},
+                                      {"number-of-followers", required_argument, nullptr, 'f'},
+                                      {"split-timing", no_argument, nullptr, 's'},
+                                      {"json", required_argument, nullptr, 'j'},
                                       {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* shortOptions = "hb:t:n:";
+    constexpr const char* shortOptions = "hb:t:n:f:sj:";
     int32_t index{0};
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, shortOptions, longOptions, &index), opt != -1))
@@ -54,6 +59,7 @@ int main(int argc, char* argv[])
             std::cout << "                                  <TYPE> {all," << std::endl;
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
             std::cout << "                                          iceoryx-cpp-waitset-api," << std::endl;
+            std::cout << "                                          iceoryx-cpp-listener-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
@@ -61,6 +67,16 @@ int main(int argc, char* argv[])
             std::cout << "-n, --number-of-samples <N>       Set the number of samples sent in a benchmark round"
                       << std::endl;
             std::cout << "                                  default = '10000'" << std::endl;
+            std::cout << "-f, --number-of-followers <N>     Set the number of followers which receive the samples of"
+                      << std::endl;
+            std::cout << "                                  the leader and send samples to the leader concurrently;"
+                      << std::endl;
+            std::cout << "                                  only supported by the iceoryx technologies" << std::endl;
+            std::cout << "                                  default = '1'" << std::endl;
+            std::cout << "-s, --split-timing                Measure the duration of loan, publish and take of the"
+                      << std::endl;
+            std::cout << "                                  leader in the latency benchmark" << std::endl;
+            std::cout << "-j, --json <FILE>                 Write the results in JSON format to <FILE>" << std::endl;
 
             return EXIT_SUCCESS;
         case 'b':
@@ -95,6 +111,10 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_CPP_WAIT_API;
             }
+            else if (strcmp(optarg, "iceoryx-cpp-listener-api") == 0)
+            {
+                settings.technology = Technology::ICEORYX_CPP_LISTENER_API;
+            }
             else if (strcmp(optarg, "iceoryx-c-api") == 0)
             {
                 settings.technology = Technology::ICEORYX_C_API;
@@ -109,8 +129,9 @@ int main(int argc, char* argv[])
             }
             else
             {
-                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-cpp-waitset-api', "
+                             "'iceoryx-cpp-listener-api', 'iceoryx-c-api', 'posix-message-queue' and "
+                             "'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -122,11 +143,32 @@ int main(int argc, char* argv[])
                 return EXIT_FAILURE;
             }
             break;
+        case 'f':
+            if (!iox::convert::fromString(optarg, settings.numberOfFollowers) || settings.numberOfFollowers == 0U)
+            {
+                std::cerr << "Could not parse 'number-of-followers' paramater!" << std::endl;
+                return EXIT_FAILURE;
+            }
+            break;
+        case 's':
+            settings.splitTiming = true;
+            break;
+        case 'j':
+            jsonResultFile = optarg;
+            break;
         default:
             return EXIT_FAILURE;
         };
     }
 
-    IcePerfLeader app(settings);
+    if (settings.numberOfFollowers > 1U
+        && (settings.technology == Technology::POSIX_MESSAGE_QUEUE
+            || settings.technology == Technology::UNIX_DOMAIN_SOCKET))
+    {
+        std::cerr << "The message queue and the unix domain socket support only one follower!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    IcePerfLeader app(settings, jsonResultFile);
     return app.run();
 }
@@ -0,0 +1,71 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+DurationStatistics::DurationStatistics(std::vector<iox::units::Duration>&& durations) noexcept
+    : m_sortedDurations(std::move(durations))
+{
+    std::sort(m_sortedDurations.begin(), m_sortedDurations.end());
+
+    if (!m_sortedDurations.empty())
+    {
+        uint64_t sumInNanoseconds{0U};
+        for (const auto& duration : m_sortedDurations)
+        {
+            sumInNanoseconds += duration.toNanoseconds();
+        }
+        m_mean = iox::units::Duration::fromNanoseconds(sumInNanoseconds / m_sortedDurations.size());
+    }
+}
+
+uint64_t DurationStatistics::numberOfSamples() const noexcept
+{
+    return m_sortedDurations.size();
+}
+
+iox::units::Duration DurationStatistics::min() const noexcept
+{
+    return percentile(0.0);
+}
+
+iox::units::Duration DurationStatistics::max() const noexcept
+{
+    return percentile(100.0);
+}
+
+iox::units::Duration DurationStatistics::mean() const noexcept
+{
+    return m_mean;
+}
+
+iox::units::Duration DurationStatistics::percentile(const double percent) const noexcept
+{
+    if (m_sortedDurations.empty())
+    {
+        return iox::units::Duration::fromNanoseconds(0U);
+    }
+
+    // nearest-rank method
+    const auto numberOfSamples = static_cast<double>(m_sortedDurations.size());
+    auto rank = static_cast<uint64_t>(std::ceil(percent / 100.0 * numberOfSamples));
+    rank = std::max<uint64_t>(rank, 1U);
+    rank = std::min<uint64_t>(rank, m_sortedDurations.size());
+    return m_sortedDurations[rank - 1U];
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_STATISTICS_HPP
+#define IOX_EXAMPLES_ICEPERF_STATISTICS_HPP
+
+#include "iox/duration.hpp"
+
+#include <cstdint>
+#include <vector>
+
+/// @brief Summarizes measured durations by their percentiles instead of the mean only, since the tail of the
+/// distribution is relevant for real-time systems
+class DurationStatistics
+{
+  public:
+    DurationStatistics() noexcept = default;
+
+    /// @brief Creates the statistics of the measured durations
+    /// @param[in] durations which are summarized
+    explicit DurationStatistics(std::vector<iox::units::Duration>&& durations) noexcept;
+
+    uint64_t numberOfSamples() const noexcept;
+
+    iox::units::Duration min() const noexcept;
+    iox::units::Duration max() const noexcept;
+    iox::units::Duration mean() const noexcept;
+
+    /// @brief Returns the duration below or equal to which the given percentage of the measured durations lies
+    /// @param[in] percent in the range of [0, 100]
+    /// @return the percentile or zero if there are no samples
+    iox::units::Duration percentile(const double percent) const noexcept;
+
+  private:
+    std::vector<iox::units::Duration> m_sortedDurations;
+    iox::units::Duration m_mean{iox::units::Duration::fromNanoseconds(0U)};
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_STATISTICS_HPP
@@ -27,6 +27,8 @@ struct PerfSettings
     Benchmark benchmark{Benchmark::ALL};
     Technology technology{Technology::ALL};
     uint64_t numberOfSamples{10000U};
+    uint32_t numberOfFollowers{1U};
+    bool splitTiming{false};
 };
 
 struct PerfTopic
@@ -92,6 +92,19 @@ class LoFFLi
     /// @return true if index is valid or not yet pushed, false otherwise
     bool push(const Index_t index) noexcept;
 
+    /// Pop multiple values from the free-list with a single compare-and-swap on the head
+    /// @param [out] indices pointer to a memory with the capacity for at least maxNumberOfIndices elements
+    /// @param [in] maxNumberOfIndices is the maximum number of elements to pop
+    /// @return the number of popped elements which are stored at the beginning of indices
+    uint32_t popBatch(not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept;
+
+    /// Push multiple previously poped elements with a single compare-and-swap on the head
+    /// @param [in] indices pointer to the previously poped elements
+    /// @param [in] numberOfIndices is the number of elements to push
+    /// @return true if all indices are valid and not yet pushed, false otherwise; in this case none of the indices is
+    /// pushed
+    bool pushBatch(not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept;
+
     /// Calculates the required memory size for a free-list
     /// @param [in] capacity is the number of elements of the free-list
     /// @return the required memory size for a free-list with the requested capacity
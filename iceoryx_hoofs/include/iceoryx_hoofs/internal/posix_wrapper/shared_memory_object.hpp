@@ -50,6 +50,20 @@ enum class SharedMemoryAllocationError
 
 };
 
+/// @brief Defines how the memory of a newly created shared memory is zeroed
+struct SharedMemoryZeroingOptions
+{
+    /// @brief zeroes the memory with memset which also reserves it, i.e. a lack of memory is detected on creation;
+    ///        when disabled the zeroed pages of the kernel are used and the memory is reserved on the first access,
+    ///        a lack of memory results then in a SIGBUS at runtime
+    bool zeroOnCreation{true};
+
+    /// @brief the number of threads which zero the memory in parallel, limited to MAX_NUMBER_OF_THREADS
+    uint32_t numberOfThreads{1U};
+
+    static constexpr uint32_t MAX_NUMBER_OF_THREADS{64U};
+};
+
 class SharedMemoryObjectBuilder;
 
 /// @brief Creates a shared memory segment and maps it into the process space.
@@ -118,6 +132,13 @@ class SharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief Defines if the shared memory is backed by transparent huge pages, prefaulted and locked in RAM when
+    ///        it is mapped into the process; the NUMA node is only applied when the shared memory is created
+    IOX_BUILDER_PARAMETER(MemoryMapPageOptions, pageOptions, MemoryMapPageOptions())
+
+    /// @brief Defines if and how the shared memory is zeroed when it is created
+    IOX_BUILDER_PARAMETER(SharedMemoryZeroingOptions, zeroingOptions, SharedMemoryZeroingOptions())
+
   public:
     expected<SharedMemoryObject, SharedMemoryObjectError> create() noexcept;
 };
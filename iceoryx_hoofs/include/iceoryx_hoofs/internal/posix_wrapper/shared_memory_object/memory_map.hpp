@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/shared_memory.hpp"
 #include "iceoryx_platform/mman.hpp"
 #include "iox/builder.hpp"
+#include "iox/optional.hpp"
 
 #include <cstdint>
 
@@ -42,6 +43,7 @@ enum class MemoryMapError
     OVERFLOWING_PARAMETERS,
     PERMISSION_FAILURE,
     NO_WRITE_PERMISSION,
+    UNABLE_TO_BIND_TO_NUMA_NODE,
     UNKNOWN_ERROR
 };
 
@@ -63,6 +65,27 @@ enum class MemoryMapFlags : int32_t
     PRIVATE_CHANGES_AND_FORCE_BASE_ADDRESS_HINT = MAP_PRIVATE | MAP_FIXED,
 };
 
+/// @brief Options which reduce the TLB misses and the page faults when the mapped memory is accessed
+struct MemoryMapPageOptions
+{
+    /// @brief advises the kernel to back the mapping with transparent huge pages; this is only a hint and it is
+    ///        ignored with a warning when the platform does not support it
+    bool transparentHugePages{false};
+
+    /// @brief populates the page tables of the mapping when it is created to avoid the page faults on the first
+    ///        access of the memory
+    bool prefault{false};
+
+    /// @brief locks the mapping in RAM so that it is never paged out; fails when the memory lock limit of the
+    ///        process is exceeded
+    bool lockInMemory{false};
+
+    /// @brief binds the pages of the mapping to the memory of the given NUMA node before they are populated; for a
+    ///        shared memory the binding is shared by all processes which map it, therefore it is sufficient when
+    ///        the creator of the shared memory requests it
+    optional<uint32_t> numaNode;
+};
+
 class MemoryMap;
 /// @brief The builder of a MemoryMap object
 class MemoryMapBuilder
@@ -89,6 +112,9 @@ class MemoryMapBuilder
     /// @brief Offset of the memory location
     IOX_BUILDER_PARAMETER(off_t, offset, 0)
 
+    /// @brief Defines how the pages of the mapping are backed, populated and locked
+    IOX_BUILDER_PARAMETER(MemoryMapPageOptions, pageOptions, MemoryMapPageOptions())
+
   public:
     /// @brief creates a valid MemoryMap object. If the construction failed the expected
     ///        contains an enum value describing the error.
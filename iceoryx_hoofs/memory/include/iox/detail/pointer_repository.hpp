@@ -40,6 +40,17 @@ class PointerRepository final
         ptr_t endPtr{nullptr};
     };
 
+    /// @brief entry of the index of the registered segments which is sorted by the base pointers
+    struct IndexEntry
+    {
+        ptr_t basePtr{nullptr};
+        ptr_t endPtr{nullptr};
+        /// @brief the largest end pointer of this and all preceding entries of the index; this allows to stop the
+        /// search as soon as no preceding segment can contain the pointer, even with overlapping segments
+        ptr_t maxEndPtr{nullptr};
+        id_t id{0U};
+    };
+
     static constexpr id_t MIN_ID{1U};
     static constexpr id_t MAX_ID{CAPACITY - 1U};
 
@@ -92,7 +103,9 @@ class PointerRepository final
 
     /// @brief returns the id for a given pointer ptr
     /// @param[in] ptr is the pointer whose corresponding id is searched for
-    /// @return the id the pointer was registered to
+    /// @return the id the pointer was registered to; if multiple segments contain the pointer, the smallest id
+    /// @note the lookup is a binary search in the index of the segments and therefore logarithmic in the number of
+    /// registered segments as long as the segments do not overlap
     id_t searchId(const ptr_t ptr) const noexcept;
 
   private:
@@ -103,9 +116,15 @@ class PointerRepository final
     /// and each needs to initialize it via register calls above
 
     iox::vector<Info, CAPACITY> m_info;
-    uint64_t m_maxRegistered{0U};
+    /// @brief the non-empty registered segments sorted by their base pointers, updated on registration and
+    /// unregistration to keep searchId sub-linear
+    iox::vector<IndexEntry, CAPACITY> m_index;
 
     bool addPointerIfIdIsFree(const id_t id, const ptr_t ptr, const uint64_t size) noexcept;
+    uint64_t firstIndexPositionAfter(const ptr_t ptr) const noexcept;
+    void addToIndex(const id_t id) noexcept;
+    void removeFromIndex(const id_t id) noexcept;
+    void updateMaxEndPtrStartingAt(const uint64_t position) noexcept;
 };
 } // namespace iox
 
@@ -20,6 +20,9 @@
 
 #include "iox/detail/pointer_repository.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 namespace iox
 {
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -62,9 +65,8 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::unregisterPtr(const id_t i
     {
         if (m_info[id].basePtr != nullptr)
         {
+            removeFromIndex(id);
             m_info[id].basePtr = nullptr;
-
-            /// @note do not search for next lower registered index but we could do it here
             return true;
         }
     }
@@ -79,7 +81,7 @@ inline void PointerRepository<id_t, ptr_t, CAPACITY>::unregisterAll() noexcept
     {
         info.basePtr = nullptr;
     }
-    m_maxRegistered = 0U;
+    m_index.clear();
 }
 
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
@@ -100,19 +102,26 @@ inline ptr_t PointerRepository<id_t, ptr_t, CAPACITY>::getBasePtr(const id_t id)
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline id_t PointerRepository<id_t, ptr_t, CAPACITY>::searchId(const ptr_t ptr) const noexcept
 {
-    for (id_t id{1U}; id <= m_maxRegistered; ++id)
+    // all segments before this position start at or before ptr; walk backwards as long as one of them can still
+    // contain ptr, which is only the directly preceding segment when the segments do not overlap
+    // the iterators are used instead of the index operator to avoid the bounds checks on this hot path
+    id_t foundId{RAW_POINTER_BEHAVIOUR_ID};
+    for (auto entry = m_index.begin() + firstIndexPositionAfter(ptr);
+         (entry != m_index.begin()) && (std::prev(entry)->maxEndPtr >= ptr);
+         --entry)
     {
-        // return first id where the ptr is in the corresponding interval
-        // AXIVION Next Construct AutosarC++19_03-M5.14.1 : False positive. vector::operator[](index) has no side-effect when index is less than vector size which is guaranteed by PointerRepository design
-        if ((ptr >= m_info[id].basePtr) && (ptr <= m_info[id].endPtr))
+        const auto& candidate = *std::prev(entry);
+        // return the smallest id where the ptr is in the corresponding interval
+        if ((ptr <= candidate.endPtr) && ((foundId == RAW_POINTER_BEHAVIOUR_ID) || (candidate.id < foundId)))
         {
-            return id;
+            foundId = candidate.id;
         }
     }
     /// @note treat the pointer as a regular pointer if not found
     /// by setting id to RAW_POINTER_BEHAVIOUR_ID
-    return RAW_POINTER_BEHAVIOUR_ID;
+    return foundId;
 }
+
 template <typename id_t, typename ptr_t, uint64_t CAPACITY>
 inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const id_t id,
                                                                            const ptr_t ptr,
@@ -127,15 +136,64 @@ inline bool PointerRepository<id_t, ptr_t, CAPACITY>::addPointerIfIdIsFree(const
         // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
         m_info[id].endPtr = reinterpret_cast<ptr_t>(reinterpret_cast<uintptr_t>(ptr) + (size - 1U));
 
-        if (id > m_maxRegistered)
+        /// @note an empty segment cannot contain any pointer and is therefore not indexed; the same applies to a
+        /// nullptr since its id is still considered to be free
+        if ((ptr != nullptr) && (size > 0U))
         {
-            m_maxRegistered = id;
+            addToIndex(id);
         }
         return true;
     }
     return false;
 }
 
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline uint64_t PointerRepository<id_t, ptr_t, CAPACITY>::firstIndexPositionAfter(const ptr_t ptr) const noexcept
+{
+    const auto entry = std::upper_bound(
+        m_index.begin(), m_index.end(), ptr, [](const ptr_t value, const IndexEntry& element) noexcept {
+            return value < element.basePtr;
+        });
+    return static_cast<uint64_t>(entry - m_index.begin());
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::addToIndex(const id_t id) noexcept
+{
+    const auto position = firstIndexPositionAfter(m_info[id].basePtr);
+    // the index has the same capacity as the repository, therefore emplacing cannot fail
+    m_index.emplace(position, IndexEntry{m_info[id].basePtr, m_info[id].endPtr, m_info[id].endPtr, id});
+    updateMaxEndPtrStartingAt(position);
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::removeFromIndex(const id_t id) noexcept
+{
+    // segments with the same base pointer are stored directly before the position after the base pointer
+    for (auto position = firstIndexPositionAfter(m_info[id].basePtr);
+         (position > 0U) && (m_index[position - 1U].basePtr == m_info[id].basePtr);
+         --position)
+    {
+        if (m_index[position - 1U].id == id)
+        {
+            m_index.erase(m_index.begin() + (position - 1U));
+            updateMaxEndPtrStartingAt(position - 1U);
+            return;
+        }
+    }
+}
+
+template <typename id_t, typename ptr_t, uint64_t CAPACITY>
+inline void PointerRepository<id_t, ptr_t, CAPACITY>::updateMaxEndPtrStartingAt(const uint64_t position) noexcept
+{
+    for (auto i = position; i < m_index.size(); ++i)
+    {
+        auto& entry = m_index[i];
+        entry.maxEndPtr = ((i > 0U) && (m_index[i - 1U].maxEndPtr > entry.endPtr)) ? m_index[i - 1U].maxEndPtr
+                                                                                       : entry.endPtr;
+    }
+}
+
 } // namespace iox
 
 #endif // IOX_HOOFS_MEMORY_POINTER_REPOSITORY_INL
@@ -0,0 +1,174 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
+#define IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
+
+#include "iceoryx_platform/time.hpp"
+#include "iox/log/logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace iox
+{
+namespace log
+{
+/// @brief A logger which does not write to the console in the thread which logs. The log messages are put into a
+/// lock-free ring buffer of the logging thread and a background thread creates the header of the log messages and
+/// writes them to the console. Instead of blocking the logging thread, log messages are dropped when the ring buffer is
+/// full or a call site exceeds its rate limit; the number of dropped log messages per call site is logged by the
+/// background thread.
+/// @code
+/// int main()
+/// {
+///     iox::log::AsyncLogger::init();
+///
+///     IOX_LOG(INFO, "Hello World");
+///
+///     return 0;
+/// }
+/// @endcode
+/// @note Like every logger which is activated with 'Logger::setActiveLogger', the logger must have a static lifetime
+/// and must outlive all threads which are logging
+class AsyncLogger : public Logger
+{
+  public:
+    /// @brief Maximum number of threads which can log at the same time; log messages of further threads are dropped
+    static constexpr uint32_t MAX_NUMBER_OF_THREADS{16U};
+    /// @brief Number of log messages of a thread which can be pending until they are written by the background thread
+    static constexpr uint32_t MAX_PENDING_MESSAGES_PER_THREAD{32U};
+    /// @brief Maximum size of a log message without the header; longer log messages are truncated
+    static constexpr uint32_t MAX_MESSAGE_SIZE{512U};
+    /// @brief Number of call sites which are rate limited and for which dropped log messages are counted
+    static constexpr uint32_t MAX_NUMBER_OF_CALL_SITES{128U};
+    /// @brief Maximum number of log messages of a call site within the RATE_LIMIT_PERIOD
+    static constexpr uint32_t MAX_MESSAGES_PER_CALL_SITE_AND_PERIOD{16U};
+    /// @brief The period of the rate limit; the dropped log messages are also reported once per period
+    static constexpr std::chrono::nanoseconds RATE_LIMIT_PERIOD{std::chrono::seconds(1)};
+    /// @brief The time the background thread sleeps when there are no pending log messages
+    static constexpr std::chrono::milliseconds POLLING_INTERVAL{10};
+
+    /// @brief Activates an AsyncLogger with static lifetime and initializes it
+    /// @param[in] logLevel the log level which will be used to determine which messages will be logged
+    /// @note Like 'Logger::init', this should only be called in the startup phase of the application and only in the
+    /// main thread
+    static void init(const LogLevel logLevel = logLevelFromEnvOr(LogLevel::INFO)) noexcept;
+
+    ~AsyncLogger() noexcept override;
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger(AsyncLogger&&) = delete;
+
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(AsyncLogger&&) = delete;
+
+  protected:
+    AsyncLogger() noexcept;
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in ConsoleLogger
+    void createLogMessageHeader(const char* file, const int line, const char* function, LogLevel logLevel) noexcept
+        override;
+
+    void flush() noexcept override;
+
+    /// @brief Writes a log message which was assembled in the log buffer of the background thread; the default
+    /// implementation writes it to the console
+    virtual void writeLogMessage() noexcept;
+
+    /// @brief Stops the background thread after all pending log messages were written
+    /// @note A derived class which overrides 'writeLogMessage' must call this in its destructor
+    void stop() noexcept;
+
+  private:
+    enum class RingState : uint8_t
+    {
+        FREE,
+        IN_USE,
+        ABANDONED
+    };
+
+    enum class CallSiteState : uint8_t
+    {
+        FREE,
+        CLAIMED,
+        READY
+    };
+
+    struct LogRecord
+    {
+        timespec timestamp{0, 0};
+        LogLevel logLevel{LogLevel::OFF};
+        // NOLINTJUSTIFICATION the log message is copied into the record with strncpy and always null-terminated
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char message[MAX_MESSAGE_SIZE + 1U]{0};
+    };
+
+    /// @brief single producer single consumer ring buffer of the log records of one thread
+    struct RecordRing
+    {
+        std::atomic<RingState> state{RingState::FREE};
+        std::atomic<uint64_t> writeIndex{0U};
+        std::atomic<uint64_t> readIndex{0U};
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        LogRecord records[MAX_PENDING_MESSAGES_PER_THREAD];
+    };
+
+    struct CallSite
+    {
+        std::atomic<CallSiteState> state{CallSiteState::FREE};
+        // only written before the state is READY
+        const char* file{nullptr};
+        int line{0};
+        std::atomic<uint64_t> periodStartInNs{0U};
+        std::atomic<uint32_t> messagesInPeriod{0U};
+        std::atomic<uint64_t> droppedMessages{0U};
+    };
+
+    struct ThreadState;
+
+    static ThreadState& threadStateStorage() noexcept;
+    ThreadState& threadState() noexcept;
+
+    // AXIVION Next Construct AutosarC++19_03-A3.9.1 : file and line are used in conjunction with '__FILE__' and
+    // '__LINE__'
+    CallSite* callSite(const char* file, const int line) noexcept;
+    static bool isWithinRateLimit(CallSite& callSite, const uint64_t nowInNs) noexcept;
+    void countDroppedMessage(CallSite* callSite) noexcept;
+    bool tryPushLogMessage(ThreadState& state) noexcept;
+    RecordRing* claimRecordRing() noexcept;
+
+    void run() noexcept;
+    bool writePendingLogMessages() noexcept;
+    void writeDroppedMessages(const bool isForced) noexcept;
+
+  private:
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    RecordRing m_rings[MAX_NUMBER_OF_THREADS];
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    CallSite m_callSites[MAX_NUMBER_OF_CALL_SITES];
+    std::atomic<uint64_t> m_droppedMessagesOfUnknownCallSites{0U};
+    uint64_t m_lastDropReportInNs{0U};
+    std::atomic<bool> m_keepRunning{true};
+    std::thread m_thread;
+};
+
+} // namespace log
+} // namespace iox
+
+#endif // IOX_HOOFS_REPORTING_LOG_ASYNC_LOGGER_HPP
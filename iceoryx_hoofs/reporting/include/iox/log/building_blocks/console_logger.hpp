@@ -18,6 +18,7 @@
 #ifndef IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_CONSOLE_LOGGER_HPP
 #define IOX_HOOFS_REPORTING_LOG_BUILDING_BLOCKS_CONSOLE_LOGGER_HPP
 
+#include "iceoryx_platform/time.hpp"
 #include "iox/iceoryx_hoofs_types.hpp"
 #include "iox/log/building_blocks/logformat.hpp"
 
@@ -64,6 +65,16 @@ class ConsoleLogger
     virtual void
     createLogMessageHeader(const char* file, const int line, const char* function, LogLevel logLevel) noexcept;
 
+    /// @brief Creates the header of a log message with the provided timestamp instead of the current time, e.g. for
+    /// log messages which are written some time after they were created
+    /// @param[in] timestamp is the point in time the log message was created
+    /// @param[in] logLevel is the log level of the log message
+    void createLogMessageHeaderWithTimestamp(const timespec& timestamp, LogLevel logLevel) noexcept;
+
+    /// @brief Obtains the current time which is used for the header of the log messages
+    /// @return the current time of the realtime clock or zero if the clock could not be read
+    static timespec currentTimestamp() noexcept;
+
     virtual void flush() noexcept;
 
     LogBuffer getLogBuffer() const noexcept;
@@ -0,0 +1,358 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/async_logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace iox
+{
+namespace log
+{
+namespace
+{
+uint64_t toNanoseconds(const timespec& timestamp) noexcept
+{
+    constexpr uint64_t NANOSECS_PER_SEC{1000000000U};
+    return static_cast<uint64_t>(timestamp.tv_sec) * NANOSECS_PER_SEC + static_cast<uint64_t>(timestamp.tv_nsec);
+}
+} // namespace
+
+constexpr uint32_t AsyncLogger::MAX_NUMBER_OF_THREADS;
+constexpr uint32_t AsyncLogger::MAX_PENDING_MESSAGES_PER_THREAD;
+constexpr uint32_t AsyncLogger::MAX_MESSAGE_SIZE;
+constexpr uint32_t AsyncLogger::MAX_NUMBER_OF_CALL_SITES;
+constexpr uint32_t AsyncLogger::MAX_MESSAGES_PER_CALL_SITE_AND_PERIOD;
+constexpr std::chrono::nanoseconds AsyncLogger::RATE_LIMIT_PERIOD;
+constexpr std::chrono::milliseconds AsyncLogger::POLLING_INTERVAL;
+
+/// @brief The log message a thread is currently creating and the ring buffer the thread claimed for its log messages
+struct AsyncLogger::ThreadState
+{
+    ThreadState() noexcept = default;
+    ~ThreadState() noexcept
+    {
+        releaseRing();
+    }
+
+    ThreadState(const ThreadState&) = delete;
+    ThreadState(ThreadState&&) = delete;
+
+    ThreadState& operator=(const ThreadState&) = delete;
+    ThreadState& operator=(ThreadState&&) = delete;
+
+    /// @brief hands the ring buffer over to the background thread which frees it once the pending log messages are
+    /// written
+    void releaseRing() noexcept
+    {
+        if (ring != nullptr)
+        {
+            ring->state.store(RingState::ABANDONED, std::memory_order_release);
+            ring = nullptr;
+        }
+    }
+
+    AsyncLogger* logger{nullptr};
+    RecordRing* ring{nullptr};
+    timespec timestamp{0, 0};
+    LogLevel logLevel{LogLevel::OFF};
+    CallSite* callSite{nullptr};
+    bool isSuppressed{false};
+};
+
+void AsyncLogger::init(const LogLevel logLevel) noexcept
+{
+    static AsyncLogger logger;
+    Logger::setActiveLogger(logger);
+    Logger::init(logLevel);
+}
+
+AsyncLogger::AsyncLogger() noexcept
+    : m_thread([this] { run(); })
+{
+}
+
+AsyncLogger::~AsyncLogger() noexcept
+{
+    stop();
+
+    auto& state = threadStateStorage();
+    if (state.logger == this)
+    {
+        state.ring = nullptr;
+        state.logger = nullptr;
+    }
+}
+
+void AsyncLogger::stop() noexcept
+{
+    m_keepRunning.store(false, std::memory_order_relaxed);
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+AsyncLogger::ThreadState& AsyncLogger::threadStateStorage() noexcept
+{
+    thread_local static ThreadState state;
+    return state;
+}
+
+AsyncLogger::ThreadState& AsyncLogger::threadState() noexcept
+{
+    auto& state = threadStateStorage();
+    if (state.logger != this)
+    {
+        state.releaseRing();
+        state.logger = this;
+    }
+    return state;
+}
+
+// AXIVION Next Construct AutosarC++19_03-A3.9.1 : See at declaration in ConsoleLogger
+void AsyncLogger::createLogMessageHeader(const char* file,
+                                         const int line,
+                                         const char*,
+                                         LogLevel logLevel) noexcept
+{
+    auto& state = threadState();
+    state.timestamp = currentTimestamp();
+    state.logLevel = logLevel;
+    state.callSite = callSite(file, line);
+    state.isSuppressed =
+        (state.callSite != nullptr) && !isWithinRateLimit(*state.callSite, toNanoseconds(state.timestamp));
+
+    // the header is created by the background thread; the log buffer contains only the log message
+    assumeFlushed();
+}
+
+void AsyncLogger::flush() noexcept
+{
+    auto& state = threadState();
+    if (state.isSuppressed || !tryPushLogMessage(state))
+    {
+        countDroppedMessage(state.callSite);
+    }
+    assumeFlushed();
+}
+
+void AsyncLogger::writeLogMessage() noexcept
+{
+    ConsoleLogger::flush();
+}
+
+AsyncLogger::CallSite* AsyncLogger::callSite(const char* file, const int line) noexcept
+{
+    constexpr uint64_t HASH_MULTIPLIER{0x9E3779B97F4A7C15U};
+    // NOLINTJUSTIFICATION only the address of the file name is hashed, the pointer is not dereferenced
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto hash = (reinterpret_cast<uintptr_t>(file) ^ static_cast<uint64_t>(line)) * HASH_MULTIPLIER;
+
+    for (uint64_t i = 0U; i < MAX_NUMBER_OF_CALL_SITES; ++i)
+    {
+        auto& site = m_callSites[(hash + i) % MAX_NUMBER_OF_CALL_SITES];
+        auto state = site.state.load(std::memory_order_acquire);
+        if (state == CallSiteState::FREE)
+        {
+            if (site.state.compare_exchange_strong(state, CallSiteState::CLAIMED, std::memory_order_acquire))
+            {
+                site.file = file;
+                site.line = line;
+                site.state.store(CallSiteState::READY, std::memory_order_release);
+                return &site;
+            }
+        }
+
+        // a call site which is just claimed by another thread is skipped; if it is the same call site, it ends up
+        // twice in the table which only doubles its rate limit
+        if (state == CallSiteState::READY && site.file == file && site.line == line)
+        {
+            return &site;
+        }
+    }
+
+    return nullptr;
+}
+
+bool AsyncLogger::isWithinRateLimit(CallSite& callSite, const uint64_t nowInNs) noexcept
+{
+    const auto periodInNs = static_cast<uint64_t>(RATE_LIMIT_PERIOD.count());
+    auto periodStart = callSite.periodStartInNs.load(std::memory_order_relaxed);
+    if (nowInNs < periodStart || nowInNs - periodStart >= periodInNs)
+    {
+        // only one of the concurrently logging threads starts the new period
+        if (callSite.periodStartInNs.compare_exchange_strong(periodStart, nowInNs, std::memory_order_relaxed))
+        {
+            callSite.messagesInPeriod.store(0U, std::memory_order_relaxed);
+        }
+    }
+
+    return callSite.messagesInPeriod.fetch_add(1U, std::memory_order_relaxed) < MAX_MESSAGES_PER_CALL_SITE_AND_PERIOD;
+}
+
+void AsyncLogger::countDroppedMessage(CallSite* callSite) noexcept
+{
+    if (callSite != nullptr)
+    {
+        callSite->droppedMessages.fetch_add(1U, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_droppedMessagesOfUnknownCallSites.fetch_add(1U, std::memory_order_relaxed);
+    }
+}
+
+AsyncLogger::RecordRing* AsyncLogger::claimRecordRing() noexcept
+{
+    for (auto& ring : m_rings)
+    {
+        auto expected = RingState::FREE;
+        if (ring.state.compare_exchange_strong(expected, RingState::IN_USE, std::memory_order_acquire))
+        {
+            return &ring;
+        }
+    }
+    return nullptr;
+}
+
+bool AsyncLogger::tryPushLogMessage(ThreadState& state) noexcept
+{
+    if (state.ring == nullptr)
+    {
+        state.ring = claimRecordRing();
+        if (state.ring == nullptr)
+        {
+            return false;
+        }
+    }
+
+    auto& ring = *state.ring;
+    const auto writeIndex = ring.writeIndex.load(std::memory_order_relaxed);
+    if (writeIndex - ring.readIndex.load(std::memory_order_acquire) >= MAX_PENDING_MESSAGES_PER_THREAD)
+    {
+        return false;
+    }
+
+    auto& record = ring.records[writeIndex % MAX_PENDING_MESSAGES_PER_THREAD];
+    record.timestamp = state.timestamp;
+    record.logLevel = state.logLevel;
+    const auto logBuffer = getLogBuffer();
+    const auto messageSize = std::min<uint64_t>(logBuffer.writeIndex, MAX_MESSAGE_SIZE);
+    std::memcpy(&record.message[0], logBuffer.buffer, messageSize);
+    record.message[messageSize] = 0;
+
+    ring.writeIndex.store(writeIndex + 1U, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::run() noexcept
+{
+    while (m_keepRunning.load(std::memory_order_relaxed))
+    {
+        const bool hasWrittenLogMessages = writePendingLogMessages();
+        constexpr bool IS_FORCED{false};
+        writeDroppedMessages(IS_FORCED);
+        if (!hasWrittenLogMessages)
+        {
+            std::this_thread::sleep_for(POLLING_INTERVAL);
+        }
+    }
+
+    writePendingLogMessages();
+    constexpr bool IS_FORCED{true};
+    writeDroppedMessages(IS_FORCED);
+}
+
+bool AsyncLogger::writePendingLogMessages() noexcept
+{
+    bool hasWrittenLogMessages{false};
+    for (auto& ring : m_rings)
+    {
+        // the state is loaded before the write index in order to write all log messages of an abandoned ring before
+        // it is freed
+        const auto state = ring.state.load(std::memory_order_acquire);
+        if (state == RingState::FREE)
+        {
+            continue;
+        }
+
+        auto readIndex = ring.readIndex.load(std::memory_order_relaxed);
+        const auto writeIndex = ring.writeIndex.load(std::memory_order_acquire);
+        for (; readIndex < writeIndex; ++readIndex)
+        {
+            const auto& record = ring.records[readIndex % MAX_PENDING_MESSAGES_PER_THREAD];
+            createLogMessageHeaderWithTimestamp(record.timestamp, record.logLevel);
+            logString(&record.message[0]);
+            writeLogMessage();
+            ring.readIndex.store(readIndex + 1U, std::memory_order_release);
+            hasWrittenLogMessages = true;
+        }
+
+        if (state == RingState::ABANDONED)
+        {
+            ring.state.store(RingState::FREE, std::memory_order_release);
+        }
+    }
+    return hasWrittenLogMessages;
+}
+
+void AsyncLogger::writeDroppedMessages(const bool isForced) noexcept
+{
+    const auto now = currentTimestamp();
+    const auto nowInNs = toNanoseconds(now);
+    const auto periodInNs = static_cast<uint64_t>(RATE_LIMIT_PERIOD.count());
+    if (!isForced && nowInNs >= m_lastDropReportInNs && nowInNs - m_lastDropReportInNs < periodInNs)
+    {
+        return;
+    }
+    m_lastDropReportInNs = nowInNs;
+
+    for (auto& site : m_callSites)
+    {
+        if (site.state.load(std::memory_order_acquire) != CallSiteState::READY)
+        {
+            continue;
+        }
+
+        const auto droppedMessages = site.droppedMessages.exchange(0U, std::memory_order_relaxed);
+        if (droppedMessages > 0U)
+        {
+            createLogMessageHeaderWithTimestamp(now, LogLevel::WARN);
+            logString("Dropped ");
+            logDec(droppedMessages);
+            logString(" log messages at ");
+            logString(site.file);
+            logChar(':');
+            logDec(site.line);
+            writeLogMessage();
+        }
+    }
+
+    const auto droppedMessages = m_droppedMessagesOfUnknownCallSites.exchange(0U, std::memory_order_relaxed);
+    if (droppedMessages > 0U)
+    {
+        createLogMessageHeaderWithTimestamp(now, LogLevel::WARN);
+        logString("Dropped ");
+        logDec(droppedMessages);
+        logString(" log messages at untracked call sites");
+        writeLogMessage();
+    }
+}
+
+} // namespace log
+} // namespace iox
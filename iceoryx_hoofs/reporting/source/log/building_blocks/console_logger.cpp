@@ -56,6 +56,16 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
                                            const int line,
                                            const char* function,
                                            LogLevel logLevel) noexcept
+{
+    /// @todo iox-#1755 add an option to also print file, line and function
+    unused(file);
+    unused(line);
+    unused(function);
+
+    createLogMessageHeaderWithTimestamp(currentTimestamp(), logLevel);
+}
+
+timespec ConsoleLogger::currentTimestamp() noexcept
 {
     timespec timestamp{0, 0};
     // intentionally avoid using 'iox::posixCall' here to keep the logger dependency free
@@ -64,7 +74,14 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
         timestamp = {0, 0};
         // intentionally do nothing since a timestamp from 01.01.1970 already indicates  an issue with the clock
     }
+    return timestamp;
+}
 
+// AXIVION Next Construct AutosarC++19_03-M9.3.3 : This is the default implementation for a logger. The design requires
+// this to be non-static to not restrict custom implementations
+// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+void ConsoleLogger::createLogMessageHeaderWithTimestamp(const timespec& timestamp, LogLevel logLevel) noexcept
+{
     const time_t time{timestamp.tv_sec};
 
 /// @todo iox-#1755 since this will be part of the platform at one point, we might not be able to handle this via the
@@ -118,11 +135,6 @@ void ConsoleLogger::createLogMessageHeader(const char* file,
     /// @todo iox-#1755 do we also want to always log the iceoryx version and commit sha? Maybe do that only in
     /// 'initLogger' with LogDebug
 
-    /// @todo iox-#1755 add an option to also print file, line and function
-    unused(file);
-    unused(line);
-    unused(function);
-
     // AXIVION Next Construct AutosarC++19_03-A3.9.1 : Not used as an integer but as string literal
     // AXIVION Next Construct AutosarC++19_03-M2.13.2 : Required for the color codes; only valid octal digits are used
     constexpr const char* COLOR_GRAY{"\033[0;90m"};
@@ -107,5 +107,109 @@ bool LoFFLi::push(const Index_t index) noexcept
     return true;
 }
 
+uint32_t LoFFLi::popBatch(not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    Index_t* const indexMemory{indices};
+    if (maxNumberOfIndices == 0U || !m_nextFreeIndex)
+    {
+        return 0U;
+    }
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        /// the chain is only stable when the head did not change in the meantime; this is verified by the CAS
+        /// and therefore the indices are collected again on every retry
+        numberOfIndices = 0U;
+        Index_t nextFreeIndex = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < maxNumberOfIndices && nextFreeIndex < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by caller
+            indexMemory[numberOfIndices] = nextFreeIndex;
+            ++numberOfIndices;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            nextFreeIndex = m_nextFreeIndex.get()[nextFreeIndex];
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.indexToNextFreeIndex = nextFreeIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) see pop
+        m_nextFreeIndex.get()[indexMemory[i]] = m_invalidIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
+bool LoFFLi::pushBatch(not_null<const Index_t*> indices, const uint32_t numberOfIndices) noexcept
+{
+    const Index_t* const indexMemory{indices};
+    if (numberOfIndices == 0U)
+    {
+        return true;
+    }
+
+    /// we synchronize with m_nextFreeIndex in pop to perform the validity check
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (!m_nextFreeIndex)
+    {
+        return false;
+    }
+
+    /// the indices are chained in the order they are provided; since every chained index is no longer marked as
+    /// invalid, an index which is contained twice in the batch is detected like a double free
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by caller
+        const Index_t index = indexMemory[i];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        if (index >= m_size || m_nextFreeIndex.get()[index] != m_invalidIndex)
+        {
+            for (uint32_t j = 0U; j < i; ++j)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) already validated
+                m_nextFreeIndex.get()[indexMemory[j]] = m_invalidIndex;
+            }
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) the last index is chained to the head below
+        m_nextFreeIndex.get()[index] = (i + 1U < numberOfIndices) ? indexMemory[i + 1U] : m_size;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by caller
+    const Index_t firstIndex = indexMemory[0U];
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by caller
+    const Index_t lastIndex = indexMemory[numberOfIndices - 1U];
+
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+
+    do
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) index is limited by capacity
+        m_nextFreeIndex.get()[lastIndex] = oldHead.indexToNextFreeIndex;
+        newHead.indexToNextFreeIndex = firstIndex;
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    return true;
+}
+
 } // namespace concurrent
 } // namespace iox
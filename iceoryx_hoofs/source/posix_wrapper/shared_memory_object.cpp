@@ -16,23 +16,28 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/signal_handler.hpp"
 #include "iceoryx_hoofs/posix_wrapper/types.hpp"
 #include "iceoryx_platform/fcntl.hpp"
 #include "iceoryx_platform/unistd.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/attributes.hpp"
 #include "iox/logging.hpp"
+#include "iox/vector.hpp"
 
 #include <bitset>
 #include <cstdlib>
 #include <cstring>
 #include <mutex>
+#include <thread>
 
 namespace iox
 {
 namespace posix
 {
 constexpr const void* const SharedMemoryObject::NO_ADDRESS_HINT;
+constexpr uint32_t SharedMemoryZeroingOptions::MAX_NUMBER_OF_THREADS;
 constexpr uint64_t SIGBUS_ERROR_MESSAGE_LENGTH = 1024U + platform::IOX_MAX_SHM_NAME_LENGTH;
 
 /// NOLINTJUSTIFICATION global variables are only accessible from within this compilation unit
@@ -52,6 +57,38 @@ static void memsetSigbusHandler(int) noexcept
     _exit(EXIT_FAILURE);
 }
 
+/// @brief zeroes the memory with memset; the memory is split into page aligned parts which are zeroed concurrently
+///        when more than one thread is requested
+static void zeroMemory(void* const memory, const uint64_t size, const uint32_t numberOfThreads) noexcept
+{
+    const uint64_t pageSize = iox::internal::pageSize();
+    const uint64_t numberOfPages = (size + pageSize - 1U) / pageSize;
+    const uint64_t usableThreads =
+        algorithm::minVal(algorithm::maxVal(numberOfThreads, 1U), SharedMemoryZeroingOptions::MAX_NUMBER_OF_THREADS);
+    const uint64_t numberOfParts = algorithm::minVal(usableThreads, algorithm::maxVal(numberOfPages, uint64_t{1U}));
+    const uint64_t partSize = ((numberOfPages + numberOfParts - 1U) / numberOfParts) * pageSize;
+
+    auto zeroPart = [memory, size, partSize](const uint64_t part) {
+        const uint64_t offset = part * partSize;
+        if (offset < size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset is smaller than size
+            memset(static_cast<uint8_t*>(memory) + offset, 0, algorithm::minVal(partSize, size - offset));
+        }
+    };
+
+    vector<std::thread, SharedMemoryZeroingOptions::MAX_NUMBER_OF_THREADS> workers;
+    for (uint64_t part = 1U; part < numberOfParts; ++part)
+    {
+        workers.emplace_back(zeroPart, part);
+    }
+    zeroPart(0U);
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
 // NOLINTJUSTIFICATION the function size is related to the error handling and the cognitive complexity
 // results from the expanded log macro
 // NOLINTNEXTLINE(readability-function-size,readability-function-cognitive-complexity)
@@ -113,6 +150,13 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
         return err(SharedMemoryObjectError::REQUESTED_SIZE_EXCEEDS_ACTUAL_SIZE);
     }
 
+    auto pageOptions = m_pageOptions;
+    if (!sharedMemory->hasOwnership())
+    {
+        // the NUMA binding of a shared memory is shared by all its mappings and was already applied by its creator
+        pageOptions.numaNode.reset();
+    }
+
     auto memoryMap = MemoryMapBuilder()
                          .baseAddressHint((m_baseAddressHint) ? *m_baseAddressHint : nullptr)
                          .length(realSize)
@@ -120,6 +164,7 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
                          .accessMode(m_accessMode)
                          .flags(MemoryMapFlags::SHARE_CHANGES)
                          .offset(0)
+                         .pageOptions(pageOptions)
                          .create();
 
     if (!memoryMap)
@@ -132,7 +177,7 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
     if (sharedMemory->hasOwnership())
     {
         IOX_LOG(DEBUG, "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name << "]");
-        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
+        if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION && m_zeroingOptions.zeroOnCreation)
         {
             // this lock is required for the case that multiple threads are creating multiple
             // shared memory objects concurrently
@@ -162,7 +207,7 @@ expected<SharedMemoryObject, SharedMemoryObjectError> SharedMemoryObjectBuilder:
                 (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                 m_permissions.value()));
 
-            memset(memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            zeroMemory(memoryMap->getBaseAddress(), m_memorySizeInBytes, m_zeroingOptions.numberOfThreads);
         }
         IOX_LOG(DEBUG,
                 "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name << "]");
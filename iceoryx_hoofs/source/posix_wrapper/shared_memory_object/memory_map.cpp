@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object/memory_map.hpp"
+#include "iceoryx_hoofs/internal/posix_wrapper/system_configuration.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
 #include "iceoryx_hoofs/posix_wrapper/types.hpp"
 #include "iox/logging.hpp"
@@ -26,14 +27,37 @@ namespace iox
 {
 namespace posix
 {
+namespace
+{
+/// @brief populates the page tables by reading a byte of every page of the memory
+void touchPages(const void* const baseAddress, const uint64_t length) noexcept
+{
+    const auto pageSize = iox::internal::pageSize();
+    const auto* const memory = static_cast<const volatile uint8_t*>(baseAddress);
+    for (uint64_t offset{0U}; offset < length; offset += pageSize)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) low-level memory management
+        static_cast<void>(memory[offset]);
+    }
+}
+} // namespace
+
 expected<MemoryMap, MemoryMapError> MemoryMapBuilder::create() noexcept
 {
+    // the pages must not be populated before the kernel is advised to use transparent huge pages or before they are
+    // bound to a NUMA node, otherwise they would be backed by regular pages or memory of another node; in this case
+    // they are populated afterwards
+    const bool populateOnMapping = m_pageOptions.prefault && !m_pageOptions.transparentHugePages
+                                   && !m_pageOptions.numaNode.has_value() && (IOX_MAP_POPULATE != 0);
+    // NOLINTNEXTLINE(hicpp-signed-bitwise) flags are defined by POSIX, no logical fault
+    const int32_t flags = static_cast<int32_t>(m_flags) | (populateOnMapping ? IOX_MAP_POPULATE : 0);
+
     // AXIVION Next Construct AutosarC++19_03-A5.2.3, CertC++-EXP55 : Incompatibility with POSIX definition of mmap
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast) low-level memory management
     auto result = posixCall(mmap)(const_cast<void*>(m_baseAddressHint),
                                   m_length,
                                   convertToProtFlags(m_accessMode),
-                                  static_cast<int32_t>(m_flags),
+                                  flags,
                                   m_fileDescriptor,
                                   m_offset)
 
@@ -43,19 +67,71 @@ expected<MemoryMap, MemoryMapError> MemoryMapBuilder::create() noexcept
                       // NOLINTEND(cppcoreguidelines-pro-type-cstyle-cast, performance-no-int-to-ptr)
                       .evaluate();
 
-    if (result)
+    if (!result)
     {
-        return ok(MemoryMap(result.value().value, m_length));
+        constexpr uint64_t FLAGS_BIT_SIZE = 32U;
+        IOX_LOG(ERROR,
+                "Unable to map memory with the following properties [ baseAddressHint = "
+                    << iox::log::hex(m_baseAddressHint) << ", length = " << m_length
+                    << ", fileDescriptor = " << m_fileDescriptor << ", access mode = " << asStringLiteral(m_accessMode)
+                    << ", flags = " << std::bitset<FLAGS_BIT_SIZE>(static_cast<uint32_t>(flags)).to_string()
+                    << ", offset = " << iox::log::hex(m_offset) << " ]");
+        return err(MemoryMap::errnoToEnum(result.error().errnum));
+    }
+
+    MemoryMap memoryMap(result.value().value, m_length);
+
+    if (m_pageOptions.numaNode.has_value())
+    {
+        auto bindResult =
+            posixCall(iox_mbind_to_numa_node)(memoryMap.getBaseAddress(), m_length, m_pageOptions.numaNode.value())
+                .failureReturnValue(-1)
+                .evaluate();
+        if (bindResult.has_error())
+        {
+            IOX_LOG(ERROR,
+                    "Unable to bind the mapped memory to the NUMA node " << m_pageOptions.numaNode.value() << " [ "
+                                                                         << bindResult.error().getHumanReadableErrnum()
+                                                                         << " ]");
+            return err(MemoryMapError::UNABLE_TO_BIND_TO_NUMA_NODE);
+        }
+    }
+
+    if (m_pageOptions.transparentHugePages)
+    {
+        auto adviseResult = posixCall(iox_madvise_huge_pages)(memoryMap.getBaseAddress(), m_length)
+                                .failureReturnValue(-1)
+                                .suppressErrorMessagesForErrnos(EINVAL, ENOTSUP)
+                                .evaluate();
+        if (adviseResult.has_error())
+        {
+            IOX_LOG(WARN,
+                    "Unable to use transparent huge pages for the mapped memory, falling back to regular pages [ "
+                        << adviseResult.error().getHumanReadableErrnum() << " ]");
+        }
+    }
+
+    if (m_pageOptions.prefault && !populateOnMapping)
+    {
+        touchPages(memoryMap.getBaseAddress(), m_length);
+    }
+
+    if (m_pageOptions.lockInMemory)
+    {
+        auto lockResult = posixCall(iox_mlock)(memoryMap.getBaseAddress(), m_length).failureReturnValue(-1).evaluate();
+        if (lockResult.has_error())
+        {
+            IOX_LOG(ERROR,
+                    "Unable to lock the mapped memory with a length of "
+                        << m_length
+                        << " bytes in RAM. Either the memory lock limit (RLIMIT_MEMLOCK) of the process is exceeded "
+                           "or not enough memory is available [ "
+                        << lockResult.error().getHumanReadableErrnum() << " ]");
+            return err(MemoryMapError::UNABLE_TO_LOCK);
+        }
     }
 
-    constexpr uint64_t FLAGS_BIT_SIZE = 32U;
-    IOX_LOG(ERROR,
-            "Unable to map memory with the following properties [ baseAddressHint = "
-                << iox::log::hex(m_baseAddressHint) << ", length = " << m_length
-                << ", fileDescriptor = " << m_fileDescriptor << ", access mode = " << asStringLiteral(m_accessMode)
-                << ", flags = " << std::bitset<FLAGS_BIT_SIZE>(static_cast<uint32_t>(m_flags)).to_string()
-                << ", offset = " << iox::log::hex(m_offset) << " ]");
-    return err(MemoryMap::errnoToEnum(result.error().errnum));
+    return ok(std::move(memoryMap));
 }
 
 MemoryMap::MemoryMap(void* const baseAddress, const uint64_t length) noexcept
@@ -227,4 +227,100 @@ TYPED_TEST(LoFFLi_test, PushToUninitializedLoFFLi)
     decltype(this->m_loffli) loFFLi;
     EXPECT_THAT(loFFLi.push(0), Eq(false));
 }
+
+TYPED_TEST(LoFFLi_test, PopBatchReturnsRequestedNumberOfIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dbafd4d2-ca03-4ad6-983a-d1ff537999a6");
+    constexpr uint32_t BATCH_SIZE{Size - 1U};
+    uint32_t indices[BATCH_SIZE]{0}; // NOLINT(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) test array
+
+    ASSERT_THAT(this->m_loffli.popBatch(&indices[0], BATCH_SIZE), Eq(BATCH_SIZE));
+    for (uint32_t i = 0; i < BATCH_SIZE; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(BATCH_SIZE));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchReturnsRemainingIndicesWhenBatchIsLargerThanFreeList)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8d6a071-8d2b-4987-89ca-28901ed88adb");
+    constexpr uint32_t BATCH_SIZE{Size + 2U};
+    uint32_t indices[BATCH_SIZE]{0}; // NOLINT(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) test array
+
+    uint32_t index{0};
+    ASSERT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    EXPECT_THAT(this->m_loffli.popBatch(&indices[0], BATCH_SIZE), Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.popBatch(&indices[0], BATCH_SIZE), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PopBatchFromUninitializedLoFFLiReturnsNoIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "80698a54-1608-48ab-a7bb-cb4cce395cd6");
+    uint32_t indices[Size]{0}; // NOLINT(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) test array
+
+    decltype(this->m_loffli) loFFLi;
+    EXPECT_THAT(loFFLi.popBatch(&indices[0], Size), Eq(0U));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchMakesAllIndicesAvailableAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41c87d96-091f-465d-9bf2-efd0d7cff48b");
+    uint32_t indices[Size]{0}; // NOLINT(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) test array
+    ASSERT_THAT(this->m_loffli.popBatch(&indices[0], Size), Eq(Size));
+
+    EXPECT_THAT(this->m_loffli.pushBatch(&indices[0], Size), Eq(true));
+
+    std::vector<uint32_t> useListPoped;
+    uint32_t index{0};
+    while (this->m_loffli.pop(index))
+    {
+        useListPoped.push_back(index);
+    }
+    std::sort(useListPoped.begin(), useListPoped.end());
+
+    EXPECT_THAT(useListPoped, Eq(std::vector<uint32_t>(&indices[0], &indices[Size])));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWithIndexWhichIsNotPopedFailsAndPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "04732995-c714-4e2b-bbac-56e8323c6b35");
+    uint32_t indices[Size]{0}; // NOLINT(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) test array
+    ASSERT_THAT(this->m_loffli.popBatch(&indices[0], Size - 1U), Eq(Size - 1U));
+    indices[Size - 1U] = Size - 1U;
+
+    EXPECT_THAT(this->m_loffli.pushBatch(&indices[0], Size), Eq(false));
+
+    uint32_t index{0};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(Size - 1U));
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(false));
+
+    EXPECT_THAT(this->m_loffli.pushBatch(&indices[0], Size), Eq(true));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWithDuplicatedIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "73736847-8e24-4349-a5d8-31c04e115fa0");
+    uint32_t indices[Size]{0}; // NOLINT(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) test array
+    ASSERT_THAT(this->m_loffli.popBatch(&indices[0], Size), Eq(Size));
+    indices[Size - 1U] = indices[0];
+
+    EXPECT_THAT(this->m_loffli.pushBatch(&indices[0], Size), Eq(false));
+}
+
+TYPED_TEST(LoFFLi_test, PushBatchWithOutOfBoundIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f86073f-8f2e-4043-af60-4d4aa34aa6b2");
+    uint32_t indices[Size]{0}; // NOLINT(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) test array
+    ASSERT_THAT(this->m_loffli.popBatch(&indices[0], Size), Eq(Size));
+    indices[1] = Size + 42U;
+
+    EXPECT_THAT(this->m_loffli.pushBatch(&indices[0], Size), Eq(false));
+}
 } // namespace
@@ -29,6 +29,8 @@ using namespace iox;
 constexpr uint64_t SHARED_MEMORY_SIZE = 4096UL * 32UL;
 constexpr uint64_t NUMBER_OF_MEMORY_PARTITIONS = 2U;
 uint8_t memoryPatternValue = 1U;
+/// @brief the id of relative pointers to memory which is not contained in any registered segment
+constexpr segment_id_underlying_t RAW_POINTER_BEHAVIOUR_ID{0U};
 
 template <typename T>
 class RelativePointer_test : public Test
@@ -526,6 +528,86 @@ TYPED_TEST(RelativePointer_test, MemoryRemappingWorks)
     }
 }
 
+TYPED_TEST(RelativePointer_test, SearchingTheIdOfManySegmentsReturnsTheSegmentContainingThePointer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15b21b9f-4934-408f-881c-2c8649244ecb");
+    constexpr uint64_t NUMBER_OF_SEGMENTS{1000U};
+    constexpr uint64_t SEGMENT_SIZE{NUMBER_OF_MEMORY_PARTITIONS * SHARED_MEMORY_SIZE / NUMBER_OF_SEGMENTS / 8U * 8U};
+    auto* memory = this->partitionPtr(0U);
+
+    // NOLINTJUSTIFICATION Pointer arithmetic needed for tests
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+    // the ids are registered in the reverse order of the addresses of the segments
+    for (uint64_t i = 0U; i < NUMBER_OF_SEGMENTS; ++i)
+    {
+        ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(
+            segment_id_t{NUMBER_OF_SEGMENTS - i}, memory + i * SEGMENT_SIZE, SEGMENT_SIZE));
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SEGMENTS; ++i)
+    {
+        const segment_id_underlying_t expectedId{NUMBER_OF_SEGMENTS - i};
+        RelativePointer<TypeParam> rpToStart(reinterpret_cast<TypeParam*>(memory + i * SEGMENT_SIZE));
+        RelativePointer<TypeParam> rpToEnd(reinterpret_cast<TypeParam*>(memory + (i + 1U) * SEGMENT_SIZE - 8U));
+        EXPECT_EQ(rpToStart.getId(), expectedId);
+        EXPECT_EQ(rpToStart.getOffset(), 0U);
+        EXPECT_EQ(rpToEnd.getId(), expectedId);
+        EXPECT_EQ(rpToEnd.getOffset(), SEGMENT_SIZE - 8U);
+    }
+
+    RelativePointer<TypeParam> rpAfterAllSegments(
+        reinterpret_cast<TypeParam*>(memory + NUMBER_OF_SEGMENTS * SEGMENT_SIZE));
+    EXPECT_EQ(rpAfterAllSegments.getId(), RAW_POINTER_BEHAVIOUR_ID);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+TYPED_TEST(RelativePointer_test, SearchingTheIdOfOverlappingSegmentsReturnsTheSmallestId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f92bde5-66df-4066-833b-f30bbabd937c");
+    auto* memory = this->partitionPtr(0U);
+
+    // NOLINTJUSTIFICATION Pointer arithmetic needed for tests
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{3U}, memory, SHARED_MEMORY_SIZE));
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(
+        segment_id_t{2U}, memory + SHARED_MEMORY_SIZE / 2U, SHARED_MEMORY_SIZE / 4U));
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{5U}, memory + SHARED_MEMORY_SIZE / 8U, 64U));
+
+    RelativePointer<TypeParam> rpOnlyInLargeSegment(reinterpret_cast<TypeParam*>(memory + 8U));
+    RelativePointer<TypeParam> rpInSmallAndLargeSegment(
+        reinterpret_cast<TypeParam*>(memory + SHARED_MEMORY_SIZE / 8U + 8U));
+    RelativePointer<TypeParam> rpInMiddleAndLargeSegment(
+        reinterpret_cast<TypeParam*>(memory + SHARED_MEMORY_SIZE / 2U + 8U));
+    RelativePointer<TypeParam> rpBehindMiddleSegment(
+        reinterpret_cast<TypeParam*>(memory + SHARED_MEMORY_SIZE * 3U / 4U + 8U));
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+
+    EXPECT_EQ(rpOnlyInLargeSegment.getId(), 3U);
+    EXPECT_EQ(rpInSmallAndLargeSegment.getId(), 3U);
+    EXPECT_EQ(rpInMiddleAndLargeSegment.getId(), 2U);
+    EXPECT_EQ(rpBehindMiddleSegment.getId(), 3U);
+}
+
+TYPED_TEST(RelativePointer_test, SearchingTheIdOfAnUnregisteredSegmentReturnsNullPointerId)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "198b0357-e808-4bec-a4f8-ccb2d1418fd2");
+    auto* ptr0 = this->partitionPtr(0U);
+    auto* ptr1 = this->partitionPtr(1U);
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{1U}, ptr0, SHARED_MEMORY_SIZE));
+    ASSERT_TRUE(UntypedRelativePointer::registerPtrWithId(segment_id_t{2U}, ptr1, SHARED_MEMORY_SIZE));
+
+    ASSERT_TRUE(UntypedRelativePointer::unregisterPtr(segment_id_t{1U}));
+
+    // NOLINTJUSTIFICATION Pointer arithmetic needed for tests
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+    RelativePointer<TypeParam> rpToUnregisteredSegment(reinterpret_cast<TypeParam*>(ptr0 + 8U));
+    RelativePointer<TypeParam> rpToRegisteredSegment(reinterpret_cast<TypeParam*>(ptr1 + 8U));
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-type-reinterpret-cast)
+
+    EXPECT_EQ(rpToUnregisteredSegment.getId(), RAW_POINTER_BEHAVIOUR_ID);
+    EXPECT_EQ(rpToRegisteredSegment.getId(), 2U);
+}
+
 TYPED_TEST(RelativePointer_test, DefaultConstructedRelativePtrIsNull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "be25f19c-912c-438e-97b1-6fcacb879453");
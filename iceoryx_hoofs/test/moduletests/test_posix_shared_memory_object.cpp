@@ -17,6 +17,7 @@
 
 #include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iox/memory.hpp"
 #include "test.hpp"
 
@@ -162,6 +163,108 @@ TEST_F(SharedMemoryObject_Test, OpenSutMapsAllMemoryIntoProcess)
     }
 }
 
+TEST_F(SharedMemoryObject_Test, PrefaultedSharedMemoryIsZeroedAndUsable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d1c8e3a-7b42-4f96-a0d5-c2e9b16f7a84");
+    const uint64_t MEMORY_SIZE = 64U * 1024U;
+    iox::posix::MemoryMapPageOptions pageOptions;
+    pageOptions.prefault = true;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmPrefault")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .pageOptions(pageOptions)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ASSERT_THAT(data_ptr[i], Eq(0U));
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        data_ptr[i] = static_cast<uint8_t>(i);
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryZeroedByMultipleThreadsIsZeroed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b2e9f41-c6d3-4a85-9e10-f4a8d2c6b793");
+    // the size is not a multiple of the page size to check that the last part is zeroed without overflow
+    const uint64_t MEMORY_SIZE = 1024U * 1024U + 123U;
+    for (const uint32_t numberOfThreads : {2U, 7U, iox::posix::SharedMemoryZeroingOptions::MAX_NUMBER_OF_THREADS + 1U})
+    {
+        iox::posix::SharedMemoryZeroingOptions zeroingOptions;
+        zeroingOptions.numberOfThreads = numberOfThreads;
+        auto sut = iox::posix::SharedMemoryObjectBuilder()
+                       .name("shmZeroing")
+                       .memorySizeInBytes(MEMORY_SIZE)
+                       .accessMode(iox::posix::AccessMode::READ_WRITE)
+                       .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                       .permissions(perms::owner_all)
+                       .zeroingOptions(zeroingOptions)
+                       .create()
+                       .expect("failed to create sut");
+
+        auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+        for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+        {
+            /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            ASSERT_THAT(data_ptr[i], Eq(0U));
+        }
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, SharedMemoryWhichIsNotZeroedOnCreationContainsTheZeroedPagesOfTheKernel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5a8c3e0-2f7b-4916-b4d8-39c1e6f0a2b5");
+    const uint64_t MEMORY_SIZE = 64U * 1024U;
+    iox::posix::SharedMemoryZeroingOptions zeroingOptions;
+    zeroingOptions.zeroOnCreation = false;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmNotZeroed")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .zeroingOptions(zeroingOptions)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        ASSERT_THAT(data_ptr[i], Eq(0U));
+    }
+}
+
+TEST_F(SharedMemoryObject_Test, TransparentHugePagesAreOnlyAHintAndDoNotPreventTheMapping)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a93f0b27-64de-4c1a-8e75-3b8d2f6c9e10");
+    const uint64_t MEMORY_SIZE = 4U * 1024U * 1024U;
+    iox::posix::MemoryMapPageOptions pageOptions;
+    pageOptions.transparentHugePages = true;
+    pageOptions.prefault = true;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmHugePages")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .pageOptions(pageOptions)
+                   .create();
+
+    ASSERT_FALSE(sut.has_error());
+    auto* data_ptr = static_cast<uint8_t*>(sut->getBaseAddress());
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    data_ptr[MEMORY_SIZE - 1U] = 42U;
+    /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    EXPECT_THAT(data_ptr[MEMORY_SIZE - 1U], Eq(42U));
+}
+
 #if !defined(_WIN32) && !defined(__APPLE__)
 TEST_F(SharedMemoryObject_Test, AcquiringOwnerWorks)
 {
@@ -233,7 +336,94 @@ TEST_F(SharedMemoryObject_Test, SettingPermissionsWorks)
     ASSERT_FALSE(result.has_error());
     EXPECT_THAT(*result, Eq(perms::none));
 }
+
+TEST_F(SharedMemoryObject_Test, LockingSharedMemoryInRamWorksWithinTheMemoryLockLimit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3e7a5c91-d0b8-4f26-9c4e-18f6a2d7b053");
+    const uint64_t MEMORY_SIZE = 4096U;
+    iox::posix::MemoryMapPageOptions pageOptions;
+    pageOptions.prefault = true;
+    pageOptions.lockInMemory = true;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmLocked")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .pageOptions(pageOptions)
+                   .create();
+
+    EXPECT_FALSE(sut.has_error());
+}
 #endif
 
+#if defined(__linux__)
+TEST_F(SharedMemoryObject_Test, BindingSharedMemoryToAnExistingNumaNodeWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8c4f1d26-a7e3-4b59-9d02-e6b3f8a1c5d7");
+    if (access("/sys/devices/system/node/node0", F_OK) != 0)
+    {
+        GTEST_SKIP() << "This test requires a kernel with NUMA support";
+    }
+
+    const uint64_t MEMORY_SIZE = 64U * 1024U;
+    iox::posix::MemoryMapPageOptions pageOptions;
+    pageOptions.numaNode = 0U;
+    pageOptions.prefault = true;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmNuma")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .pageOptions(pageOptions)
+                   .create();
+
+    EXPECT_FALSE(sut.has_error());
+}
+
+TEST_F(SharedMemoryObject_Test, BindingSharedMemoryToANonExistingNumaNodeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f2b7e9a4-5c18-4d63-8a0f-1d7c4e9b6a35");
+    iox::posix::MemoryMapPageOptions pageOptions;
+    pageOptions.numaNode = 1023U;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmNuma")
+                   .memorySizeInBytes(4096U)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .pageOptions(pageOptions)
+                   .create();
+
+    ASSERT_TRUE(sut.has_error());
+    EXPECT_THAT(sut.error(), Eq(posix::SharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED));
+}
+
+TEST_F(SharedMemoryObject_Test, OpeningSharedMemoryDoesNotApplyTheNumaBindingAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a9d6c13-e2f8-4b70-95c6-b8e1a3d7f042");
+    auto creator = iox::posix::SharedMemoryObjectBuilder()
+                       .name("shmNuma")
+                       .memorySizeInBytes(4096U)
+                       .accessMode(iox::posix::AccessMode::READ_WRITE)
+                       .openMode(iox::posix::OpenMode::PURGE_AND_CREATE)
+                       .permissions(perms::owner_all)
+                       .create();
+    ASSERT_FALSE(creator.has_error());
+
+    iox::posix::MemoryMapPageOptions pageOptions;
+    pageOptions.numaNode = 1023U;
+    auto sut = iox::posix::SharedMemoryObjectBuilder()
+                   .name("shmNuma")
+                   .memorySizeInBytes(4096U)
+                   .accessMode(iox::posix::AccessMode::READ_WRITE)
+                   .openMode(iox::posix::OpenMode::OPEN_EXISTING)
+                   .pageOptions(pageOptions)
+                   .create();
+
+    EXPECT_FALSE(sut.has_error());
+}
+#endif
 
 } // namespace
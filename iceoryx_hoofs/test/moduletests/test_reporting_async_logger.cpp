@@ -0,0 +1,225 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/log/async_logger.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using iox::log::AsyncLogger;
+using iox::log::LogLevel;
+
+constexpr const char* FILE_NAME{"hypnotoad.cpp"};
+
+class AsyncLoggerSUT : public AsyncLogger
+{
+  public:
+    ~AsyncLoggerSUT() noexcept override
+    {
+        stop();
+    }
+
+    using AsyncLogger::stop;
+
+    void log(const int line, const LogLevel logLevel, const char* message) noexcept
+    {
+        createLogMessageHeader(FILE_NAME, line, "function", logLevel);
+        logString(message);
+        flush();
+    }
+
+    std::vector<std::string> writtenLogMessages() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_logMessages;
+    }
+
+    std::vector<std::thread::id> writingThreads() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_writingThreads;
+    }
+
+  private:
+    void writeLogMessage() noexcept override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_logMessages.emplace_back(getLogBuffer().buffer);
+        m_writingThreads.emplace_back(std::this_thread::get_id());
+        assumeFlushed();
+    }
+
+    std::mutex m_mutex;
+    std::vector<std::string> m_logMessages;
+    std::vector<std::thread::id> m_writingThreads;
+};
+
+class AsyncLogger_test : public Test
+{
+  public:
+    static uint64_t numberOfDroppedMessages(const std::vector<std::string>& logMessages)
+    {
+        uint64_t numberOfDroppedMessages{0U};
+        for (const auto& logMessage : logMessages)
+        {
+            const auto position = logMessage.find("Dropped ");
+            if (position != std::string::npos)
+            {
+                numberOfDroppedMessages += std::stoull(logMessage.substr(position + std::strlen("Dropped ")));
+            }
+        }
+        return numberOfDroppedMessages;
+    }
+
+    AsyncLoggerSUT sut;
+};
+
+TEST_F(AsyncLogger_test, LogMessageIsWrittenWithHeaderByBackgroundThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58851f9f-adf8-426d-8f05-7889a813a895");
+    sut.log(1, LogLevel::WARN, "All glory to the hypnotoad!");
+    sut.stop();
+
+    const auto logMessages = sut.writtenLogMessages();
+    ASSERT_THAT(logMessages.size(), Eq(1U));
+    EXPECT_THAT(logMessages[0], HasSubstr("[Warn ]"));
+    EXPECT_THAT(logMessages[0], EndsWith("All glory to the hypnotoad!"));
+    EXPECT_THAT(sut.writingThreads()[0], Ne(std::this_thread::get_id()));
+}
+
+TEST_F(AsyncLogger_test, LogMessagesAreWrittenWhileTheLoggerIsRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e752a987-f077-4db2-961a-5d16c1a42078");
+    sut.log(1, LogLevel::INFO, "Hypnotoad");
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (sut.writtenLogMessages().empty() && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    const auto logMessages = sut.writtenLogMessages();
+    ASSERT_THAT(logMessages.size(), Eq(1U));
+    EXPECT_THAT(logMessages[0], EndsWith("Hypnotoad"));
+}
+
+TEST_F(AsyncLogger_test, LogMessageLongerThanMaxMessageSizeIsTruncated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "854fb632-fa50-4006-ab91-624199c99647");
+    const std::string longMessage(AsyncLogger::MAX_MESSAGE_SIZE + 10U, 'x');
+    sut.log(1, LogLevel::INFO, longMessage.c_str());
+    sut.stop();
+
+    const auto logMessages = sut.writtenLogMessages();
+    ASSERT_THAT(logMessages.size(), Eq(1U));
+    EXPECT_THAT(logMessages[0], EndsWith(std::string(AsyncLogger::MAX_MESSAGE_SIZE, 'x')));
+    EXPECT_THAT(logMessages[0], Not(EndsWith(std::string(AsyncLogger::MAX_MESSAGE_SIZE + 1U, 'x'))));
+}
+
+TEST_F(AsyncLogger_test, LogMessagesOfCallSiteExceedingTheRateLimitAreDroppedAndReported)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "321c34a8-49dd-4084-ad0a-a75a734afaba");
+    constexpr uint64_t NUMBER_OF_EXCESS_MESSAGES{5U};
+    for (uint64_t i = 0U; i < AsyncLogger::MAX_MESSAGES_PER_CALL_SITE_AND_PERIOD + NUMBER_OF_EXCESS_MESSAGES; ++i)
+    {
+        sut.log(42, LogLevel::WARN, "No more space left");
+    }
+    sut.log(43, LogLevel::INFO, "Other call site");
+    sut.stop();
+
+    // the test is much shorter than the rate limit period, therefore all log messages are within the same period
+    const auto logMessages = sut.writtenLogMessages();
+    uint64_t numberOfDropReports{0U};
+    for (const auto& logMessage : logMessages)
+    {
+        if (logMessage.find("Dropped ") != std::string::npos)
+        {
+            EXPECT_THAT(logMessage, HasSubstr("log messages at hypnotoad.cpp:42"));
+            ++numberOfDropReports;
+        }
+    }
+    EXPECT_THAT(logMessages.size() - numberOfDropReports, Eq(AsyncLogger::MAX_MESSAGES_PER_CALL_SITE_AND_PERIOD + 1U));
+    EXPECT_THAT(numberOfDroppedMessages(logMessages), Eq(NUMBER_OF_EXCESS_MESSAGES));
+}
+
+TEST_F(AsyncLogger_test, EveryLogMessageOfConcurrentThreadsIsEitherWrittenOrReportedAsDropped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "58932073-da1a-4db2-93de-8204bdf6891c");
+    constexpr uint32_t NUMBER_OF_THREADS{4U};
+    constexpr uint32_t NUMBER_OF_MESSAGES_PER_THREAD{200U};
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (uint32_t i = 0U; i < NUMBER_OF_MESSAGES_PER_THREAD; ++i)
+            {
+                // distinct call sites to not hit the rate limit
+                sut.log(static_cast<int>(t * NUMBER_OF_MESSAGES_PER_THREAD + i), LogLevel::INFO, "Hypnotoad");
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    sut.stop();
+
+    const auto logMessages = sut.writtenLogMessages();
+    uint64_t numberOfWrittenMessages{0U};
+    for (const auto& logMessage : logMessages)
+    {
+        if (logMessage.find("Hypnotoad") != std::string::npos)
+        {
+            ++numberOfWrittenMessages;
+        }
+    }
+    EXPECT_THAT(numberOfWrittenMessages + numberOfDroppedMessages(logMessages),
+                Eq(NUMBER_OF_THREADS * NUMBER_OF_MESSAGES_PER_THREAD));
+}
+
+TEST_F(AsyncLogger_test, RingBuffersOfExitedThreadsAreReused)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "efd30020-0447-45d0-8280-b92010ac8d7a");
+    constexpr uint32_t NUMBER_OF_THREADS{AsyncLogger::MAX_NUMBER_OF_THREADS * 2U};
+    for (uint32_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        std::thread([&, t] { sut.log(static_cast<int>(t), LogLevel::INFO, "Hypnotoad"); }).join();
+
+        // a ring buffer is reused only after the background thread wrote its log messages
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (sut.writtenLogMessages().size() <= t && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    sut.stop();
+
+    const auto logMessages = sut.writtenLogMessages();
+    EXPECT_THAT(logMessages.size(), Eq(NUMBER_OF_THREADS));
+    EXPECT_THAT(numberOfDroppedMessages(logMessages), Eq(0U));
+}
+
+} // namespace
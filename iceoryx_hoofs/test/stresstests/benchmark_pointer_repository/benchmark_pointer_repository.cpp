@@ -0,0 +1,117 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/pointer_repository.hpp"
+#include "iox/vector.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using Repository_t = iox::PointerRepository<uint64_t, void*>;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000U};
+constexpr uint64_t MAX_NUMBER_OF_SEGMENTS{1000U};
+constexpr uint64_t SEGMENT_SIZE{4096U};
+/// @brief a prime to hit the segments in a scattered order
+constexpr uint64_t SEGMENT_STRIDE{7919U};
+
+struct Segment
+{
+    uint8_t* basePtr{nullptr};
+    uint8_t* endPtr{nullptr};
+};
+
+/// @brief Measures the average duration of a search
+/// @param[in] searchCall performs the search for a given iteration and returns the found id
+template <typename SearchCall>
+void measure(const char* name, SearchCall searchCall)
+{
+    uint64_t checksum{0U};
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        checksum += searchCall(i);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::setw(30) << name << std::setw(12)
+              << static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())
+                     / static_cast<double>(NUMBER_OF_ITERATIONS)
+              << std::setw(16) << checksum << std::endl;
+}
+
+void benchmark(const uint64_t numberOfSegments)
+{
+    std::vector<uint8_t> memory(numberOfSegments * SEGMENT_SIZE);
+    // the repository is too large for the stack
+    std::unique_ptr<Repository_t> repository{new Repository_t()};
+    // the linear scan uses the same container as the repository did before the index was introduced
+    std::unique_ptr<iox::vector<Segment, MAX_NUMBER_OF_SEGMENTS + 1U>> segments{
+        new iox::vector<Segment, MAX_NUMBER_OF_SEGMENTS + 1U>(numberOfSegments + 1U)};
+
+    // the ids are registered in the reverse order of the addresses of the segments
+    for (uint64_t i = 0U; i < numberOfSegments; ++i)
+    {
+        const uint64_t id{numberOfSegments - i};
+        auto* basePtr = &memory[i * SEGMENT_SIZE];
+        repository->registerPtrWithId(id, basePtr, SEGMENT_SIZE);
+        (*segments)[id] = Segment{basePtr, basePtr + SEGMENT_SIZE - 1U};
+    }
+
+    auto pointerOf = [&](const uint64_t i) -> void* {
+        return &memory[((i * SEGMENT_STRIDE) % numberOfSegments) * SEGMENT_SIZE + (i % SEGMENT_SIZE)];
+    };
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "Average search duration with " << numberOfSegments << " registered segments" << std::endl;
+    std::cout << std::setw(30) << "search" << std::setw(12) << "ns" << std::setw(16) << "checksum" << std::endl;
+
+    measure("searchId", [&](const uint64_t i) { return repository->searchId(pointerOf(i)); });
+
+    uint64_t unregisteredValue{0U};
+    measure("searchId unregistered", [&](const uint64_t) { return repository->searchId(&unregisteredValue); });
+
+    measure("linear scan", [&](const uint64_t i) {
+        const auto* ptr = static_cast<uint8_t*>(pointerOf(i));
+        for (uint64_t id = 1U; id <= numberOfSegments; ++id)
+        {
+            if ((ptr >= (*segments)[id].basePtr) && (ptr <= (*segments)[id].endPtr))
+            {
+                return id;
+            }
+        }
+        return static_cast<uint64_t>(Repository_t::RAW_POINTER_BEHAVIOUR_ID);
+    });
+
+    std::cout << std::endl;
+}
+} // namespace
+
+int main()
+{
+    for (const uint64_t numberOfSegments : {uint64_t{1U}, uint64_t{16U}, MAX_NUMBER_OF_SEGMENTS})
+    {
+        benchmark(numberOfSegments);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -28,6 +28,7 @@ option(COVERAGE "Build iceoryx with gcov flags" OFF)
 option(DOWNLOAD_TOML_LIB "Download cpptoml via the CMake ExternalProject module" ON)
 option(EXAMPLES "Build all iceoryx examples" OFF)
 option(INTROSPECTION "Builds the introspection client which requires the ncurses library with an activated terminfo feature" OFF)
+option(LATENCY_INSTRUMENTATION "Records latency histograms of the publish/take path which are exposed by the port introspection" OFF)
 option(ONE_TO_MANY_ONLY "Restricts communication to 1:n pattern" OFF)
 set(IOX_PLATFORM_PATH "" CACHE PATH "Overrides integrated platform detection and uses provided custom path")
 option(ROUDI_ENVIRONMENT "Build RouDi Environment for testing, is enabled when building tests" OFF)
@@ -84,6 +85,7 @@ function(show_config_options)
   message("          DOWNLOAD_TOML_LIB....................: " ${DOWNLOAD_TOML_LIB})
   message("          EXAMPLES.............................: " ${EXAMPLES})
   message("          INTROSPECTION........................: " ${INTROSPECTION})
+  message("          LATENCY_INSTRUMENTATION..............: " ${LATENCY_INSTRUMENTATION})
   message("          ONE_TO_MANY_ONLY ....................: " ${ONE_TO_MANY_ONLY})
   message("          IOX_PLATFORM_PATH....................: " ${IOX_PLATFORM_PATH})
   message("          ROUDI_ENVIRONMENT....................: " ${ROUDI_ENVIRONMENT} ${ROUDI_ENV_HINT})
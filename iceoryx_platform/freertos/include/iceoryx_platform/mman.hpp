@@ -36,4 +36,10 @@ int iox_shm_close(int fd);
 void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset);
 int munmap(void* addr, size_t length);
 
+#define IOX_MAP_POPULATE 0
+
+int iox_madvise_huge_pages(void* addr, size_t length);
+int iox_mlock(const void* addr, size_t length);
+int iox_mbind_to_numa_node(void* addr, size_t length, unsigned int node);
+
 #endif // IOX_HOOFS_FREERTOS_PLATFORM_MMAN_HPP
@@ -86,3 +86,21 @@ int munmap(void*, size_t)
 {
     return 0;
 }
+
+int iox_madvise_huge_pages(void*, size_t)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+
+int iox_mbind_to_numa_node(void*, size_t, unsigned int)
+{
+    errno = ENOTSUP;
+    return -1;
+}
@@ -23,4 +23,10 @@ int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+#define IOX_MAP_POPULATE MAP_POPULATE
+
+int iox_madvise_huge_pages(void* addr, size_t length);
+int iox_mlock(const void* addr, size_t length);
+int iox_mbind_to_numa_node(void* addr, size_t length, unsigned int node);
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
@@ -16,6 +16,9 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <errno.h>
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -34,3 +37,33 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_madvise_huge_pages(void* addr, size_t length)
+{
+    return madvise(addr, length, MADV_HUGEPAGE);
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_mbind_to_numa_node(void* addr, size_t length, unsigned int node)
+{
+    // the largest number of NUMA nodes the kernel supports; the syscall is used directly to not depend on libnuma
+    constexpr unsigned long MAX_NUMBER_OF_NODES{1024U};
+    constexpr unsigned long BITS_PER_MASK_ENTRY{sizeof(unsigned long) * 8U};
+    if (node >= MAX_NUMBER_OF_NODES)
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays,cppcoreguidelines-avoid-c-arrays) required by the syscall
+    unsigned long nodeMask[MAX_NUMBER_OF_NODES / BITS_PER_MASK_ENTRY] = {};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index) node is smaller than MAX_NUMBER_OF_NODES
+    nodeMask[node / BITS_PER_MASK_ENTRY] = 1UL << (node % BITS_PER_MASK_ENTRY);
+    // the kernel evaluates maxnode - 1 bits of the mask
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg) syscall interface
+    return static_cast<int>(syscall(SYS_mbind, addr, length, MPOL_BIND, &nodeMask[0], MAX_NUMBER_OF_NODES + 1U, 0U));
+}
@@ -16,6 +16,7 @@
 
 #include "iceoryx_platform/mman.hpp"
 
+#include <errno.h>
 #include <unistd.h>
 
 int iox_shm_open(const char* name, int oflag, mode_t mode)
@@ -32,3 +33,20 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_madvise_huge_pages(void*, size_t)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_mbind_to_numa_node(void*, size_t, unsigned int)
+{
+    errno = ENOTSUP;
+    return -1;
+}
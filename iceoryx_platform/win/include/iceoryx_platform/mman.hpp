@@ -51,4 +51,11 @@ int iox_shm_close(int fd);
 void internal_iox_shm_set_size(int fd, off_t length);
 
 off_t internal_iox_shm_get_size(int fd);
+
+#define IOX_MAP_POPULATE 0
+
+int iox_madvise_huge_pages(void* addr, size_t length);
+int iox_mlock(const void* addr, size_t length);
+int iox_mbind_to_numa_node(void* addr, size_t length, unsigned int node);
+
 #endif // IOX_HOOFS_WIN_PLATFORM_MMAN_HPP
@@ -19,6 +19,7 @@
 #include "iceoryx_platform/platform_settings.hpp"
 #include "iceoryx_platform/win32_errorHandling.hpp"
 
+#include <errno.h>
 #include <iostream>
 #include <map>
 #include <mutex>
@@ -255,3 +256,21 @@ off_t internal_iox_shm_get_size(int fd)
     fclose(shm_state);
     return shm_size;
 }
+
+int iox_madvise_huge_pages(void*, size_t)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+
+int iox_mlock(const void*, size_t)
+{
+    errno = ENOTSUP;
+    return -1;
+}
+
+int iox_mbind_to_numa_node(void*, size_t, unsigned int)
+{
+    errno = ENOTSUP;
+    return -1;
+}
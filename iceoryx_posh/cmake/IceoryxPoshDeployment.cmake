@@ -39,6 +39,13 @@ if(NOT IOX_COMMUNICATION_POLICY)
     set(IOX_COMMUNICATION_POLICY ManyToManyPolicy)
 endif()
 
+if(LATENCY_INSTRUMENTATION)
+    message(STATUS "[i] Recording latency histograms of the publish/take path!")
+    set(IOX_LATENCY_INSTRUMENTATION true)
+else()
+    set(IOX_LATENCY_INSTRUMENTATION false)
+endif()
+
 # Refer to iceoryx_hoofs/include/iceoryx_hoofs/internal/posix_wrapper/ipc_channel.hpp
 # for info why this is needed.
 if(APPLE)
@@ -24,15 +24,20 @@
 #include "iceoryx_posh/gateway/gateway_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_config.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
 #include "iox/duration.hpp"
 #include "iox/expected.hpp"
+#include "iox/fixed_position_container.hpp"
 #include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
 #include "iox/string.hpp"
-#include "iox/vector.hpp"
+#include "iox/type_traits.hpp"
 
 #include <atomic>
+#include <mutex>
 #include <thread>
+#include <type_traits>
 
 namespace iox
 {
@@ -47,6 +52,19 @@ enum class GatewayError : uint8_t
     NONEXISTANT_CHANNEL
 };
 
+/// @brief Evaluates to true when the iceoryx terminal of the channel is a subscriber whose DATA_RECEIVED event can
+/// be attached to a Listener, i.e. when it provides a hasData method
+template <typename IceoryxTerminal, typename = void>
+struct HasEventDrivenIceoryxTerminal : std::false_type
+{
+};
+
+template <typename IceoryxTerminal>
+struct HasEventDrivenIceoryxTerminal<IceoryxTerminal, void_t<decltype(std::declval<IceoryxTerminal&>().hasData())>>
+    : std::true_type
+{
+};
+
 ///
 /// @brief A reference generic gateway implementation.
 /// @details This class can be extended to quickly implement any type of gateway, only custom initialization,
@@ -54,11 +72,32 @@ enum class GatewayError : uint8_t
 ///
 /// When run, the gateway will automatically call the respective methods when required.
 ///
+/// Channels whose iceoryx terminal is a subscriber are attached to a Listener and forwarded by its thread as soon as
+/// the subscriber receives data. The channels are distributed over up to numberOfForwardingThreads Listeners. All
+/// other channels, e.g. the ones with a publisher as iceoryx terminal which forward data from the external system, are
+/// polled every forwardingPeriod.
+///
 template <typename channel_t, typename gateway_t = GatewayBase>
 class GatewayGeneric : public gateway_t
 {
-    using ChannelVector = vector<channel_t, MAX_CHANNEL_NUMBER>;
-    using ConcurrentChannelVector = concurrent::smart_lock<ChannelVector>;
+    using IceoryxTerminal_t = typename decltype(std::declval<channel_t>().getIceoryxTerminal())::element_type;
+    static constexpr bool IS_EVENT_DRIVEN{HasEventDrivenIceoryxTerminal<IceoryxTerminal_t>::value};
+
+    /// @brief The stored channel; its address is stable and used as context data of the DATA_RECEIVED event
+    struct ChannelEntry
+    {
+        ChannelEntry(GatewayGeneric& gateway, const channel_t& channel) noexcept;
+
+        GatewayGeneric* m_gateway{nullptr};
+        channel_t m_channel;
+        /// index of the Listener the channel is attached to; the channel is polled when no index is set
+        optional<uint32_t> m_forwardingThreadIndex;
+        /// serializes the forwarding of the channel by its Listener and by the thread which attached it
+        std::mutex m_forwardingMutex;
+    };
+
+    using ChannelContainer = FixedPositionContainer<ChannelEntry, MAX_CHANNEL_NUMBER>;
+    using ConcurrentChannelContainer = concurrent::smart_lock<ChannelContainer>;
 
   public:
     virtual ~GatewayGeneric() noexcept;
@@ -89,10 +128,20 @@ class GatewayGeneric : public gateway_t
 
     uint64_t getNumberOfChannels() const noexcept;
 
+    static constexpr uint32_t MAX_NUMBER_OF_FORWARDING_THREADS{8U};
+
   protected:
+    ///
+    /// @param interface The interface of the gateway.
+    /// @param discoveryPeriod The period in which the discovery messages are processed.
+    /// @param forwardingPeriod The period in which the channels which are not event-driven are polled.
+    /// @param numberOfForwardingThreads The maximum number of threads which forward the event-driven channels,
+    /// limited to MAX_NUMBER_OF_FORWARDING_THREADS. A channel is always forwarded by the same thread.
+    ///
     GatewayGeneric(capro::Interfaces interface,
                    units::Duration discoveryPeriod = 1000_ms,
-                   units::Duration forwardingPeriod = 50_ms) noexcept;
+                   units::Duration forwardingPeriod = 50_ms,
+                   uint32_t numberOfForwardingThreads = 1U) noexcept;
 
     ///
     /// @brief addChannel Creates a channel for the given service and stores a copy of it in an internal collection for
@@ -138,18 +187,36 @@ class GatewayGeneric : public gateway_t
     expected<void, GatewayError> discardChannel(const capro::ServiceDescription& service) noexcept;
 
   private:
-    ConcurrentChannelVector m_channels;
+    ConcurrentChannelContainer m_channels;
 
     std::atomic_bool m_isRunning{false};
 
     units::Duration m_discoveryPeriod;
     units::Duration m_forwardingPeriod;
+    uint32_t m_numberOfForwardingThreads{1U};
 
     std::thread m_discoveryThread;
     std::thread m_forwardingThread;
 
+    /// @brief the Listeners are created when the first channel is attached since they require a runtime
+    optional<popo::Listener> m_listeners[MAX_NUMBER_OF_FORWARDING_THREADS];
+
     void forwardingLoop() noexcept;
     void discoveryLoop() noexcept;
+
+    template <bool IsEventDriven = IS_EVENT_DRIVEN>
+    std::enable_if_t<IsEventDriven> attachToForwardingThread(ChannelEntry& entry) noexcept;
+    template <bool IsEventDriven = IS_EVENT_DRIVEN>
+    std::enable_if_t<!IsEventDriven> attachToForwardingThread(ChannelEntry& entry) noexcept;
+    template <bool IsEventDriven = IS_EVENT_DRIVEN>
+    std::enable_if_t<IsEventDriven> detachFromForwardingThread(ChannelEntry& entry) noexcept;
+    template <bool IsEventDriven = IS_EVENT_DRIVEN>
+    std::enable_if_t<!IsEventDriven> detachFromForwardingThread(ChannelEntry& entry) noexcept;
+    template <bool IsEventDriven = IS_EVENT_DRIVEN>
+    std::enable_if_t<IsEventDriven> forwardRemainingData(ChannelEntry& entry) noexcept;
+    template <bool IsEventDriven = IS_EVENT_DRIVEN>
+    std::enable_if_t<!IsEventDriven> forwardRemainingData(ChannelEntry& entry) noexcept;
+    static void forwardReceivedData(IceoryxTerminal_t* const terminal, ChannelEntry* const entry) noexcept;
 };
 
 } // namespace gw
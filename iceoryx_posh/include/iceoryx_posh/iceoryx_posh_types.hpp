@@ -72,7 +72,9 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+// 1x publisherPort service registry snapshots
+// 1x publisherPort service registry changes
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -126,6 +128,8 @@ constexpr uint32_t ROUDI_MAX_MESSAGES = 5U;
 constexpr uint32_t ROUDI_MESSAGE_SIZE = 512U;
 constexpr uint32_t APP_MAX_MESSAGES = 5U;
 constexpr uint32_t APP_MESSAGE_SIZE = 512U;
+// maximum number of ports which can be requested at once with PoshRuntime::getMiddlewarePorts
+constexpr uint32_t MAX_NUMBER_OF_PORTS_PER_REQUEST = 64U;
 
 
 // Processes
@@ -138,6 +142,7 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_CHANGES_EVENT_NAME[] = "ServiceRegistryChanges";
 
 // Nodes
 constexpr uint32_t MAX_NODE_NUMBER = build::IOX_MAX_NODE_NUMBER;
@@ -230,6 +235,11 @@ constexpr units::Duration PROCESS_DEFAULT_TERMINATION_DELAY = 0_s;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+constexpr units::Duration PROCESS_MONITORING_INTERVAL = 100_ms;
+
+// Runtime message handling; the messages of one runtime are always handled by the same worker thread
+constexpr uint32_t DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS{1U};
+constexpr uint32_t MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS{16U};
 
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
@@ -255,7 +265,7 @@ namespace runtime
 {
 using namespace units::duration_literals;
 constexpr units::Duration PROCESS_WAITING_FOR_ROUDI_TIMEOUT = 60_s;
-constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL = 3 * roudi::DISCOVERY_INTERVAL;  // > DISCOVERY_INTERVAL
+constexpr units::Duration PROCESS_KEEP_ALIVE_INTERVAL = 3 * roudi::PROCESS_MONITORING_INTERVAL;
 constexpr units::Duration PROCESS_KEEP_ALIVE_TIMEOUT = 5 * PROCESS_KEEP_ALIVE_INTERVAL; // > PROCESS_KEEP_ALIVE_INTERVAL
 } // namespace runtime
 
@@ -20,6 +20,8 @@
 #define IOX_POSH_GW_GATEWAY_GENERIC_INL
 
 #include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/logging.hpp"
 
 // ================================================== Public ================================================== //
 
@@ -27,6 +29,9 @@ namespace iox
 {
 namespace gw
 {
+template <typename channel_t, typename gateway_t>
+constexpr uint32_t GatewayGeneric<channel_t, gateway_t>::MAX_NUMBER_OF_FORWARDING_THREADS;
+
 template <typename channel_t, typename gateway_t>
 inline GatewayGeneric<channel_t, gateway_t>::~GatewayGeneric() noexcept
 {
@@ -36,7 +41,14 @@ inline GatewayGeneric<channel_t, gateway_t>::~GatewayGeneric() noexcept
 template <typename channel_t, typename gateway_t>
 inline void GatewayGeneric<channel_t, gateway_t>::runMultithreaded() noexcept
 {
-    m_isRunning.store(true);
+    {
+        auto guardedChannels = m_channels.getScopeGuard();
+        m_isRunning.store(true);
+        for (auto& entry : *guardedChannels)
+        {
+            attachToForwardingThread(entry);
+        }
+    }
     m_discoveryThread = std::thread([this] { this->discoveryLoop(); });
     m_forwardingThread = std::thread([this] { this->forwardingLoop(); });
 }
@@ -44,7 +56,18 @@ inline void GatewayGeneric<channel_t, gateway_t>::runMultithreaded() noexcept
 template <typename channel_t, typename gateway_t>
 inline void GatewayGeneric<channel_t, gateway_t>::shutdown() noexcept
 {
-    m_isRunning.store(false);
+    {
+        auto guardedChannels = m_channels.getScopeGuard();
+        m_isRunning.store(false);
+        for (auto& entry : *guardedChannels)
+        {
+            detachFromForwardingThread(entry);
+        }
+    }
+    for (auto& listener : m_listeners)
+    {
+        listener.reset();
+    }
     if (m_discoveryThread.joinable())
     {
         m_discoveryThread.join();
@@ -66,10 +89,13 @@ inline uint64_t GatewayGeneric<channel_t, gateway_t>::getNumberOfChannels() cons
 template <typename channel_t, typename gateway_t>
 inline GatewayGeneric<channel_t, gateway_t>::GatewayGeneric(capro::Interfaces interface,
                                                             units::Duration discoveryPeriod,
-                                                            units::Duration forwardingPeriod) noexcept
+                                                            units::Duration forwardingPeriod,
+                                                            uint32_t numberOfForwardingThreads) noexcept
     : gateway_t(interface)
     , m_discoveryPeriod(discoveryPeriod)
     , m_forwardingPeriod(forwardingPeriod)
+    , m_numberOfForwardingThreads(
+          algorithm::minVal(algorithm::maxVal(numberOfForwardingThreads, 1U), MAX_NUMBER_OF_FORWARDING_THREADS))
 {
 }
 
@@ -108,7 +134,16 @@ GatewayGeneric<channel_t, gateway_t>::addChannel(const capro::ServiceDescription
         else
         {
             auto channel = result.value();
-            m_channels->push_back(channel);
+            auto guardedChannels = m_channels.getScopeGuard();
+            auto entry = guardedChannels->emplace(*this, channel);
+            if (entry == guardedChannels->end())
+            {
+                return err(GatewayError::UNSUCCESSFUL_CHANNEL_CREATION);
+            }
+            if (m_isRunning.load())
+            {
+                attachToForwardingThread(*entry);
+            }
             return ok(channel);
         }
     }
@@ -118,27 +153,24 @@ template <typename channel_t, typename gateway_t>
 inline optional<channel_t>
 GatewayGeneric<channel_t, gateway_t>::findChannel(const iox::capro::ServiceDescription& service) const noexcept
 {
-    auto guardedVector = this->m_channels.getScopeGuard();
-    auto channel = std::find_if(guardedVector->begin(), guardedVector->end(), [&service](const channel_t& channel) {
-        return channel.getServiceDescription() == service;
-    });
-    if (channel == guardedVector->end())
-    {
-        return nullopt_t();
-    }
-    else
+    auto guardedChannels = this->m_channels.getScopeGuard();
+    for (const auto& entry : *guardedChannels)
     {
-        return make_optional<channel_t>(*channel);
+        if (entry.m_channel.getServiceDescription() == service)
+        {
+            return make_optional<channel_t>(entry.m_channel);
+        }
     }
+    return nullopt_t();
 }
 
 template <typename channel_t, typename gateway_t>
 inline void GatewayGeneric<channel_t, gateway_t>::forEachChannel(const function_ref<void(channel_t&)> f) const noexcept
 {
-    auto guardedVector = m_channels.getScopeGuard();
-    for (auto channel = guardedVector->begin(); channel != guardedVector->end(); ++channel)
+    auto guardedChannels = m_channels.getScopeGuard();
+    for (auto& entry : *guardedChannels)
     {
-        f(*channel);
+        f(entry.m_channel);
     }
 }
 
@@ -146,19 +178,18 @@ template <typename channel_t, typename gateway_t>
 inline expected<void, GatewayError>
 GatewayGeneric<channel_t, gateway_t>::discardChannel(const capro::ServiceDescription& service) noexcept
 {
-    auto guardedVector = this->m_channels.getScopeGuard();
-    auto channel = std::find_if(guardedVector->begin(), guardedVector->end(), [&service](const channel_t& channel) {
-        return channel.getServiceDescription() == service;
-    });
-    if (channel != guardedVector->end())
-    {
-        guardedVector->erase(channel);
-        return ok();
-    }
-    else
+    auto guardedChannels = this->m_channels.getScopeGuard();
+    for (auto entry = guardedChannels->begin(); entry != guardedChannels->end(); ++entry)
     {
-        return err(GatewayError::NONEXISTANT_CHANNEL);
+        if (entry->m_channel.getServiceDescription() == service)
+        {
+            // the channel must no longer be forwarded by a Listener when its entry is erased
+            detachFromForwardingThread(*entry);
+            guardedChannels->erase(entry);
+            return ok();
+        }
     }
+    return err(GatewayError::NONEXISTANT_CHANNEL);
 }
 
 // ================================================== Private ================================================== //
@@ -184,11 +215,145 @@ inline void GatewayGeneric<channel_t, gateway_t>::forwardingLoop() noexcept
     while (m_isRunning.load(std::memory_order_relaxed))
     {
         auto startTime = std::chrono::steady_clock::now();
-        forEachChannel([this](channel_t channel) { this->forward(channel); });
+        {
+            auto guardedChannels = m_channels.getScopeGuard();
+            for (auto& entry : *guardedChannels)
+            {
+                // event-driven channels are forwarded by the Listener they are attached to
+                if (!entry.m_forwardingThreadIndex.has_value())
+                {
+                    this->forward(entry.m_channel);
+                }
+                else
+                {
+                    forwardRemainingData(entry);
+                }
+            }
+        }
         std::this_thread::sleep_until(startTime + std::chrono::milliseconds(m_forwardingPeriod.toMilliseconds()));
     };
 }
 
+template <typename channel_t, typename gateway_t>
+template <bool IsEventDriven>
+inline std::enable_if_t<IsEventDriven>
+GatewayGeneric<channel_t, gateway_t>::attachToForwardingThread(ChannelEntry& entry) noexcept
+{
+    if (entry.m_forwardingThreadIndex.has_value())
+    {
+        return;
+    }
+
+    // a new Listener is created until the configured number of forwarding threads is reached, afterwards the channel
+    // is attached to the Listener with the least channels
+    uint32_t index{0U};
+    for (uint32_t i = 0U; i < m_numberOfForwardingThreads; ++i)
+    {
+        if (!m_listeners[i].has_value())
+        {
+            m_listeners[i].emplace();
+            index = i;
+            break;
+        }
+        if (m_listeners[i]->size() < m_listeners[index]->size())
+        {
+            index = i;
+        }
+    }
+
+    auto terminal = entry.m_channel.getIceoryxTerminal();
+    auto result = m_listeners[index]->attachEvent(*terminal,
+                                                  popo::SubscriberEvent::DATA_RECEIVED,
+                                                  popo::createNotificationCallback(forwardReceivedData, entry));
+    if (result.has_error())
+    {
+        IOX_LOG(WARN,
+                "Unable to attach the channel for the service '"
+                    << entry.m_channel.getServiceDescription()
+                    << "' to a forwarding thread. The channel is polled instead. Error: "
+                    << static_cast<uint64_t>(result.error()));
+        return;
+    }
+    entry.m_forwardingThreadIndex.emplace(index);
+
+    // samples which were received before the channel was attached do not trigger the Listener
+    forwardReceivedData(terminal.get(), &entry);
+}
+
+template <typename channel_t, typename gateway_t>
+template <bool IsEventDriven>
+inline std::enable_if_t<!IsEventDriven>
+GatewayGeneric<channel_t, gateway_t>::attachToForwardingThread(ChannelEntry&) noexcept
+{
+    // channels whose iceoryx terminal is not a subscriber are polled
+}
+
+template <typename channel_t, typename gateway_t>
+template <bool IsEventDriven>
+inline std::enable_if_t<IsEventDriven>
+GatewayGeneric<channel_t, gateway_t>::detachFromForwardingThread(ChannelEntry& entry) noexcept
+{
+    if (entry.m_forwardingThreadIndex.has_value())
+    {
+        // returns only after a concurrently running callback of the channel has finished
+        m_listeners[entry.m_forwardingThreadIndex.value()]->detachEvent(*entry.m_channel.getIceoryxTerminal(),
+                                                                        popo::SubscriberEvent::DATA_RECEIVED);
+        entry.m_forwardingThreadIndex.reset();
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+template <bool IsEventDriven>
+inline std::enable_if_t<!IsEventDriven>
+GatewayGeneric<channel_t, gateway_t>::detachFromForwardingThread(ChannelEntry&) noexcept
+{
+}
+
+template <typename channel_t, typename gateway_t>
+template <bool IsEventDriven>
+inline std::enable_if_t<IsEventDriven>
+GatewayGeneric<channel_t, gateway_t>::forwardRemainingData(ChannelEntry& entry) noexcept
+{
+    // a forward which made no progress leaves data in the subscriber, for which the Listener is not notified again
+    // until the next sample arrives; the data is therefore retried every forwarding period, unless the Listener
+    // is forwarding the channel right now
+    std::unique_lock<std::mutex> lock(entry.m_forwardingMutex, std::try_to_lock);
+    if (lock.owns_lock() && entry.m_channel.getIceoryxTerminal()->hasData())
+    {
+        this->forward(entry.m_channel);
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+template <bool IsEventDriven>
+inline std::enable_if_t<!IsEventDriven>
+GatewayGeneric<channel_t, gateway_t>::forwardRemainingData(ChannelEntry&) noexcept
+{
+}
+
+template <typename channel_t, typename gateway_t>
+inline void GatewayGeneric<channel_t, gateway_t>::forwardReceivedData(IceoryxTerminal_t* const terminal,
+                                                                      ChannelEntry* const entry) noexcept
+{
+    // the Listener notifies only once for all samples received since the last notification, therefore the
+    // channel is forwarded until the subscriber has no more data; the number of forwards is bounded by the queue
+    // capacity since a forward which does not take a sample would otherwise hold the mutex forever; samples which
+    // arrive in the meantime notify the Listener again and data which is left behind is retried by the forwardingLoop
+    std::lock_guard<std::mutex> lock(entry->m_forwardingMutex);
+    for (uint64_t i = 0U; i < MAX_SUBSCRIBER_QUEUE_CAPACITY && terminal->hasData(); ++i)
+    {
+        entry->m_gateway->forward(entry->m_channel);
+    }
+}
+
+template <typename channel_t, typename gateway_t>
+inline GatewayGeneric<channel_t, gateway_t>::ChannelEntry::ChannelEntry(GatewayGeneric& gateway,
+                                                                        const channel_t& channel) noexcept
+    : m_gateway(&gateway)
+    , m_channel(channel)
+{
+}
+
 } // namespace gw
 } // namespace iox
 
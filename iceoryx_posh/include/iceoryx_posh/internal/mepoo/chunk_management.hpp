@@ -17,11 +17,13 @@
 #ifndef IOX_POSH_MEPOO_CHUNK_MANAGEMENT_HPP
 #define IOX_POSH_MEPOO_CHUNK_MANAGEMENT_HPP
 
+#include "iceoryx_posh/iceoryx_posh_deployment.hpp"
 #include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 
 #include <atomic>
 #include <cstdint>
+#include <type_traits>
 
 namespace iox
 {
@@ -30,7 +32,28 @@ namespace mepoo
 class MemPool;
 struct ChunkHeader;
 
-struct ChunkManagement
+/// @brief The points in time of the stages a chunk passes on its way from the publisher to the subscribers. They are
+///        recorded by the latency instrumentation and are not part of the ChunkHeader in order to keep its layout
+///        independent of the build configuration
+struct ChunkTimestamps
+{
+    /// @brief steady clock time in nanoseconds when the chunk was loaned
+    uint64_t loan{0U};
+    /// @brief steady clock time in nanoseconds when the chunk was published
+    uint64_t publish{0U};
+};
+
+/// @brief Used instead of the ChunkTimestamps when the latency instrumentation is disabled
+struct NoChunkTimestamps
+{
+};
+
+using ChunkTimestamps_t =
+    std::conditional<build::IOX_LATENCY_INSTRUMENTATION, ChunkTimestamps, NoChunkTimestamps>::type;
+
+/// @note the timestamps are a base class in order to not increase the size of the ChunkManagement by the padding of
+///       an empty member when the latency instrumentation is disabled
+struct ChunkManagement : public ChunkTimestamps_t
 {
     using base_t = ChunkHeader;
     using referenceCounterBase_t = uint64_t;
@@ -44,6 +44,23 @@ struct MemPoolInfo
     uint32_t m_chunkSize{0};
 };
 
+class MemPool;
+
+/// @brief A magazine of free chunk indices of a single MemPool. It is refilled from and returned to the free list of
+/// the MemPool in batches, which reduces the contention on the free list when multiple threads acquire chunks
+/// concurrently.
+/// @note A MemPoolCache must only be used by one thread at a time. It is placed in the shared memory of the owning port
+/// so that RouDi is able to return the cached chunks to the MemPool when the owning process terminates.
+struct MemPoolCache
+{
+    static constexpr uint32_t CAPACITY{16U};
+
+    RelativePointer<MemPool> m_memPool;
+    uint32_t m_size{0U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) used like the index memory of the LoFFLi
+    concurrent::LoFFLi::Index_t m_indices[CAPACITY]{};
+};
+
 class MemPool
 {
   public:
@@ -61,6 +78,32 @@ class MemPool
     MemPool& operator=(MemPool&&) = delete;
 
     void* getChunk() noexcept;
+
+    /// @brief Like getChunk but without a warning when there are no chunks left, e.g. when the caller can fall back to
+    /// another MemPool
+    /// @return pointer to the chunk or nullptr if there are no chunks left
+    void* tryGetChunk() noexcept;
+
+    /// @brief Acquires a chunk via a MemPoolCache; the cache is refilled from the free list in batches
+    /// @param[in] cache which is used to acquire the chunk; if it contains chunks of another MemPool, they are returned
+    /// to the other MemPool first
+    /// @param[in] maxNumberOfCachedChunks limits the number of chunks which are acquired on a refill of the cache
+    /// @return pointer to the chunk or nullptr if there are no chunks left
+    void* getChunk(MemPoolCache& cache, const uint32_t maxNumberOfCachedChunks = MemPoolCache::CAPACITY) noexcept;
+
+    /// @brief Like getChunk with a MemPoolCache but without a warning when there are no chunks left
+    /// @param[in] cache which is used to acquire the chunk
+    /// @param[in] maxNumberOfCachedChunks limits the number of chunks which are acquired on a refill of the cache
+    /// @return pointer to the chunk or nullptr if there are no chunks left
+    void* tryGetChunk(MemPoolCache& cache, const uint32_t maxNumberOfCachedChunks = MemPoolCache::CAPACITY) noexcept;
+
+    /// @brief Logs a warning that the MemPool has no chunks left
+    void warnAboutNoSpaceLeft() const noexcept;
+
+    /// @brief Returns all chunks of the cache to the free list of the MemPool the cache is currently bound to
+    /// @param[in] cache to release
+    static void releaseCache(MemPoolCache& cache) noexcept;
+
     uint32_t getChunkSize() const noexcept;
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
@@ -71,6 +114,8 @@ class MemPool
 
   private:
     void adjustMinFree() noexcept;
+    void* chunkFromIndex(const uint32_t index) noexcept;
+    void refillCache(MemPoolCache& cache, const uint32_t maxNumberOfCachedChunks) noexcept;
     bool isMultipleOfAlignment(const uint32_t value) const noexcept;
 
     RelativePointer<uint8_t> m_rawMemory;
@@ -80,7 +125,9 @@ class MemPool
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0U};
 
+    /// the chunks in a MemPoolCache are part of m_usedChunks since they are removed from the free list
     std::atomic<uint32_t> m_usedChunks{0U};
+    std::atomic<uint32_t> m_cachedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
 
     freeList_t m_freeIndices;
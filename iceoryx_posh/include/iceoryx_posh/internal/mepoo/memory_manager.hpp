@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
@@ -42,8 +43,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
@@ -56,6 +55,14 @@ class MemoryManager
         MEMPOOL_OUT_OF_CHUNKS,
     };
 
+    /// @brief Caches chunks and chunk management entries for a single user to reduce the contention on the free
+    /// lists of the mempools; see MemPoolCache
+    struct ChunkCache
+    {
+        MemPoolCache m_chunkMemoryCache;
+        MemPoolCache m_chunkManagementCache;
+    };
+
     MemoryManager() noexcept = default;
     MemoryManager(const MemoryManager&) = delete;
     MemoryManager(MemoryManager&&) = delete;
@@ -68,10 +75,24 @@ class MemoryManager
                                 BumpAllocator& chunkMemoryAllocator) noexcept;
 
     /// @brief Obtains a chunk from the mempools
+    /// @note The smallest fitting mempool is selected via a size class index which is generated by
+    ///       'configureMemoryManager'. If this mempool is exhausted, the configured 'MemPoolFallbackPolicy' decides
+    ///       whether the chunk is acquired from a larger mempool
     /// @param[in] chunkSettings for the requested chunk
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains a chunk from the mempools via a ChunkCache
+    /// @param[in] chunkSettings for the requested chunk
+    /// @param[in] chunkCache which is refilled from the smallest fitting mempool in batches; it must not be used
+    /// concurrently and must be released with 'releaseChunkCache' when it is no longer used
+    /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
+    expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings, ChunkCache& chunkCache) noexcept;
+
+    /// @brief Returns all cached chunks to their mempools
+    /// @param[in] chunkCache to release
+    static void releaseChunkCache(ChunkCache& chunkCache) noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -82,6 +103,7 @@ class MemoryManager
 
   private:
     static uint32_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
+    static uint32_t sizeClassOf(const uint32_t chunkSize) noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
@@ -89,10 +111,24 @@ class MemoryManager
                     const greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
     void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void generateSizeClassIndex() noexcept;
+    uint32_t memPoolIndexForChunkSize(const uint32_t chunkSize) const noexcept;
+    expected<SharedChunk, Error> acquireChunk(const ChunkSettings& chunkSettings,
+                                              ChunkCache* const chunkCache) noexcept;
+    static void* getChunkFromCache(MemPool& memPool, ChunkCache& chunkCache) noexcept;
+    void* getChunkManagementFromCache(ChunkCache& chunkCache) noexcept;
 
   private:
+    /// @brief one size class for each power of two of a uint32_t chunk size plus the end marker
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{std::numeric_limits<uint32_t>::digits + 1U};
+
     bool m_denyAddMemPool{false};
     uint32_t m_totalNumberOfChunks{0};
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::NONE};
+
+    /// @brief the n-th entry is the index of the first mempool with a chunk size of at least 2^n or the number of
+    /// mempools if there is no such mempool
+    uint32_t m_sizeClassIndex[NUMBER_OF_SIZE_CLASSES]{};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
     vector<MemPool, 1> m_chunkManagementPool;
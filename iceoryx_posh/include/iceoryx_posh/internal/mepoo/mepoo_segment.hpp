@@ -26,6 +26,8 @@
 #include "iox/bump_allocator.hpp"
 #include "iox/filesystem.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace mepoo
@@ -38,18 +40,26 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const posix::PosixGroup& readerGroup,
                  const posix::PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const posix::MemoryMapPageOptions& pageOptions = posix::MemoryMapPageOptions(),
+                 const posix::SharedMemoryZeroingOptions& zeroingOptions =
+                     posix::SharedMemoryZeroingOptions()) noexcept;
 
     posix::PosixGroup getWriterGroup() const noexcept;
     posix::PosixGroup getReaderGroup() const noexcept;
     const SharedMemoryObjectType& getSharedMemoryObject() const noexcept;
     MemoryManagerType& getMemoryManager() noexcept;
+    const posix::MemoryMapPageOptions& getPageOptions() const noexcept;
 
     uint64_t getSegmentId() const noexcept;
 
   protected:
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const posix::PosixGroup& writerGroup) noexcept;
+                                                    const posix::PosixGroup& writerGroup,
+                                                    const posix::MemoryMapPageOptions& pageOptions,
+                                                    const posix::SharedMemoryZeroingOptions& zeroingOptions) noexcept;
 
   protected:
     SharedMemoryObjectType m_sharedMemoryObject;
@@ -58,6 +68,7 @@ class MePooSegment
     posix::PosixGroup m_writerGroup;
     uint64_t m_segmentId;
     iox::mepoo::MemoryInfo m_memoryInfo;
+    posix::MemoryMapPageOptions m_pageOptions;
 
     static constexpr access_rights SEGMENT_PERMISSIONS =
         perms::owner_read | perms::owner_write | perms::group_read | perms::group_write;
@@ -38,11 +38,15 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const posix::PosixGroup& readerGroup,
     const posix::PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
-    : m_sharedMemoryObject(std::move(createSharedMemoryObject(mempoolConfig, writerGroup)))
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const posix::MemoryMapPageOptions& pageOptions,
+    const posix::SharedMemoryZeroingOptions& zeroingOptions) noexcept
+    : m_sharedMemoryObject(
+        std::move(createSharedMemoryObject(mempoolConfig, writerGroup, pageOptions, zeroingOptions)))
     , m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
+    , m_pageOptions(pageOptions)
 {
     using namespace posix;
     AccessController accessController;
@@ -60,15 +64,25 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
         errorHandler(PoshError::MEPOO__SEGMENT_COULD_NOT_APPLY_POSIX_RIGHTS_TO_SHARED_MEMORY);
     }
 
+    const auto mempoolSetupStart = std::chrono::steady_clock::now();
     BumpAllocator allocator(m_sharedMemoryObject.getBaseAddress(),
                             m_sharedMemoryObject.get_size().expect("Failed to get SHM size."));
     m_memoryManager.configureMemoryManager(mempoolConfig, managementAllocator, allocator);
+    const auto mempoolSetupDuration = std::chrono::steady_clock::now() - mempoolSetupStart;
+    IOX_LOG(INFO,
+            "Set up the mempools of the payload segment with id "
+                << m_segmentId << " in " << std::chrono::duration_cast<Milliseconds>(mempoolSetupDuration).count()
+                << " ms");
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const posix::PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const posix::PosixGroup& writerGroup,
+    const posix::MemoryMapPageOptions& pageOptions,
+    const posix::SharedMemoryZeroingOptions& zeroingOptions) noexcept
 {
+    const auto creationStart = std::chrono::steady_clock::now();
     return std::move(
         typename SharedMemoryObjectType::Builder()
             .name(writerGroup.getName())
@@ -76,8 +90,10 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
             .accessMode(posix::AccessMode::READ_WRITE)
             .openMode(posix::OpenMode::PURGE_AND_CREATE)
             .permissions(SEGMENT_PERMISSIONS)
+            .pageOptions(pageOptions)
+            .zeroingOptions(zeroingOptions)
             .create()
-            .and_then([this](auto& sharedMemoryObject) {
+            .and_then([this, creationStart](auto& sharedMemoryObject) {
                 auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
                     sharedMemoryObject.getBaseAddress(),
                     sharedMemoryObject.get_size().expect("Failed to get SHM size"));
@@ -92,6 +108,11 @@ inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManager
                             << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size "
                             << sharedMemoryObject.get_size().expect("Failed to get SHM size.") << " to id "
                             << m_segmentId);
+                const auto creationDuration = std::chrono::steady_clock::now() - creationStart;
+                IOX_LOG(INFO,
+                        "Created the shared memory of the payload segment with id "
+                            << m_segmentId << " in "
+                            << std::chrono::duration_cast<Milliseconds>(creationDuration).count() << " ms");
             })
             .or_else([](auto&) { errorHandler(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
             .value());
@@ -115,6 +136,13 @@ inline MemoryManagerType& MePooSegment<SharedMemoryObjectType, MemoryManagerType
     return m_memoryManager;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const posix::MemoryMapPageOptions&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getPageOptions() const noexcept
+{
+    return m_pageOptions;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline const SharedMemoryObjectType&
 MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryObject() const noexcept
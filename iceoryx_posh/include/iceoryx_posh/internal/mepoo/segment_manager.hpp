@@ -59,13 +59,15 @@ class SegmentManager
                        uint64_t size,
                        bool isWritable,
                        uint64_t segmentId,
-                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                       const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                       const posix::MemoryMapPageOptions& pageOptions = posix::MemoryMapPageOptions()) noexcept
             : m_sharedMemoryName(sharedMemoryName)
             , m_startAddress(startAddress)
             , m_size(size)
             , m_isWritable(isWritable)
             , m_segmentId(segmentId)
             , m_memoryInfo(memoryInfo)
+            , m_pageOptions(pageOptions)
 
         {
         }
@@ -76,6 +78,7 @@ class SegmentManager
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
+        posix::MemoryMapPageOptions m_pageOptions; // the applications map the segment with the options of RouDi
     };
 
     struct SegmentUserInformation
@@ -94,7 +97,8 @@ class SegmentManager
     static uint64_t requiredFullMemorySize(const SegmentConfig& config) noexcept;
 
   private:
-    void createSegment(const SegmentConfig::SegmentEntry& segmentEntry) noexcept;
+    void createSegment(const SegmentConfig::SegmentEntry& segmentEntry,
+                       const posix::SharedMemoryZeroingOptions& zeroingOptions) noexcept;
 
   private:
     template <typename MemoryManger, typename SegmentManager, typename PublisherPort>
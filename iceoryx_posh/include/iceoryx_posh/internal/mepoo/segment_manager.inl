@@ -33,17 +33,23 @@ inline SegmentManager<SegmentType>::SegmentManager(const SegmentConfig& segmentC
     IOX_EXPECTS(segmentConfig.m_sharedMemorySegments.capacity() <= m_segmentContainer.capacity());
     for (const auto& segmentEntry : segmentConfig.m_sharedMemorySegments)
     {
-        createSegment(segmentEntry);
+        createSegment(segmentEntry, segmentConfig.m_zeroingOptions);
     }
 }
 
 template <typename SegmentType>
-inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::SegmentEntry& segmentEntry) noexcept
+inline void SegmentManager<SegmentType>::createSegment(
+    const SegmentConfig::SegmentEntry& segmentEntry, const posix::SharedMemoryZeroingOptions& zeroingOptions) noexcept
 {
     auto readerGroup = iox::posix::PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = iox::posix::PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_pageOptions,
+                                    zeroingOptions);
 }
 
 template <typename SegmentType>
@@ -72,7 +78,9 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                         segment.getSharedMemoryObject().getBaseAddress(),
                         segment.getSharedMemoryObject().get_size().expect("failed to get SHM size"),
                         true,
-                        segment.getSegmentId());
+                        segment.getSegmentId(),
+                        iox::mepoo::MemoryInfo(),
+                        segment.getPageOptions());
                     foundInWriterGroup = true;
                 }
                 else
@@ -99,7 +107,9 @@ SegmentManager<SegmentType>::getSegmentMappings(const posix::PosixUser& user) no
                     segment.getSharedMemoryObject().getBaseAddress(),
                     segment.getSharedMemoryObject().get_size().expect("Failed to get SHM size."),
                     false,
-                    segment.getSegmentId());
+                    segment.getSegmentId(),
+                    iox::mepoo::MemoryInfo(),
+                    segment.getPageOptions());
             }
         }
     }
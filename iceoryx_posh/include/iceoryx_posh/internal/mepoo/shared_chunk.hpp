@@ -47,8 +47,28 @@ class SharedChunk
     ChunkHeader* getChunkHeader() const noexcept;
     void* getUserPayload() const noexcept;
 
+    /// @brief Get the timestamps of the latency instrumentation; must only be called when the SharedChunk holds a chunk
+    /// @return the timestamps of the chunk
+    ChunkTimestamps_t& getTimestamps() const noexcept;
+
     ChunkManagement* release() noexcept;
 
+    /// @brief Acquires several references to the chunk with a single atomic operation, e.g. to hand the chunk over to
+    /// a number of chunk queues; each of them must either be taken over by 'adoptAcquiredReference' or be given back
+    /// with 'releaseAcquiredReferences'
+    /// @param[in] numberOfReferences is the number of references which are acquired
+    void acquireReferences(const uint64_t numberOfReferences) const noexcept;
+
+    /// @brief Creates a SharedChunk which takes over one of the references acquired with 'acquireReferences' without
+    /// incrementing the reference counter
+    /// @return a SharedChunk to the same chunk
+    SharedChunk adoptAcquiredReference() const noexcept;
+
+    /// @brief Gives back references acquired with 'acquireReferences' which were not taken over; since this
+    /// SharedChunk holds a reference on its own, the chunk is never freed by this call
+    /// @param[in] numberOfReferences is the number of references which are given back
+    void releaseAcquiredReferences(const uint64_t numberOfReferences) const noexcept;
+
     bool operator==(const SharedChunk& rhs) const noexcept;
     /// @todo iox-#1617 use the newtype pattern to avoid the void pointer
     bool operator==(const void* const rhs) const noexcept;
@@ -124,6 +124,14 @@ class BaseSubscriber
     /// port
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief small helper method to forward to the 'tryGetChunk' method of the port which provides the slot in which
+    /// the chunk is held
+    expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk(uint32_t& slotIndex) noexcept;
+
+    /// @brief small helper method to forward to the 'tryGetChunkBatch' method of the port
+    expected<uint64_t, ChunkReceiveResult> takeChunkBatch(const span<const mepoo::ChunkHeader*> chunkHeaders,
+                                                          const span<uint32_t> slotIndices) noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
@@ -92,6 +92,21 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscriber<po
     return m_port.tryGetChunk();
 }
 
+template <typename port_t>
+inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+BaseSubscriber<port_t>::takeChunk(uint32_t& slotIndex) noexcept
+{
+    return m_port.tryGetChunk(slotIndex);
+}
+
+template <typename port_t>
+inline expected<uint64_t, ChunkReceiveResult>
+BaseSubscriber<port_t>::takeChunkBatch(const span<const mepoo::ChunkHeader*> chunkHeaders,
+                                       const span<uint32_t> slotIndices) noexcept
+{
+    return m_port.tryGetChunkBatch(chunkHeaders, slotIndices);
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
 {
@@ -23,6 +23,7 @@
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 #include <algorithm>
 #include <iterator>
@@ -104,6 +105,13 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks to all the stored chunk queues. The chunks are pushed to each queue in
+    /// the given order and each queue is notified only once for the whole batch. The chunks will be added to the chunk
+    /// history
+    /// @param[in] chunks are the SharedChunks to be delivered
+    /// @return the number of queues the chunks were delivered to
+    uint64_t deliverBatchToAllStoredQueues(const span<const mepoo::SharedChunk> chunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -145,6 +153,18 @@ class ChunkDistributor
 
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Pushes the chunks starting at firstChunkIndex to the queue and notifies the queue once if at least one
+    /// chunk was pushed; chunks which do not fit into a non-blocking queue are counted as lost
+    /// @param[in] hasAcquiredReferences if true, one reference for this queue was acquired in advance for each of
+    /// the chunks starting at firstChunkIndex; they are either handed over to the queue or given back
+    /// @return the index of the first chunk which could not be pushed to a blocking queue or the number of chunks if
+    /// all of them were processed
+    uint64_t pushBatchToQueue(not_null<ChunkQueueData_t* const> queue,
+                              const span<const mepoo::SharedChunk> chunks,
+                              const uint64_t firstChunkIndex,
+                              const bool isBlockingQueue,
+                              const bool hasAcquiredReferences) noexcept;
+
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
@@ -65,6 +65,7 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
             // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
             // pushing will be fine
             getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            ++getMembers()->m_queuesGeneration;
 
             const auto currChunkHistorySize = getMembers()->m_history.size();
 
@@ -112,6 +113,7 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
     {
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
+        ++getMembers()->m_queuesGeneration;
 
         return ok();
     }
@@ -127,6 +129,7 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
     getMembers()->m_queues.clear();
+    ++getMembers()->m_queuesGeneration;
 }
 
 template <typename ChunkDistributorDataType>
@@ -140,33 +143,52 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
+    return deliverBatchToAllStoredQueues(span<const mepoo::SharedChunk>(&chunk, 1U));
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverBatchToAllStoredQueues(
+    const span<const mepoo::SharedChunk> chunks) noexcept
+{
+    struct QueueAwaitingDelivery
+    {
+        RelativePointer<ChunkQueueData_t> queue;
+        uint64_t nextChunkIndex{0U};
+    };
+
+    const uint64_t numberOfChunks = chunks.size();
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    using QueueContainer = decltype(getMembers()->m_queues);
-    QueueContainer fullQueuesAwaitingDelivery;
+    vector<QueueAwaitingDelivery, MemberType_t::QueueContainer_t::capacity()> fullQueuesAwaitingDelivery;
+    uint64_t queuesGenerationOfAwaitingDelivery{0U};
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
 
+        queuesGenerationOfAwaitingDelivery = getMembers()->m_queuesGeneration;
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+        // the references for all queues are acquired at once instead of incrementing the reference counter, which is
+        // shared by all producers and consumers of the chunk, separately for each queue
+        const uint64_t numberOfQueues = getMembers()->m_queues.size();
+        for (uint64_t i = 0U; i < numberOfChunks; ++i)
+        {
+            chunks[i].acquireReferences(numberOfQueues);
+        }
+
         // send to all the queues
         for (auto& queue : getMembers()->m_queues)
         {
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-            if (pushToQueue(queue.get(), chunk))
+            constexpr bool HAS_ACQUIRED_REFERENCES{true};
+            const auto nextChunkIndex =
+                pushBatchToQueue(queue.get(), chunks, 0U, isBlockingQueue, HAS_ACQUIRED_REFERENCES);
+            if (nextChunkIndex == numberOfChunks)
             {
                 ++numberOfQueuesTheChunkWasDeliveredTo;
             }
             else
             {
-                if (isBlockingQueue)
-                {
-                    fullQueuesAwaitingDelivery.emplace_back(queue);
-                }
-                else
-                {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                    ChunkQueuePusher_t(queue.get()).lostAChunk();
-                }
+                fullQueuesAwaitingDelivery.emplace_back(QueueAwaitingDelivery{queue, nextChunkIndex});
             }
         }
     }
@@ -177,50 +199,47 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQu
     {
         adaptiveWait.wait();
         {
-            // create intersection of current queues and fullQueuesAwaitingDelivery
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
             typename MemberType_t::LockGuard_t lock(*getMembers());
-            QueueContainer remainingQueues;
-            using QueueContainerValue = typename QueueContainer::value_type;
-            auto greaterThan = [](QueueContainerValue& a, QueueContainerValue& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-            std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic pop
-#endif
-
-            std::set_intersection(getMembers()->m_queues.begin(),
-                                  getMembers()->m_queues.end(),
-                                  fullQueuesAwaitingDelivery.begin(),
-                                  fullQueuesAwaitingDelivery.end(),
-                                  std::back_inserter(remainingQueues),
-                                  greaterThan);
-            fullQueuesAwaitingDelivery.clear();
-
-            // deliver to remaining queues
-            for (auto& queue : remainingQueues)
+
+            // it is possible that since the last iteration some subscriber have already unsubscribed and without
+            // removing them we would deliver to dead queues; this is only possible if the queue container was
+            // modified, therefore the queues have to be looked up only if its generation changed
+            auto& queues = getMembers()->m_queues;
+            const bool haveQueuesChanged = (queuesGenerationOfAwaitingDelivery != getMembers()->m_queuesGeneration);
+            queuesGenerationOfAwaitingDelivery = getMembers()->m_queuesGeneration;
+
+            // deliver to remaining queues and keep the ones which are still full in place
+            uint64_t numberOfQueuesAwaitingDelivery{0U};
+            for (auto& awaitingQueue : fullQueuesAwaitingDelivery)
             {
-                if (pushToQueue(queue.get(), chunk))
+                auto& queue = awaitingQueue.queue;
+                if (haveQueuesChanged && std::find(queues.begin(), queues.end(), queue.get()) == queues.end())
+                {
+                    continue;
+                }
+
+                constexpr bool IS_BLOCKING_QUEUE{true};
+                constexpr bool HAS_ACQUIRED_REFERENCES{false};
+                awaitingQueue.nextChunkIndex = pushBatchToQueue(
+                    queue.get(), chunks, awaitingQueue.nextChunkIndex, IS_BLOCKING_QUEUE, HAS_ACQUIRED_REFERENCES);
+                if (awaitingQueue.nextChunkIndex == numberOfChunks)
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                 }
                 else
                 {
-                    fullQueuesAwaitingDelivery.push_back(queue);
+                    fullQueuesAwaitingDelivery[numberOfQueuesAwaitingDelivery] = awaitingQueue;
+                    ++numberOfQueuesAwaitingDelivery;
                 }
             }
+            fullQueuesAwaitingDelivery.resize(numberOfQueuesAwaitingDelivery);
         }
     }
 
-    addToHistoryWithoutDelivery(chunk);
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        addToHistoryWithoutDelivery(chunks[i]);
+    }
 
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
@@ -232,6 +251,47 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<Chu
     return ChunkQueuePusher_t(queue).push(chunk);
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::pushBatchToQueue(not_null<ChunkQueueData_t* const> queue,
+                                                             const span<const mepoo::SharedChunk> chunks,
+                                                             const uint64_t firstChunkIndex,
+                                                             const bool isBlockingQueue,
+                                                             const bool hasAcquiredReferences) noexcept
+{
+    ChunkQueuePusher_t queuePusher(queue);
+
+    uint64_t chunkIndex = firstChunkIndex;
+    for (; chunkIndex < chunks.size(); ++chunkIndex)
+    {
+        // the queue takes over the reference also when the push fails and drops it
+        auto chunk = hasAcquiredReferences ? chunks[chunkIndex].adoptAcquiredReference() : chunks[chunkIndex];
+        if (!queuePusher.pushWithoutNotification(std::move(chunk)))
+        {
+            if (isBlockingQueue)
+            {
+                if (hasAcquiredReferences)
+                {
+                    // the remaining chunks are pushed later with references of their own
+                    for (uint64_t i = chunkIndex + 1U; i < chunks.size(); ++i)
+                    {
+                        chunks[i].releaseAcquiredReferences(1U);
+                    }
+                }
+                break;
+            }
+            queuePusher.lostAChunk();
+        }
+    }
+
+    if (chunkIndex > firstChunkIndex)
+    {
+        queuePusher.notify();
+    }
+
+    return chunkIndex;
+}
+
 template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId uniqueQueueId,
@@ -302,10 +362,11 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
-
+    // the capacity is constant, therefore the lock is only required if there is a history at all
     if (0u < getMembers()->m_historyCapacity)
     {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
         if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
         {
             auto chunkToRemove = getMembers()->m_history.begin();
@@ -49,6 +49,9 @@ struct ChunkDistributorData : public LockingPolicy
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
+    /// @brief is incremented on every modification of m_queues; this allows a blocking delivery to detect
+    /// subscription changes without comparing the whole container
+    uint64_t m_queuesGeneration{0U};
 
     /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
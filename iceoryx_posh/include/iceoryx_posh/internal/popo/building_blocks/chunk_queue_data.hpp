@@ -21,10 +21,12 @@
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
@@ -48,6 +50,16 @@ struct ChunkQueueData : public LockingPolicy
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
+
+    /// @brief The condition variable and its notification index are modified under the lock and published to the
+    /// pushers via a sequence lock, i.e. the sequence is odd while they are modified. A pusher reads the published
+    /// copies without the lock and takes the lock only if the sequence was odd or changed while reading them.
+    std::atomic<uint64_t> m_conditionVariableSequence{0U};
+    std::atomic<RelativePointerData> m_publishedConditionVariable{RelativePointerData()};
+    std::atomic<uint64_t> m_publishedNotificationIndex{0U};
+    /// @brief The number of pushers which read the published copies and may still notify the condition variable
+    std::atomic<uint64_t> m_notifiersInFlight{0U};
+
     const QueueFullPolicy m_queueFullPolicy;
 };
 
@@ -97,6 +97,10 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    /// @brief publishes the condition variable for the notification by the pushers and waits until no pusher
+    /// notifies the previous one anymore; must be called with the lock
+    void publishConditionVariable() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
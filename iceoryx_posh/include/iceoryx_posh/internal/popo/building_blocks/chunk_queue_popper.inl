@@ -18,6 +18,8 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_POPPER_INL
 
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/detail/adaptive_wait.hpp"
 #include "iox/logging.hpp"
 
 namespace iox
@@ -133,6 +135,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::setConditionVariable(Condition
 
     getMembers()->m_conditionVariableDataPtr = &conditionVariableDataRef;
     getMembers()->m_conditionVariableNotificationIndex.emplace(notificationIndex);
+    publishConditionVariable();
 }
 
 template <typename ChunkQueueDataType>
@@ -142,6 +145,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::unsetConditionVariable() noexc
 
     getMembers()->m_conditionVariableDataPtr = nullptr;
     getMembers()->m_conditionVariableNotificationIndex.reset();
+    publishConditionVariable();
 }
 
 template <typename ChunkQueueDataType>
@@ -150,6 +154,45 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const
     return getMembers()->m_conditionVariableDataPtr.operator bool();
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::publishConditionVariable() noexcept
+{
+    auto& members = *getMembers();
+    const auto& conditionVariable = members.m_conditionVariableDataPtr;
+
+    // there is only one writer at a time since this is called with the lock
+    const auto sequence = members.m_conditionVariableSequence.load(std::memory_order_relaxed);
+    members.m_conditionVariableSequence.store(sequence + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    RelativePointerData publishedConditionVariable;
+    if (conditionVariable)
+    {
+        publishedConditionVariable = RelativePointerData(
+            static_cast<RelativePointerData::identifier_t>(conditionVariable.getId()), conditionVariable.getOffset());
+    }
+    members.m_publishedConditionVariable.store(publishedConditionVariable, std::memory_order_relaxed);
+    members.m_publishedNotificationIndex.store(members.m_conditionVariableNotificationIndex.value_or(0U),
+                                               std::memory_order_relaxed);
+
+    members.m_conditionVariableSequence.store(sequence + 2U, std::memory_order_seq_cst);
+
+    // a pusher which read the previous condition variable may still notify it; the caller is allowed to release it
+    // on return, therefore the pushers in flight are waited out
+    deadline_timer deadline(units::Duration::fromSeconds(1U));
+    iox::detail::adaptive_wait adaptiveWait;
+    while (members.m_notifiersInFlight.load(std::memory_order_seq_cst) != 0U)
+    {
+        if (deadline.hasExpired())
+        {
+            // the pusher most likely terminated while notifying and is not going to notify anymore
+            IOX_LOG(WARN, "A pusher did not finish notifying the condition variable within 1s; continuing anyway.");
+            break;
+        }
+        adaptiveWait.wait();
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -45,7 +45,16 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
 {
-    auto pushRet = getMembers()->m_queue.push(chunk);
+    const bool hasNoQueueOverflow = pushWithoutNotification(std::move(chunk));
+    notify();
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
+{
+    // the chunk is moved into the queue in order to not touch the reference counter of the chunk
+    auto pushRet = getMembers()->m_queue.push(mepoo::ShmSafeUnmanagedChunk(std::move(chunk)));
     bool hasQueueOverflow = false;
 
     // drop the chunk if one is returned by an overflow
@@ -56,17 +65,43 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    auto& members = *getMembers();
+
+    // read the published condition variable without the lock, so that several pushers can notify concurrently; the
+    // pusher is counted as in flight meanwhile since the condition variable must not be released before it is done
+    members.m_notifiersInFlight.fetch_add(1U, std::memory_order_seq_cst);
+    const auto sequence = members.m_conditionVariableSequence.load(std::memory_order_seq_cst);
+    const auto conditionVariable = members.m_publishedConditionVariable.load(std::memory_order_relaxed);
+    const auto notificationIndex = members.m_publishedNotificationIndex.load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto sequenceAfterRead = members.m_conditionVariableSequence.load(std::memory_order_relaxed);
+    const bool isModifiedConcurrently = (sequence % 2U != 0U) || (sequence != sequenceAfterRead);
+
+    if (!isModifiedConcurrently && !conditionVariable.isLogicalNullptr())
+    {
+        const RelativePointer<ConditionVariableData> conditionVariablePtr(conditionVariable.offset(),
+                                                                          segment_id_t{conditionVariable.id()});
+        ConditionNotifier(*conditionVariablePtr.get(), notificationIndex).notify();
+    }
+    members.m_notifiersInFlight.fetch_sub(1U, std::memory_order_release);
+
+    if (isModifiedConcurrently)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
+        // the robust mutex is only taken while the condition variable is modified; it never waits for another
+        // pusher and reports a process which terminated while holding it instead of blocking forever
+        typename MemberType_t::LockGuard_t lock(members);
+        if (members.m_conditionVariableDataPtr)
         {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
+            ConditionNotifier(*members.m_conditionVariableDataPtr.get(), *members.m_conditionVariableNotificationIndex)
                 .notify();
         }
     }
-
-    return !hasQueueOverflow;
 }
 
 template <typename ChunkQueueDataType>
@@ -22,6 +22,10 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
+
+#include <algorithm>
 
 namespace iox
 {
@@ -78,10 +82,39 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Like tryGet but additionally provides the slot in which the chunk is held
+    /// @param[out] slotIndex the slot of the chunk, which allows to release it in constant time
+    /// @return New chunk header, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet(uint32_t& slotIndex) noexcept;
+
+    /// @brief Tries to get several received chunks at once. Only as many chunks are taken from the underlying queue as
+    /// can be held in parallel, i.e. no chunk is dropped. The ownership of the SharedChunks remains in the
+    /// ChunkReceiver for being able to cleanup if the user process disappears
+    /// @param[out] chunkHeaders is filled with the ChunkHeaders of the received chunks, beginning with the oldest one;
+    /// its size is the maximum number of chunks to get
+    /// @param[out] slotIndices is filled with the slots of the received chunks, which allow to release them in
+    /// constant time; it must not be smaller than chunkHeaders
+    /// @return number of received chunks, ChunkReceiveResult on error or if there are no new chunks in the underlying
+    /// queue
+    expected<uint64_t, ChunkReceiveResult> tryGetBatch(const span<const mepoo::ChunkHeader*> chunkHeaders,
+                                                       const span<uint32_t> slotIndices) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Release a chunk that was obtained with tryGet without searching it
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @param[in] slotIndex, the slot which was provided by tryGet
+    void release(const mepoo::ChunkHeader* const chunkHeader, const uint32_t slotIndex) noexcept;
+
+    /// @brief Release several chunks that were obtained with tryGetBatch without searching them
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to release
+    /// @param[in] slotIndices, the slots which were provided by tryGetBatch
+    void releaseBatch(const span<const mepoo::ChunkHeader* const> chunkHeaders,
+                      const span<const uint32_t> slotIndices) noexcept;
+
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
     /// chunks in the system
@@ -71,6 +71,14 @@ ChunkReceiver<ChunkReceiverDataType>::getMembers() noexcept
 
 template <typename ChunkReceiverDataType>
 inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
+{
+    uint32_t slotIndex{0U};
+    return tryGet(slotIndex);
+}
+
+template <typename ChunkReceiverDataType>
+inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGet(uint32_t& slotIndex) noexcept
 {
     auto popRet = this->tryPop();
 
@@ -79,8 +87,11 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
         auto sharedChunk = *popRet;
 
         // if the application holds too many chunks, don't provide more
-        if (getMembers()->m_chunksInUse.insert(sharedChunk))
+        auto insertRet = getMembers()->m_chunksInUse.insert(sharedChunk);
+        if (insertRet.has_value())
         {
+            slotIndex = insertRet.value();
+            recordTake(sharedChunk.getTimestamps(), getMembers()->m_latencyHistograms);
             return ok(const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
         }
         else
@@ -93,6 +104,51 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
     return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline expected<uint64_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetBatch(const span<const mepoo::ChunkHeader*> chunkHeaders,
+                                                  const span<uint32_t> slotIndices) noexcept
+{
+    auto& chunksInUse = getMembers()->m_chunksInUse;
+
+    // if the application holds too many chunks, don't provide more; in contrast to tryGet the chunks are not even
+    // taken from the queue and therefore not dropped
+    const uint64_t numberOfRequestedChunks = std::min(chunkHeaders.size(), slotIndices.size());
+    const uint64_t maxNumberOfChunks =
+        std::min(numberOfRequestedChunks, static_cast<uint64_t>(chunksInUse.freeSlots()));
+    if (maxNumberOfChunks == 0U && numberOfRequestedChunks != 0U)
+    {
+        return err(this->empty() ? ChunkReceiveResult::NO_CHUNK_AVAILABLE
+                                 : ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_IN_USE> chunks;
+    while (chunks.size() < maxNumberOfChunks)
+    {
+        auto popRet = this->tryPop();
+        if (!popRet.has_value())
+        {
+            break;
+        }
+        chunks.push_back(*popRet);
+    }
+
+    if (chunks.empty())
+    {
+        return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    }
+
+    // there are enough free slots, therefore this always succeeds
+    chunksInUse.insert(span<const mepoo::SharedChunk>(chunks.data(), chunks.size()), slotIndices);
+
+    for (uint64_t i = 0U; i < chunks.size(); ++i)
+    {
+        chunkHeaders[i] = chunks[i].getChunkHeader();
+        recordTake(chunks[i].getTimestamps(), getMembers()->m_latencyHistograms);
+    }
+    return ok(chunks.size());
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -104,6 +160,29 @@ inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHead
     }
 }
 
+template <typename ChunkReceiverDataType>
+inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader,
+                                                          const uint32_t slotIndex) noexcept
+{
+    mepoo::SharedChunk chunk(nullptr);
+    // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
+    if (!getMembers()->m_chunksInUse.remove(slotIndex, chunkHeader, chunk))
+    {
+        errorHandler(PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, ErrorLevel::SEVERE);
+    }
+}
+
+template <typename ChunkReceiverDataType>
+inline void
+ChunkReceiver<ChunkReceiverDataType>::releaseBatch(const span<const mepoo::ChunkHeader* const> chunkHeaders,
+                                                   const span<const uint32_t> slotIndices) noexcept
+{
+    if (!getMembers()->m_chunksInUse.remove(slotIndices, chunkHeaders))
+    {
+        errorHandler(PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, ErrorLevel::SEVERE);
+    }
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::releaseAll() noexcept
 {
@@ -28,6 +28,8 @@
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -104,6 +106,25 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                const uint32_t userHeaderSize,
                                                                const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate several chunks with the same settings at once; either all chunks are allocated or none. The
+    /// chunks are taken from the mempool in batches and the ownership of the SharedChunks remains in the ChunkSender
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a
+    /// user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @param[out] chunkHeaders is filled with the ChunkHeaders of the allocated chunks; its size defines the number
+    /// of chunks to allocate
+    /// @return success if all chunks could be allocated, error if not
+    expected<void, AllocationError> tryAllocateBatch(const UniquePortId originId,
+                                                     const uint32_t userPayloadSize,
+                                                     const uint32_t userPayloadAlignment,
+                                                     const uint32_t userHeaderSize,
+                                                     const uint32_t userHeaderAlignment,
+                                                     const span<mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -114,6 +135,13 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send several allocated chunks to all connected ChunkQueuePopper with one delivery, i.e. every
+    /// ChunkQueuePopper is notified only once
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send in the given order; the ownership of the pointers
+    /// is transferred to this method
+    /// @return the number of receiver the chunks were send to
+    uint64_t sendBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -133,9 +161,9 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
 
-    /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
-    /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
-    /// chunks in the system
+    /// @brief Release all the chunks that are currently held, including the chunks in the chunk cache. Caution: Only
+    /// call this if the user process is no more running E.g. This cleans up chunks that were held by a user process
+    /// that died unexpectetly, for avoiding lost chunks in the system
     void releaseAll() noexcept;
 
   private:
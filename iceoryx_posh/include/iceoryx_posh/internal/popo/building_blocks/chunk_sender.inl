@@ -128,6 +128,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
             lastChunkChunkHeader->~ChunkHeader();
             new (lastChunkChunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
             lastChunkChunkHeader->setOriginId(originId);
+            recordLoan(sharedChunk.getTimestamps());
             return ok(lastChunkChunkHeader);
         }
         else
@@ -139,7 +140,9 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
         // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        auto getChunkResult = getMembers()->m_useChunkCache
+                                  ? getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkCache)
+                                  : getMembers()->m_memoryMgr->getChunk(chunkSettings);
 
         if (getChunkResult.has_error())
         {
@@ -154,6 +157,7 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         {
             // END of critical section
             chunk.getChunkHeader()->setOriginId(originId);
+            recordLoan(chunk.getTimestamps());
             return ok(chunk.getChunkHeader());
         }
         else
@@ -165,6 +169,70 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
     }
 }
 
+template <typename ChunkSenderDataType>
+inline expected<void, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocateBatch(const UniquePortId originId,
+                                                   const uint32_t userPayloadSize,
+                                                   const uint32_t userPayloadAlignment,
+                                                   const uint32_t userHeaderSize,
+                                                   const uint32_t userHeaderAlignment,
+                                                   const span<mepoo::ChunkHeader*> chunkHeaders) noexcept
+{
+    const auto chunkSettingsResult =
+        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (chunkSettingsResult.has_error())
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
+
+    const auto& chunkSettings = chunkSettingsResult.value();
+
+    // the chunk cache is used for a batch even if it is not enabled for this ChunkSender, this way the chunks are
+    // taken from the mempool with a few free-list operations instead of one per chunk; since the cache resides in the
+    // ChunkSenderData, chunks are not lost if the process terminates during the allocation
+    expected<void, AllocationError> result = ok();
+    uint64_t numberOfAllocatedChunks{0U};
+    for (; numberOfAllocatedChunks < chunkHeaders.size(); ++numberOfAllocatedChunks)
+    {
+        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings, getMembers()->m_chunkCache);
+        if (getChunkResult.has_error())
+        {
+            /// @todo iox-#1012 use error<E2>::from(E1); once available
+            result = err(into<AllocationError>(getChunkResult.error()));
+            break;
+        }
+
+        auto& chunk = getChunkResult.value();
+        if (!getMembers()->m_chunksInUse.insert(chunk))
+        {
+            // release the allocated chunk
+            chunk = nullptr;
+            result = err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+            break;
+        }
+
+        chunk.getChunkHeader()->setOriginId(originId);
+        recordLoan(chunk.getTimestamps());
+        chunkHeaders[numberOfAllocatedChunks] = chunk.getChunkHeader();
+    }
+
+    if (result.has_error())
+    {
+        for (uint64_t i = 0U; i < numberOfAllocatedChunks; ++i)
+        {
+            release(chunkHeaders[i]);
+            chunkHeaders[i] = nullptr;
+        }
+    }
+
+    if (!getMembers()->m_useChunkCache)
+    {
+        mepoo::MemoryManager::releaseChunkCache(getMembers()->m_chunkCache);
+    }
+
+    return result;
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -185,6 +253,7 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         numberOfReceiverTheChunkWasDelivered = this->deliverToAllStoredQueues(chunk);
+        recordDelivery(chunk.getTimestamps(), getMembers()->m_latencyHistograms);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
@@ -194,6 +263,39 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    uint64_t numberOfReceiverTheChunksWereDelivered{0};
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_IN_USE> chunks;
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (uint64_t i = 0U; i < chunkHeaders.size(); ++i)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeaders[i], chunk))
+        {
+            // there cannot be more chunks ready for send than chunks in use, therefore this always succeeds
+            chunks.push_back(chunk);
+        }
+    }
+
+    if (!chunks.empty())
+    {
+        numberOfReceiverTheChunksWereDelivered =
+            this->deliverBatchToAllStoredQueues(span<const mepoo::SharedChunk>(chunks.data(), chunks.size()));
+        for (const auto& chunk : chunks)
+        {
+            recordDelivery(chunk.getTimestamps(), getMembers()->m_latencyHistograms);
+        }
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+    }
+    // END of critical section
+
+    return numberOfReceiverTheChunksWereDelivered;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
@@ -204,6 +306,7 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
         auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk);
+        recordDelivery(chunk.getTimestamps(), getMembers()->m_latencyHistograms);
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
@@ -249,6 +352,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    mepoo::MemoryManager::releaseChunkCache(getMembers()->m_chunkCache);
 }
 
 template <typename ChunkSenderDataType>
@@ -258,6 +362,7 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        recordPublish(chunk.getTimestamps(), getMembers()->m_latencyHistograms);
         return true;
     }
     else
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
 #include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iox/not_null.hpp"
@@ -36,15 +37,20 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const bool useChunkCache = false) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
-    UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
+    static constexpr uint32_t MAX_CHUNKS_IN_USE = MaxChunksAllocatedSimultaneously;
+    UsedChunkList<MAX_CHUNKS_IN_USE> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    bool m_useChunkCache{false};
+    mepoo::MemoryManager::ChunkCache m_chunkCache;
+    LatencyHistograms_t<ChunkSenderLatencyHistograms> m_latencyHistograms;
 };
 
 } // namespace popo
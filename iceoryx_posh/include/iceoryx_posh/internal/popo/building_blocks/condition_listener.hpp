@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iox/algorithm.hpp"
 
 namespace iox
@@ -31,7 +32,11 @@ class ConditionListener
   public:
     using NotificationVector_t = vector<BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @brief Creates a ConditionListener
+    /// @param[in] condVarData the condition variable the notifiers notify
+    /// @param[in] waitStrategy defines if and how long the active notifications are polled before blocking
+    explicit ConditionListener(ConditionVariableData& condVarData,
+                               const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -69,13 +74,22 @@ class ConditionListener
     ConditionVariableData* getMembers() volatile noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()>& waitCall) noexcept;
+    /// @brief atomically takes all active notifications and appends their indices in ascending order
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
+
+    /// @brief polls the active notifications until one is active, destroy() was called or the spin duration
+    /// has passed; the notifiers do not post the semaphore in the meantime
+    void spinUntilNotified(const units::Duration& spinDuration) noexcept;
+
+    bool hasActiveNotifications() const noexcept;
+
+    NotificationVector_t waitImpl(const units::Duration& spinDuration, const function_ref<bool()>& waitCall) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
+    WaitStrategy m_waitStrategy;
     std::atomic_bool m_toBeDestroyed{false};
 };
 
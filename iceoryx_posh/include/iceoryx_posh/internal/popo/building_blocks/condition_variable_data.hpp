@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/posix_wrapper/unnamed_semaphore.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_requester.hpp"
 
 #include <atomic>
 
@@ -29,6 +30,13 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    /// @brief the active notifications are stored as bits in atomic words so that a listener can collect all
+    ///        notifications of a word with a single exchange instead of checking every notifier separately
+    using NotificationWord_t = uint64_t;
+    static constexpr uint64_t NOTIFICATION_WORD_BITS = 64U;
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS =
+        (MAX_NUMBER_OF_NOTIFIERS + NOTIFICATION_WORD_BITS - 1U) / NOTIFICATION_WORD_BITS;
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,11 +46,19 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief Checks if the notification with the given index is active
+    /// @param[in] index of the notification, must be smaller than MAX_NUMBER_OF_NOTIFIERS
+    /// @return true if the notification is active, otherwise false
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
     optional<posix::UnnamedSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    std::atomic<NotificationWord_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     std::atomic_bool m_wasNotified{false};
+    /// @brief set while a listener polls the active notifications; the notifiers do not post the semaphore then
+    std::atomic_bool m_isListenerSpinning{false};
+    DiscoveryRequester m_discoveryRequester;
 };
 
 } // namespace popo
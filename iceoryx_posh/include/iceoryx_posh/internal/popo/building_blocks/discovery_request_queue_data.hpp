@@ -0,0 +1,55 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_REQUEST_QUEUE_DATA_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_REQUEST_QUEUE_DATA_HPP
+
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_requester.hpp"
+
+#include <atomic>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Shared memory queue of the PortPool entries which changed their discovery relevant state since the last
+/// run of the RouDi discovery loop. The discovery loop waits on m_conditionVariableData and only processes the
+/// entries in the queue instead of iterating over the whole PortPool.
+struct DiscoveryRequestQueueData
+{
+    /// @brief every entry is enqueued at most once until it is processed, therefore the queue can hold all entries
+    static constexpr uint64_t CAPACITY = MAX_PUBLISHERS + MAX_SUBSCRIBERS + MAX_SERVERS + MAX_CLIENTS
+                                         + MAX_INTERFACE_NUMBER + MAX_NODE_NUMBER + MAX_NUMBER_OF_CONDITION_VARIABLES;
+
+    /// @brief notification index used by the DiscoveryRequester
+    static constexpr uint64_t DISCOVERY_REQUEST_NOTIFICATION_INDEX = 0U;
+    /// @brief notification index used by RouDi to trigger a full discovery run or to stop the discovery loop
+    static constexpr uint64_t DISCOVERY_TRIGGER_NOTIFICATION_INDEX = 1U;
+
+    DiscoveryRequestQueueData() noexcept = default;
+
+    ConditionVariableData m_conditionVariableData;
+    concurrent::LockFreeQueue<DiscoveryRequest, CAPACITY> m_requests;
+    /// @brief is set when a request could not be enqueued; RouDi has to do a full discovery run in this case
+    std::atomic_bool m_hasOverflowed{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_REQUEST_QUEUE_DATA_HPP
@@ -0,0 +1,85 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_REQUESTER_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_REQUESTER_HPP
+
+#include "iox/relative_pointer.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+struct DiscoveryRequestQueueData;
+
+/// @brief The kind of PortPool entry which requested a discovery run
+enum class DiscoveryRequestSource : uint8_t
+{
+    PUBLISHER_PORT,
+    SUBSCRIBER_PORT,
+    SERVER_PORT,
+    CLIENT_PORT,
+    INTERFACE_PORT,
+    NODE,
+    CONDITION_VARIABLE
+};
+
+/// @brief Identifies a PortPool entry with pending discovery changes by its kind and its index in the PortPool
+struct DiscoveryRequest
+{
+    DiscoveryRequestSource source{DiscoveryRequestSource::PUBLISHER_PORT};
+    uint64_t index{0U};
+};
+
+/// @brief Part of every PortPool entry which can change its discovery relevant state, e.g. by an offer, a
+/// subscribe or a destroy from the runtime side. It enqueues the entry into the DiscoveryRequestQueueData of
+/// RouDi and wakes up the discovery loop. An entry is enqueued at most once until RouDi acknowledged the request.
+/// As long as the DiscoveryRequester is not initialized by the PortPool, requesting a discovery does nothing.
+class DiscoveryRequester
+{
+  public:
+    DiscoveryRequester() noexcept = default;
+
+    DiscoveryRequester(const DiscoveryRequester&) = delete;
+    DiscoveryRequester(DiscoveryRequester&&) = delete;
+    DiscoveryRequester& operator=(const DiscoveryRequester&) = delete;
+    DiscoveryRequester& operator=(DiscoveryRequester&&) = delete;
+    ~DiscoveryRequester() noexcept = default;
+
+    /// @brief Connects the DiscoveryRequester with the queue of RouDi; called by the PortPool when the entry is
+    /// created
+    /// @param[in] queue which is processed by the RouDi discovery loop
+    /// @param[in] request which identifies the entry this DiscoveryRequester belongs to
+    void init(DiscoveryRequestQueueData& queue, const DiscoveryRequest request) noexcept;
+
+    /// @brief Requests a discovery run for the entry; must be called after the discovery relevant state was changed
+    void requestDiscovery() noexcept;
+
+    /// @brief Called by RouDi before it processes the request; a change after this call requests a new discovery run
+    void acknowledge() noexcept;
+
+  private:
+    RelativePointer<DiscoveryRequestQueueData> m_queue;
+    DiscoveryRequest m_request;
+    std::atomic_bool m_isRequested{false};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_DISCOVERY_REQUESTER_HPP
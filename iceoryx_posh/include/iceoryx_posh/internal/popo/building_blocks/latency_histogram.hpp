@@ -0,0 +1,139 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
+
+#include "iceoryx_posh/iceoryx_posh_deployment.hpp"
+#include "iceoryx_posh/internal/mepoo/chunk_management.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Lock-free histogram of latencies in nanoseconds which resides in the shared memory. The values are recorded
+///        in buckets with a logarithmic scale which are further divided into linear sub-buckets, like a HDR histogram.
+///        Each bucket covers a value range with a width of at most 1/SUB_BUCKET_COUNT of its lower bound. Recording
+///        is wait-free and can be done concurrently with reading the histogram from another process.
+class LatencyHistogram
+{
+  public:
+    static constexpr uint32_t SUB_BUCKET_BITS{3U};
+    static constexpr uint64_t SUB_BUCKET_COUNT{1U << SUB_BUCKET_BITS};
+    /// @brief values of 2^MAX_EXPONENT nanoseconds (~18 minutes) and above are recorded in the last bucket
+    static constexpr uint32_t MAX_EXPONENT{40U};
+    static constexpr uint32_t NUMBER_OF_BUCKETS{(MAX_EXPONENT - SUB_BUCKET_BITS + 1U)
+                                                * static_cast<uint32_t>(SUB_BUCKET_COUNT)};
+
+    /// @brief records a latency
+    /// @param[in] nanoseconds is the latency to record
+    void record(const uint64_t nanoseconds) noexcept;
+
+    /// @brief the number of recorded latencies
+    /// @return the number of recorded latencies
+    uint64_t sampleCount() const noexcept;
+
+    /// @brief the largest recorded latency
+    /// @return the largest recorded latency in nanoseconds
+    uint64_t maximum() const noexcept;
+
+    /// @brief The latency below or equal to which the given percentage of the recorded latencies are. Since only the
+    ///        bucket of a latency is recorded, the upper bound of the bucket containing the percentile is returned.
+    /// @param[in] percentile in the range [0, 100]
+    /// @return the latency at the percentile in nanoseconds or 0 if nothing was recorded
+    uint64_t valueAtPercentile(const double percentile) const noexcept;
+
+    /// @brief the index of the bucket which records the value
+    /// @param[in] value to get the bucket index for
+    /// @return the bucket index
+    static uint32_t bucketIndex(const uint64_t value) noexcept;
+
+    /// @brief the smallest value which is recorded by the bucket
+    /// @param[in] index of the bucket; must be smaller than NUMBER_OF_BUCKETS
+    /// @return the lower bound of the bucket
+    static uint64_t lowerBound(const uint32_t index) noexcept;
+
+    /// @brief the largest value which is recorded by the bucket; for the last bucket this is the largest value which
+    ///        is resolved and not the largest value it records
+    /// @param[in] index of the bucket; must be smaller than NUMBER_OF_BUCKETS
+    /// @return the upper bound of the bucket
+    static uint64_t upperBound(const uint32_t index) noexcept;
+
+  private:
+    std::array<std::atomic<uint64_t>, NUMBER_OF_BUCKETS> m_buckets{};
+    std::atomic<uint64_t> m_sampleCount{0U};
+    std::atomic<uint64_t> m_maximum{0U};
+};
+
+/// @brief the latency histograms recorded by a ChunkSender
+struct ChunkSenderLatencyHistograms
+{
+    /// @brief time between loaning a chunk and publishing it
+    LatencyHistogram loanToPublish;
+    /// @brief time between publishing a chunk and having it pushed to the queues of all receivers
+    LatencyHistogram publishToDelivery;
+};
+
+/// @brief the latency histograms recorded by a ChunkReceiver
+struct ChunkReceiverLatencyHistograms
+{
+    /// @brief end-to-end time between publishing a chunk and taking it from the queue
+    LatencyHistogram publishToTake;
+};
+
+/// @brief Used instead of the latency histograms when the latency instrumentation is disabled
+struct NoLatencyHistograms
+{
+};
+
+template <typename LatencyHistograms>
+using LatencyHistograms_t =
+    typename std::conditional<build::IOX_LATENCY_INSTRUMENTATION, LatencyHistograms, NoLatencyHistograms>::type;
+
+/// @brief the current time of the steady clock, which is shared by all processes, in nanoseconds
+uint64_t latencyTimestamp() noexcept;
+
+/// @brief The overloads of these functions record the stages of a chunk when the latency instrumentation is enabled
+///        and do nothing when it is disabled. This keeps the hot path free of any instrumentation code in the latter
+///        case.
+/// @{
+void recordLoan(mepoo::ChunkTimestamps& timestamps) noexcept;
+void recordPublish(mepoo::ChunkTimestamps& timestamps, ChunkSenderLatencyHistograms& histograms) noexcept;
+void recordDelivery(const mepoo::ChunkTimestamps& timestamps, ChunkSenderLatencyHistograms& histograms) noexcept;
+void recordTake(const mepoo::ChunkTimestamps& timestamps, ChunkReceiverLatencyHistograms& histograms) noexcept;
+
+inline void recordLoan(mepoo::NoChunkTimestamps&) noexcept
+{
+}
+inline void recordPublish(mepoo::NoChunkTimestamps&, NoLatencyHistograms&) noexcept
+{
+}
+inline void recordDelivery(const mepoo::NoChunkTimestamps&, NoLatencyHistograms&) noexcept
+{
+}
+inline void recordTake(const mepoo::NoChunkTimestamps&, NoLatencyHistograms&) noexcept
+{
+}
+/// @}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATENCY_HISTOGRAM_HPP
@@ -96,14 +96,21 @@ inline constexpr uint64_t ListenerImpl<Capacity>::capacity() noexcept
 
 template <uint64_t Capacity>
 inline ListenerImpl<Capacity>::ListenerImpl() noexcept
-    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable())
+    : ListenerImpl(WaitStrategy())
 {
 }
 
 template <uint64_t Capacity>
-inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable) noexcept
+inline ListenerImpl<Capacity>::ListenerImpl(const WaitStrategy& waitStrategy) noexcept
+    : ListenerImpl(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitStrategy)
+{
+}
+
+template <uint64_t Capacity>
+inline ListenerImpl<Capacity>::ListenerImpl(ConditionVariableData& conditionVariable,
+                                            const WaitStrategy& waitStrategy) noexcept
     : m_conditionVariableData(&conditionVariable)
-    , m_conditionListener(conditionVariable)
+    , m_conditionListener(conditionVariable, waitStrategy)
 {
     m_thread = std::thread(&ListenerImpl<Capacity>::threadLoop, this);
 }
@@ -116,6 +123,7 @@ inline ListenerImpl<Capacity>::~ListenerImpl() noexcept
 
     m_thread.join();
     m_conditionVariableData->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    m_conditionVariableData->m_discoveryRequester.requestDiscovery();
 }
 
 template <uint64_t Capacity>
@@ -25,6 +25,7 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -61,6 +62,23 @@ class PublisherPortUser : public BasePort
                                                                     const uint32_t userHeaderSize = 0U,
                                                                     const uint32_t userHeaderAlignment = 1U) noexcept;
 
+    /// @brief Allocate several chunks with the same settings at once; either all chunks are allocated or none. The
+    /// ownership of the SharedChunks remains in the PublisherPortUser for being able to cleanup if the user process
+    /// disappears
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header; use iox::CHUNK_NO_USER_HEADER_SIZE to omit a user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header; use iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+    /// to omit a user-header
+    /// @param[out] chunkHeaders is filled with the ChunkHeaders of the allocated chunks; its size defines the number
+    /// of chunks to allocate
+    /// @return success if all chunks could be allocated, error if not
+    expected<void, AllocationError> tryAllocateChunkBatch(const uint32_t userPayloadSize,
+                                                          const uint32_t userPayloadAlignment,
+                                                          const uint32_t userHeaderSize,
+                                                          const uint32_t userHeaderAlignment,
+                                                          const span<mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
     /// @brief Free an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to free
     void releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -69,6 +87,11 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send several allocated chunks to all connected subscriber ports; every subscriber port is notified only
+    /// once for the whole batch
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send in the given order
+    void sendChunkBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -26,6 +26,7 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -67,10 +68,38 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
+    /// @brief Like tryGetChunk but additionally provides the slot in which the chunk is held
+    /// @param[out] slotIndex the slot of the chunk, which allows to release it in constant time
+    /// @return New chunk header, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk(uint32_t& slotIndex) noexcept;
+
+    /// @brief Tries to get several chunks from the queue at once, beginning with the oldest one. Only as many chunks
+    /// are taken from the queue as can be held in parallel
+    /// @param[out] chunkHeaders is filled with the ChunkHeaders of the received chunks; its size is the maximum number
+    /// of chunks to get
+    /// @param[out] slotIndices is filled with the slots of the received chunks, which allow to release them in
+    /// constant time; it must not be smaller than chunkHeaders
+    /// @return number of received chunks, ChunkReceiveResult on error or if there are no new chunks in the underlying
+    /// queue
+    expected<uint64_t, ChunkReceiveResult> tryGetChunkBatch(const span<const mepoo::ChunkHeader*> chunkHeaders,
+                                                            const span<uint32_t> slotIndices) noexcept;
+
     /// @brief Release a chunk that was obtained with tryGetChunk
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Release a chunk that was obtained with tryGetChunk without searching it
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @param[in] slotIndex, the slot which was provided by tryGetChunk
+    void releaseChunk(const mepoo::ChunkHeader* const chunkHeader, const uint32_t slotIndex) noexcept;
+
+    /// @brief Release several chunks that were obtained with tryGetChunkBatch without searching them
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to release
+    /// @param[in] slotIndices, the slots which were provided by tryGetChunkBatch
+    void releaseChunkBatch(const span<const mepoo::ChunkHeader* const> chunkHeaders,
+                           const span<const uint32_t> slotIndices) noexcept;
+
     /// @brief Release all the chunks that are currently queued up.
     void releaseQueuedChunks() noexcept;
 
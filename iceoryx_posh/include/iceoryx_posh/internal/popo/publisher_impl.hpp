@@ -22,7 +22,9 @@
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
 #include "iox/type_traits.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -37,6 +39,8 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     using HeaderTypeAssert = typename TypedPortApiTrait<H>::Assert;
 
   public:
+    using SampleBatch_t = vector<Sample<T, H>, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY>;
+
     explicit PublisherImpl(const capro::ServiceDescription& service,
                            const PublisherOptions& publisherOptions = PublisherOptions());
     PublisherImpl(const PublisherImpl& other) = delete;
@@ -55,12 +59,33 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     template <typename... Args>
     expected<Sample<T, H>, AllocationError> loan(Args&&... args) noexcept;
 
+    ///
+    /// @brief loanBatch Get several samples from loaned shared memory at once and construct the data of each sample
+    /// with the given arguments.
+    /// @param numberOfSamples The number of samples to loan.
+    /// @param args Arguments used to construct the data of every sample.
+    /// @return The samples that reside in shared memory or an error if unable to allocate memory for all of them; no
+    /// sample is loaned in case of an error.
+    /// @details The chunks are taken from the mempool in batches. The loaned samples are automatically released when
+    /// they go out of scope.
+    ///
+    template <typename... Args>
+    expected<SampleBatch_t, AllocationError> loanBatch(const uint64_t numberOfSamples, const Args&... args) noexcept;
+
     ///
     /// @brief publish Publishes the given sample and then releases its loan.
     /// @param sample The sample to publish.
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishBatch Publishes the given samples in the given order and then releases their loans.
+    /// @param samples The samples to publish; samples without a loan are skipped.
+    /// @details In contrast to publishing the samples one by one, the subscribers are notified only once for the whole
+    /// batch.
+    ///
+    void publishBatch(const span<Sample<T, H>> samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
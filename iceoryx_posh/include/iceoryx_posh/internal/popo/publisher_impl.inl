@@ -41,6 +41,35 @@ inline expected<Sample<T, H>, AllocationError> PublisherImpl<T, H, BasePublisher
     return std::move(loanSample().and_then([&](auto& sample) { new (sample.get()) T(std::forward<Args>(args)...); }));
 }
 
+template <typename T, typename H, typename BasePublisherType>
+template <typename... Args>
+inline expected<typename PublisherImpl<T, H, BasePublisherType>::SampleBatch_t, AllocationError>
+PublisherImpl<T, H, BasePublisherType>::loanBatch(const uint64_t numberOfSamples, const Args&... args) noexcept
+{
+    static constexpr uint32_t USER_HEADER_SIZE{std::is_same<H, mepoo::NoUserHeader>::value ? 0U : sizeof(H)};
+
+    if (numberOfSamples > SampleBatch_t::capacity())
+    {
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+    }
+
+    vector<mepoo::ChunkHeader*, SampleBatch_t::capacity()> chunkHeaders(numberOfSamples, nullptr);
+    auto result = port().tryAllocateChunkBatch(
+        sizeof(T), alignof(T), USER_HEADER_SIZE, alignof(H), span<mepoo::ChunkHeader*>(chunkHeaders));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    SampleBatch_t samples;
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        samples.emplace_back(convertChunkHeaderToSample(chunkHeaders[i]));
+        new (samples.back().get()) T(args...);
+    }
+    return ok(std::move(samples));
+}
+
 template <typename T, typename H, typename BasePublisherType>
 template <typename Callable, typename... ArgTypes>
 inline expected<void, AllocationError>
@@ -92,6 +121,35 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(const span<Sample<T, H>> samples) noexcept
+{
+    vector<mepoo::ChunkHeader*, SampleBatch_t::capacity()> chunkHeaders;
+    for (uint64_t i = 0U; i < samples.size(); ++i)
+    {
+        auto& sample = samples[i];
+        if (!sample)
+        {
+            continue;
+        }
+
+        auto userPayload = sample.release(); // release the Samples ownership of the chunk before publishing
+        chunkHeaders.push_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+
+        // there cannot be more loaned samples than chunks which are allocated simultaneously, this is just a safeguard
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunkBatch(span<mepoo::ChunkHeader* const>(chunkHeaders));
+            chunkHeaders.clear();
+        }
+    }
+
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunkBatch(span<mepoo::ChunkHeader* const>(chunkHeaders));
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
@@ -20,6 +20,11 @@
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iox/span.hpp"
+#include "iox/type_traits.hpp"
+#include "iox/vector.hpp"
+
+#include <algorithm>
 
 namespace iox
 {
@@ -52,6 +57,18 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take up to maxNumberOfSamples samples from the top of the receive queue at once and call the provided
+    /// callable with the data of each of them, beginning with the oldest one.
+    /// @param maxNumberOfSamples The maximum number of samples to take.
+    /// @param c Callable with the signature void(const T&) which is called for each taken sample.
+    /// @return Either the number of taken samples or a ChunkReceiveResult.
+    /// @details All samples are released together after the callable returned for the last one. Don't store a
+    /// reference to the data outside of the callable.
+    ///
+    template <typename Callable>
+    expected<uint64_t, ChunkReceiveResult> takeBatch(const uint64_t maxNumberOfSamples, Callable c) noexcept;
+
     using PortType = typename BaseSubscriberType::PortType;
 
   protected:
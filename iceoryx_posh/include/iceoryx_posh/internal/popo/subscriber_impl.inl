@@ -34,19 +34,53 @@ inline SubscriberImpl<T, H, BaseSubscriberType>::SubscriberImpl(const capro::Ser
 template <typename T, typename H, typename BaseSubscriberType>
 inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T, H, BaseSubscriberType>::take() noexcept
 {
-    auto result = BaseSubscriberType::takeChunk();
+    uint32_t slotIndex{0U};
+    auto result = BaseSubscriberType::takeChunk(slotIndex);
     if (result.has_error())
     {
         return err(result.error());
     }
     auto userPayloadPtr = static_cast<const T*>(result.value()->userPayload());
-    auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this](const T* userPayload) {
+    // the sample carries the slot in which the chunk is held to release it without searching the used chunks
+    auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this, slotIndex](const T* userPayload) {
         auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
-        this->port().releaseChunk(chunkHeader);
+        this->port().releaseChunk(chunkHeader, slotIndex);
     });
     return ok<Sample<const T, const H>>(std::move(samplePtr));
 }
 
+template <typename T, typename H, typename BaseSubscriberType>
+template <typename Callable>
+inline expected<uint64_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::takeBatch(const uint64_t maxNumberOfSamples, Callable c) noexcept
+{
+    static_assert(is_invocable_r<void, Callable, const T&>::value,
+                  "callable provided to Subscriber<T>::takeBatch must have signature void(const T&)");
+
+    using ChunkHeaderBatch_t = vector<const mepoo::ChunkHeader*, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY>;
+    using SlotIndexBatch_t = vector<uint32_t, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY>;
+    const auto batchSize = std::min(maxNumberOfSamples, ChunkHeaderBatch_t::capacity());
+    ChunkHeaderBatch_t chunkHeaders(batchSize, nullptr);
+    SlotIndexBatch_t slotIndices(batchSize, 0U);
+
+    auto result = BaseSubscriberType::takeChunkBatch(span<const mepoo::ChunkHeader*>(chunkHeaders),
+                                                     span<uint32_t>(slotIndices));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    const auto numberOfSamples = result.value();
+    for (uint64_t i = 0U; i < numberOfSamples; ++i)
+    {
+        c(*static_cast<const T*>(chunkHeaders[i]->userPayload()));
+    }
+
+    this->port().releaseChunkBatch(span<const mepoo::ChunkHeader* const>(chunkHeaders.data(), numberOfSamples),
+                                   span<const uint32_t>(slotIndices.data(), numberOfSamples));
+    return ok(numberOfSamples);
+}
+
 template <typename T, typename H, typename BaseSubscriberType>
 inline SubscriberImpl<T, H, BaseSubscriberType>::~SubscriberImpl() noexcept
 {
@@ -20,7 +20,11 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/optional.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 
@@ -38,6 +42,10 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        The slot in which a chunk is stored is returned on insertion. When it is provided on removal, the chunk
+///        does not need to be searched and the removal takes constant time independent of the number of used chunks.
+///        The used slots are doubly linked, so that a slot can be unlinked in constant time and a removal by
+///        ChunkHeader only visits the used slots.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -49,9 +57,23 @@ class UsedChunkList
 
     /// @brief Inserts a SharedChunk into the list
     /// @param[in] chunk to store in the list
-    /// @return true if successful, otherwise false if e.g. the list is already full
+    /// @return the index of the slot in which the chunk is stored if successful, otherwise nullopt if e.g. the list
+    /// is already full
     /// @note only from runtime context
-    bool insert(mepoo::SharedChunk chunk) noexcept;
+    optional<uint32_t> insert(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief Inserts several SharedChunks into the list with a single memory synchronization
+    /// @param[in] chunks to store in the list
+    /// @param[out] slotIndices is filled with the index of the slot of each chunk; it must not be smaller than chunks
+    /// @return true if successful, otherwise false if there is not enough space for all chunks; in this case no chunk
+    /// is stored
+    /// @note only from runtime context
+    bool insert(const span<const mepoo::SharedChunk> chunks, const span<uint32_t> slotIndices) noexcept;
+
+    /// @brief Returns the number of chunks which can still be inserted
+    /// @return the number of free slots in the list
+    /// @note only from runtime context
+    uint32_t freeSlots() const noexcept;
 
     /// @brief Removes a chunk from the list
     /// @param[in] chunkHeader to look for a corresponding SharedChunk
@@ -60,6 +82,26 @@ class UsedChunkList
     /// @note only from runtime context
     bool remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Removes a chunk from the list without searching it
+    /// @param[in] slotIndex the index of the slot which was returned when the chunk was inserted
+    /// @param[in] chunkHeader of the chunk which is expected in the slot
+    /// @param[out] chunk which is removed
+    /// @return true if successfully removed, otherwise false if the slot does not contain the chunk with the
+    /// chunkHeader, e.g. because it was already removed
+    /// @note only from runtime context
+    bool remove(const uint32_t slotIndex, const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept;
+
+    /// @brief Removes several chunks from the list without searching them and with a single memory synchronization;
+    /// the chunks are released after the synchronization
+    /// @param[in] slotIndices the indices of the slots which were returned when the chunks were inserted
+    /// @param[in] chunkHeaders of the chunks which are expected in the slots
+    /// @return true if all chunks were removed, otherwise false if a slot does not contain the chunk with the
+    /// corresponding chunkHeader or if the number of slotIndices and chunkHeaders differ; the chunks which were found
+    /// are removed nevertheless
+    /// @note only from runtime context
+    bool remove(const span<const uint32_t> slotIndices,
+                const span<const mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Cleans up all the remaining chunks from the list.
     /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
     /// still running.
@@ -68,6 +110,14 @@ class UsedChunkList
   private:
     void init() noexcept;
 
+    uint32_t insertWithoutSynchronization(mepoo::SharedChunk chunk) noexcept;
+
+    void removeFromSlot(const uint32_t slotIndex, mepoo::SharedChunk& chunk) noexcept;
+
+    bool isInSlot(const uint32_t slotIndex, const mepoo::ChunkHeader* chunkHeader) const noexcept;
+
+    void removeFromSlotWithoutSynchronization(const uint32_t slotIndex, mepoo::SharedChunk& chunk) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
 
@@ -78,7 +128,9 @@ class UsedChunkList
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
     uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
+    uint32_t m_freeSlots{Capacity};
     uint32_t m_listIndices[Capacity];
+    uint32_t m_previousUsedIndices[Capacity];
     DataElement_t m_listData[Capacity];
 };
 
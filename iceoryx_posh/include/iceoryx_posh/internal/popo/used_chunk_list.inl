@@ -36,72 +36,169 @@ UsedChunkList<Capacity>::UsedChunkList() noexcept
 }
 
 template <uint32_t Capacity>
-bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
+optional<uint32_t> UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 {
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
-
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        m_listData[m_usedListHead] = DataElement_t(chunk);
-
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        const auto slotIndex = insertWithoutSynchronization(chunk);
 
         /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
         m_synchronizer.clear(std::memory_order_release);
-        return true;
+        return slotIndex;
     }
     else
+    {
+        return nullopt;
+    }
+}
+
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::insert(const span<const mepoo::SharedChunk> chunks,
+                                     const span<uint32_t> slotIndices) noexcept
+{
+    if (chunks.size() > m_freeSlots || chunks.size() > slotIndices.size())
     {
         return false;
     }
+
+    for (uint64_t i = 0U; i < chunks.size(); ++i)
+    {
+        slotIndices[i] = insertWithoutSynchronization(chunks[i]);
+    }
+
+    m_synchronizer.clear(std::memory_order_release);
+    return true;
 }
 
 template <uint32_t Capacity>
-bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+uint32_t UsedChunkList<Capacity>::freeSlots() const noexcept
+{
+    return m_freeSlots;
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::insertWithoutSynchronization(mepoo::SharedChunk chunk) noexcept
 {
-    auto previous = INVALID_INDEX;
+    // take the slot from the head of the free list
+    const auto slotIndex = m_freeListHead;
+    m_freeListHead = m_listIndices[slotIndex];
+
+    // the slot is getting the new head of the used list
+    m_listIndices[slotIndex] = m_usedListHead;
+    m_previousUsedIndices[slotIndex] = INVALID_INDEX;
+    if (m_usedListHead != INVALID_INDEX)
+    {
+        m_previousUsedIndices[m_usedListHead] = slotIndex;
+    }
+    m_usedListHead = slotIndex;
+
+    m_listData[slotIndex] = DataElement_t(chunk);
+    --m_freeSlots;
 
+    return slotIndex;
+}
+
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+{
     // go through usedList with stored chunks
     for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
     {
-        if (!m_listData[current].isLogicalNullptr())
+        // does the entry match the one we want to remove?
+        if (isInSlot(current, chunkHeader))
         {
-            // does the entry match the one we want to remove?
-            if (m_listData[current].getChunkHeader() == chunkHeader)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
+            removeFromSlot(current, chunk);
+            return true;
         }
-        previous = current;
     }
     return false;
 }
 
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::remove(const uint32_t slotIndex,
+                                     const mepoo::ChunkHeader* chunkHeader,
+                                     mepoo::SharedChunk& chunk) noexcept
+{
+    if (!isInSlot(slotIndex, chunkHeader))
+    {
+        return false;
+    }
+
+    removeFromSlot(slotIndex, chunk);
+    return true;
+}
+
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::remove(const span<const uint32_t> slotIndices,
+                                     const span<const mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    // the chunks are kept until the synchronization is done, so that they are not released while they are still
+    // visible in the list
+    vector<mepoo::SharedChunk, Capacity> chunks;
+    const uint64_t numberOfChunks = std::min(slotIndices.size(), chunkHeaders.size());
+    bool areAllChunksRemoved = (slotIndices.size() == chunkHeaders.size());
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        if (!isInSlot(slotIndices[i], chunkHeaders[i]))
+        {
+            areAllChunksRemoved = false;
+            continue;
+        }
+
+        chunks.emplace_back(nullptr);
+        removeFromSlotWithoutSynchronization(slotIndices[i], chunks.back());
+    }
+
+    /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
+    m_synchronizer.clear(std::memory_order_release);
+    return areAllChunksRemoved;
+}
+
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::isInSlot(const uint32_t slotIndex, const mepoo::ChunkHeader* chunkHeader) const noexcept
+{
+    return slotIndex < Capacity && !m_listData[slotIndex].isLogicalNullptr()
+           && m_listData[slotIndex].getChunkHeader() == chunkHeader;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::removeFromSlot(const uint32_t slotIndex, mepoo::SharedChunk& chunk) noexcept
+{
+    removeFromSlotWithoutSynchronization(slotIndex, chunk);
+
+    /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
+    m_synchronizer.clear(std::memory_order_release);
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::removeFromSlotWithoutSynchronization(const uint32_t slotIndex,
+                                                                   mepoo::SharedChunk& chunk) noexcept
+{
+    chunk = m_listData[slotIndex].releaseToSharedChunk();
+
+    // remove index from used list
+    const auto next = m_listIndices[slotIndex];
+    const auto previous = m_previousUsedIndices[slotIndex];
+    if (previous == INVALID_INDEX)
+    {
+        m_usedListHead = next;
+    }
+    else
+    {
+        m_listIndices[previous] = next;
+    }
+    if (next != INVALID_INDEX)
+    {
+        m_previousUsedIndices[next] = previous;
+    }
+
+    // insert index to free list
+    m_listIndices[slotIndex] = m_freeListHead;
+    m_freeListHead = slotIndex;
+    ++m_freeSlots;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
@@ -137,9 +234,14 @@ void UsedChunkList<Capacity>::init() noexcept
         m_listIndices[0U] = INVALID_INDEX;
     }
 
+    for (auto& previous : m_previousUsedIndices)
+    {
+        previous = INVALID_INDEX;
+    }
 
     m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
+    m_freeSlots = Capacity;
 
     // clear data
     for (auto& data : m_listData)
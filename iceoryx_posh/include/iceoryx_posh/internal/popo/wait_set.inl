@@ -73,14 +73,20 @@ uniqueMergeSortedNotificationVector(const ConditionListener::NotificationVector_
 
 template <uint64_t Capacity>
 inline WaitSet<Capacity>::WaitSet() noexcept
-    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable())
+    : WaitSet(WaitStrategy())
 {
 }
 
 template <uint64_t Capacity>
-inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData) noexcept
+inline WaitSet<Capacity>::WaitSet(const WaitStrategy& waitStrategy) noexcept
+    : WaitSet(*runtime::PoshRuntime::getInstance().getMiddlewareConditionVariable(), waitStrategy)
+{
+}
+
+template <uint64_t Capacity>
+inline WaitSet<Capacity>::WaitSet(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy) noexcept
     : m_conditionVariableDataPtr(&condVarData)
-    , m_conditionListener(condVarData)
+    , m_conditionListener(condVarData, waitStrategy)
 {
     for (uint64_t i = 0U; i < Capacity; ++i)
     {
@@ -93,6 +99,7 @@ inline WaitSet<Capacity>::~WaitSet() noexcept
 {
     removeAllTriggers();
     m_conditionVariableDataPtr->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    m_conditionVariableDataPtr->m_discoveryRequester.requestDiscovery();
 }
 
 template <uint64_t Capacity>
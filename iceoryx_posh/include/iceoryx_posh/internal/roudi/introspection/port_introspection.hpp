@@ -51,6 +51,7 @@ class PortIntrospection
 
     using PortIntrospectionTopic = PortIntrospectionFieldTopic;
     using PortThroughputIntrospectionTopic = PortThroughputIntrospectionFieldTopic;
+    using PortLatencyIntrospectionTopic = PortLatencyIntrospectionFieldTopic;
 
     class PortData
     {
@@ -182,6 +183,11 @@ class PortIntrospection
 
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
 
+        /// @brief prepare the latency topic from the latency histograms of the tracked ports; the lists are empty when
+        ///        the latency instrumentation is disabled
+        /// @param[out] topic data structure to be prepared for sending
+        void prepareTopic(PortLatencyIntrospectionTopic& topic) noexcept;
+
         /// @brief compute the next connection state based on the current connection state and a capro message type when
         /// the communication policy is OneToMany
         /// @param[in] currentState current connection state (e.g. CONNECTED)
@@ -209,6 +215,19 @@ class PortIntrospection
         void setNew(bool value) noexcept;
 
       private:
+        static LatencyPercentiles toLatencyPercentiles(const popo::LatencyHistogram& histogram) noexcept;
+
+        /// @brief the overloads for the NoLatencyHistograms are only required to compile without latency
+        ///        instrumentation and do nothing
+        static void fillLatencyData(PublisherPortLatencyData& latencyData,
+                                    const popo::ChunkSenderLatencyHistograms& histograms) noexcept;
+        static void fillLatencyData(PublisherPortLatencyData& latencyData,
+                                    const popo::NoLatencyHistograms& histograms) noexcept;
+        static void fillLatencyData(SubscriberPortLatencyData& latencyData,
+                                    const popo::ChunkReceiverLatencyHistograms& histograms) noexcept;
+        static void fillLatencyData(SubscriberPortLatencyData& latencyData,
+                                    const popo::NoLatencyHistograms& histograms) noexcept;
+
         using PublisherContainer = FixedPositionContainer<PublisherInfo, MAX_PUBLISHERS>;
         using ConnectionContainer = FixedPositionContainer<ConnectionInfo, MAX_SUBSCRIBERS>;
 
@@ -283,6 +302,12 @@ class PortIntrospection
                                PublisherPort&& publisherPortThroughput,
                                PublisherPort&& publisherPortSubscriberPortsData) noexcept;
 
+    /// @brief register the publisher port used to send the latency introspection; this is optional and only done when
+    ///        the latency instrumentation is enabled
+    /// @param[in] publisherPortLatency publisher port to be registered
+    /// @return true if registration was successful, false otherwise
+    bool registerLatencyPublisherPort(PublisherPort&& publisherPortLatency) noexcept;
+
     /// @brief set the time interval used to send new introspection data
     /// @param[in] interval duration between two send invocations
     void setSendInterval(const units::Duration interval) noexcept;
@@ -304,13 +329,17 @@ class PortIntrospection
     /// @brief sends the subscriberport changing data, this is used from the unittests
     void sendSubscriberPortsData() noexcept;
 
-    /// @brief calls the three specific send functions from above, this is used from the periodic task
+    /// @brief sends the latency data if the latency publisher port is registered, this is used from the unittests
+    void sendLatencyData() noexcept;
+
+    /// @brief calls the specific send functions from above, this is used from the periodic task
     void send() noexcept;
 
   protected:
     optional<PublisherPort> m_publisherPort;
     optional<PublisherPort> m_publisherPortThroughput;
     optional<PublisherPort> m_publisherPortSubscriberPortsData;
+    optional<PublisherPort> m_publisherPortLatency;
 
   private:
     PortData m_portData;
@@ -71,6 +71,20 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherP
     return true;
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerLatencyPublisherPort(
+    PublisherPort&& publisherPortLatency) noexcept
+{
+    if (m_publisherPortLatency)
+    {
+        return false;
+    }
+
+    m_publisherPortLatency.emplace(std::move(publisherPortLatency));
+
+    return true;
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
 {
@@ -82,9 +96,14 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
     sendPortData();
     sendThroughputData();
     sendSubscriberPortsData();
+    sendLatencyData();
     m_publisherPort->offer();
     m_publisherPortThroughput->offer();
     m_publisherPortSubscriberPortsData->offer();
+    if (m_publisherPortLatency)
+    {
+        m_publisherPortLatency->offer();
+    }
 
     m_publishingTask.start(m_sendInterval);
 }
@@ -98,6 +117,7 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::send() noexcept
     }
     sendThroughputData();
     sendSubscriberPortsData();
+    sendLatencyData();
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -157,6 +177,29 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::sendSubscriberPort
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::sendLatencyData() noexcept
+{
+    if (!m_publisherPortLatency)
+    {
+        return;
+    }
+
+    auto maybeChunkHeader = m_publisherPortLatency->tryAllocateChunk(sizeof(PortLatencyIntrospectionFieldTopic),
+                                                                     alignof(PortLatencyIntrospectionFieldTopic),
+                                                                     CHUNK_NO_USER_HEADER_SIZE,
+                                                                     CHUNK_NO_USER_HEADER_ALIGNMENT);
+    if (maybeChunkHeader.has_value())
+    {
+        auto latencySample = static_cast<PortLatencyIntrospectionFieldTopic*>(maybeChunkHeader.value()->userPayload());
+        new (latencySample) PortLatencyIntrospectionFieldTopic();
+
+        m_portData.prepareTopic(*latencySample); // requires internal mutex (blocks
+        // further introspection events)
+        m_publisherPortLatency->sendChunk(maybeChunkHeader.value());
+    }
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::setSendInterval(const units::Duration interval) noexcept
 {
@@ -635,6 +678,97 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void
+PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortLatencyIntrospectionTopic& topic) noexcept
+{
+    if (!build::IOX_LATENCY_INSTRUMENTATION)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // same order as in the PortIntrospectionTopic
+    for (auto& pub : m_publisherMap)
+    {
+        for (auto& pair : pub.second)
+        {
+            auto publisherIndex = pair.second;
+            if (publisherIndex >= 0)
+            {
+                auto publisherInfo = m_publisherContainer.iter_from_index(publisherIndex);
+                PublisherPortLatencyData latencyData;
+                PublisherPort port(publisherInfo->portData);
+                latencyData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
+                fillLatencyData(latencyData, publisherInfo->portData->m_chunkSenderData.m_latencyHistograms);
+                topic.m_publisherLatencyList.emplace_back(latencyData);
+            }
+        }
+    }
+
+    for (auto& connPair : m_connectionMap)
+    {
+        for (auto& pair : connPair.second)
+        {
+            auto connectionIndex = pair.second;
+            if (connectionIndex >= 0)
+            {
+                auto connection = m_connectionContainer.iter_from_index(connectionIndex);
+                auto& subscriberInfo = connection->subscriberInfo;
+                SubscriberPortLatencyData latencyData;
+                if (subscriberInfo.portData != nullptr)
+                {
+                    fillLatencyData(latencyData, subscriberInfo.portData->m_chunkReceiverData.m_latencyHistograms);
+                }
+                // the subscriber is always added to keep the index in sync with the PortIntrospectionTopic
+                topic.m_subscriberLatencyList.emplace_back(latencyData);
+            }
+        }
+    }
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline LatencyPercentiles PortIntrospection<PublisherPort, SubscriberPort>::PortData::toLatencyPercentiles(
+    const popo::LatencyHistogram& histogram) noexcept
+{
+    LatencyPercentiles percentiles;
+    percentiles.m_sampleCount = histogram.sampleCount();
+    percentiles.m_p50Nanoseconds = histogram.valueAtPercentile(50.0);
+    percentiles.m_p90Nanoseconds = histogram.valueAtPercentile(90.0);
+    percentiles.m_p99Nanoseconds = histogram.valueAtPercentile(99.0);
+    percentiles.m_p999Nanoseconds = histogram.valueAtPercentile(99.9);
+    percentiles.m_maxNanoseconds = histogram.maximum();
+    return percentiles;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::fillLatencyData(
+    PublisherPortLatencyData& latencyData, const popo::ChunkSenderLatencyHistograms& histograms) noexcept
+{
+    latencyData.m_loanToPublish = toLatencyPercentiles(histograms.loanToPublish);
+    latencyData.m_publishToDelivery = toLatencyPercentiles(histograms.publishToDelivery);
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::fillLatencyData(
+    PublisherPortLatencyData&, const popo::NoLatencyHistograms&) noexcept
+{
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::fillLatencyData(
+    SubscriberPortLatencyData& latencyData, const popo::ChunkReceiverLatencyHistograms& histograms) noexcept
+{
+    latencyData.m_publishToTake = toLatencyPercentiles(histograms.publishToTake);
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::fillLatencyData(
+    SubscriberPortLatencyData&, const popo::NoLatencyHistograms&) noexcept
+{
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::PortData::isNew() const noexcept
 {
@@ -35,12 +35,14 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_changes.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
 #include "iox/type_traits.hpp"
 
@@ -52,6 +54,9 @@ namespace roudi
 {
 capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept;
 
+/// @brief Creates, connects and destroys the ports in the PortPool
+/// @note the public methods are thread-safe; they are serialized by a mutex which is held only while the PortPool and
+/// the ServiceRegistry are modified, so that requests for different processes can be handled concurrently
 class PortManager
 {
   public:
@@ -63,8 +68,17 @@ class PortManager
     /// @todo iox-#518 Remove this later
     void stopPortIntrospection() noexcept;
 
+    /// @brief Does the discovery for all entries of the PortPool
     void doDiscovery() noexcept;
 
+    /// @brief Does the discovery only for the PortPool entries which requested it since the last call; falls back to
+    /// doDiscovery if not all requests could be enqueued
+    void handleDiscoveryRequests() noexcept;
+
+    /// @brief The queue with the discovery requests, e.g. to wait for new requests
+    /// @return reference to the DiscoveryRequestQueueData in the PortPool
+    popo::DiscoveryRequestQueueData& discoveryRequestQueue() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -111,6 +125,60 @@ class PortManager
                           mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                           const PortConfigInfo& portConfigInfo) noexcept;
 
+    /// @brief Acquires the port data within acquirePortDataBatch, i.e. while the PortManager is already locked
+    class PortDataBatch
+    {
+      public:
+        PortDataBatch(const PortDataBatch&) = delete;
+        PortDataBatch(PortDataBatch&&) = delete;
+        PortDataBatch& operator=(const PortDataBatch&) = delete;
+        PortDataBatch& operator=(PortDataBatch&&) = delete;
+        ~PortDataBatch() noexcept = default;
+
+        /// @brief see PortManager::acquirePublisherPortData
+        expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
+        acquirePublisherPortData(const capro::ServiceDescription& service,
+                                 const popo::PublisherOptions& publisherOptions,
+                                 const RuntimeName_t& runtimeName,
+                                 mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                 const PortConfigInfo& portConfigInfo) noexcept;
+
+        /// @brief see PortManager::acquireSubscriberPortData
+        expected<SubscriberPortType::MemberType_t*, PortPoolError>
+        acquireSubscriberPortData(const capro::ServiceDescription& service,
+                                  const popo::SubscriberOptions& subscriberOptions,
+                                  const RuntimeName_t& runtimeName,
+                                  const PortConfigInfo& portConfigInfo) noexcept;
+
+        /// @brief see PortManager::acquireClientPortData
+        expected<popo::ClientPortData*, PortPoolError>
+        acquireClientPortData(const capro::ServiceDescription& service,
+                              const popo::ClientOptions& clientOptions,
+                              const RuntimeName_t& runtimeName,
+                              mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                              const PortConfigInfo& portConfigInfo) noexcept;
+
+        /// @brief see PortManager::acquireServerPortData
+        expected<popo::ServerPortData*, PortPoolError>
+        acquireServerPortData(const capro::ServiceDescription& service,
+                              const popo::ServerOptions& serverOptions,
+                              const RuntimeName_t& runtimeName,
+                              mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                              const PortConfigInfo& portConfigInfo) noexcept;
+
+      private:
+        friend class PortManager;
+        explicit PortDataBatch(PortManager& portManager) noexcept;
+
+        PortManager& m_portManager;
+    };
+
+    /// @brief Locks the PortManager only once to acquire several ports, e.g. all ports which a runtime requested with
+    /// a single message
+    /// @param[in] acquirePorts is called with the lock held; it must acquire the ports via the provided PortDataBatch
+    /// and must not call any other method of the PortManager
+    void acquirePortDataBatch(const function_ref<void(PortDataBatch&)> acquirePorts) noexcept;
+
     popo::InterfacePortData* acquireInterfacePortData(capro::Interfaces interface,
                                                       const RuntimeName_t& runtimeName,
                                                       const NodeName_t& nodeName = {""}) noexcept;
@@ -131,6 +199,8 @@ class PortManager
     void deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept;
 
   protected:
+    void doDiscoveryForAllPorts() noexcept;
+
     void makeAllPublisherPortsToStopOffer() noexcept;
 
     void destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept;
@@ -161,10 +231,15 @@ class PortManager
 
     void handleInterfaces() noexcept;
 
+    void forwardOffersToNewInterfacePorts(
+        const vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>& interfacePortsForInitialForwarding) noexcept;
+
     void handleNodes() noexcept;
 
     void handleConditionVariables() noexcept;
 
+    void handleDiscoveryRequest(const popo::DiscoveryRequest& request) noexcept;
+
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
 
@@ -189,6 +264,11 @@ class PortManager
     void addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept;
     void removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept;
 
+    /// @brief records a change for the next publication of the service registry changes if the registry was modified
+    void recordServiceRegistryChange(const uint64_t previousSequenceNumber,
+                                     const ServiceRegistryChange::Type type,
+                                     const capro::ServiceDescription& service) noexcept;
+
     template <typename T, std::enable_if_t<std::is_same<T, iox::build::OneToManyPolicy>::value>* = nullptr>
     optional<RuntimeName_t> doesViolateCommunicationPolicy(const capro::ServiceDescription& service) noexcept;
 
@@ -199,6 +279,8 @@ class PortManager
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
     void publishServiceRegistry() noexcept;
+    bool publishServiceRegistrySnapshot() noexcept;
+    bool publishServiceRegistryChanges() noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
@@ -209,6 +291,11 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryChangesPublisherPortData;
+    ServiceRegistryChanges m_serviceRegistryChanges;
+    uint64_t m_serviceRegistryChangesSinceSnapshot{0U};
+    bool m_isServiceRegistrySnapshotRequired{true};
+    std::mutex m_mutex;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -219,6 +306,35 @@ class PortManager
                                              mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                              const PortConfigInfo& portConfigInfo) noexcept;
 
+    // the acquisition of the ports which are used by acquirePortDataBatch and by the public methods, which lock
+    // the PortManager for each port
+    expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
+    acquirePublisherPortDataWithoutLock(const capro::ServiceDescription& service,
+                                        const popo::PublisherOptions& publisherOptions,
+                                        const RuntimeName_t& runtimeName,
+                                        mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                        const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<SubscriberPortType::MemberType_t*, PortPoolError>
+    acquireSubscriberPortDataWithoutLock(const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions,
+                                         const RuntimeName_t& runtimeName,
+                                         const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<popo::ClientPortData*, PortPoolError>
+    acquireClientPortDataWithoutLock(const capro::ServiceDescription& service,
+                                     const popo::ClientOptions& clientOptions,
+                                     const RuntimeName_t& runtimeName,
+                                     mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                     const PortConfigInfo& portConfigInfo) noexcept;
+
+    expected<popo::ServerPortData*, PortPoolError>
+    acquireServerPortDataWithoutLock(const capro::ServiceDescription& service,
+                                     const popo::ServerOptions& serverOptions,
+                                     const RuntimeName_t& runtimeName,
+                                     mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                     const PortConfigInfo& portConfigInfo) noexcept;
+
     PublisherPortRouDiType::MemberType_t* acquireInternalPublisherPortDataWithoutDiscovery(
         const capro::ServiceDescription& service,
         const popo::PublisherOptions& publisherOptions,
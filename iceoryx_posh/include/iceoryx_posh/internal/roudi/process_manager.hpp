@@ -25,12 +25,18 @@
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
+#include "iox/expected.hpp"
 #include "iox/list.hpp"
+#include "iox/optional.hpp"
+#include "iox/vector.hpp"
 
+#include <chrono>
 #include <cstdint>
 #include <ctime>
+#include <shared_mutex>
 
 namespace iox
 {
@@ -44,11 +50,16 @@ class ProcessManagerInterface
     virtual ~ProcessManagerInterface() noexcept = default;
 };
 
+/// @brief Manages the registered processes and their requests to RouDi
+/// @note the methods can be called concurrently, e.g. by the runtime message workers of RouDi for different processes;
+/// the requests of registered processes share the access to the process list while the registration and the removal
+/// of processes need exclusive access; the PortManager synchronizes the access to the ports itself
 class ProcessManager : public ProcessManagerInterface
 {
   public:
     using ProcessList_t = iox::list<Process, MAX_PROCESS_NUMBER>;
     using PortConfigInfo = iox::runtime::PortConfigInfo;
+    using PortRequests_t = vector<runtime::PortRequest, MAX_NUMBER_OF_PORTS_PER_REQUEST>;
 
     enum class TerminationFeedback
     {
@@ -146,12 +157,28 @@ class ProcessManager : public ProcessManagerInterface
                              const popo::ServerOptions& serverOptions,
                              const PortConfigInfo& portConfigInfo) noexcept;
 
+    /// @brief Creates all requested ports for a process in one pass and sends them to the OS process with a single
+    /// CREATE_PORTS_ACK message; the response for each port is identical to the response to a single request
+    /// @param[in] name is the name of the runtime requesting the ports
+    /// @param[in] requests the ports to create
+    void addPortsForProcess(const RuntimeName_t& name, const PortRequests_t& requests) noexcept;
+
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
+    /// @brief Does the discovery for all ports; the monitoring of the processes is done separately by
+    /// monitorProcesses
     void run() noexcept;
 
+    /// @brief Checks the heartbeats of the monitored processes and removes the processes whose beat count did not
+    /// change for longer than the PROCESS_KEEP_ALIVE_TIMEOUT
+    /// @note the runtime time of a check is linear in the number of monitored processes
+    void monitorProcesses() noexcept;
+
+    /// @brief Does the discovery only for the ports, nodes and condition variables which requested it
+    void handleDiscoveryRequests() noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
@@ -159,24 +186,57 @@ class ProcessManager : public ProcessManagerInterface
 
 
   private:
+    using PortResult_t = expected<UntypedRelativePointer::offset_t, runtime::IpcMessageErrorType>;
+
+    /// @note requires shared or exclusive access to the process list
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
 
-    void monitorProcesses() noexcept;
+    /// @brief sends the REG_ACK with the information to access the shared memory to a newly registered process
+    void sendRegistrationAck(Process& process, const int64_t transmissionTimestamp) noexcept;
+
+    PortResult_t createPublisherPort(PortManager::PortDataBatch& portDataBatch,
+                                     Process& process,
+                                     const capro::ServiceDescription& service,
+                                     const popo::PublisherOptions& publisherOptions,
+                                     const PortConfigInfo& portConfigInfo) noexcept;
+
+    PortResult_t createSubscriberPort(PortManager::PortDataBatch& portDataBatch,
+                                      Process& process,
+                                      const capro::ServiceDescription& service,
+                                      const popo::SubscriberOptions& subscriberOptions,
+                                      const PortConfigInfo& portConfigInfo) noexcept;
+
+    PortResult_t createClientPort(PortManager::PortDataBatch& portDataBatch,
+                                  Process& process,
+                                  const capro::ServiceDescription& service,
+                                  const popo::ClientOptions& clientOptions,
+                                  const PortConfigInfo& portConfigInfo) noexcept;
+
+    PortResult_t createServerPort(PortManager::PortDataBatch& portDataBatch,
+                                  Process& process,
+                                  const capro::ServiceDescription& service,
+                                  const popo::ServerOptions& serverOptions,
+                                  const PortConfigInfo& portConfigInfo) noexcept;
+
+    /// @brief adds the ACK with the relative pointer to the port or the error to the response for the process
+    void addPortResponse(runtime::IpcMessage& sendBuffer,
+                         const runtime::IpcMessageType ackType,
+                         const PortResult_t& result) const noexcept;
+
     void discoveryUpdate() noexcept override;
 
     /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
     /// @param [in] pid is the host system process id
     /// @param [in] user is user used in the operating system for this process
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
-    /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
     /// @return Returns if the process could be added successfully.
+    /// @note requires exclusive access to the process list; the REG_ACK is sent by the caller
     bool addProcess(const RuntimeName_t& name,
                     const uint32_t pid,
                     const posix::PosixUser& user,
                     const bool isMonitored,
-                    const int64_t transmissionTimestamp,
                     const uint64_t sessionId,
                     const version::VersionInfo& versionInfo) noexcept;
 
@@ -232,6 +292,18 @@ class ProcessManager : public ProcessManagerInterface
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
     HeartbeatPool* m_heartbeatPool;
+    /// @brief guards m_processList, m_monitoredProcesses and the HeartbeatPool
+    mutable std::shared_timed_mutex m_processListMutex;
+
+    /// @brief The state of the monitoring of a process with a heartbeat
+    struct MonitoredProcess
+    {
+        optional<ProcessList_t::iterator> process;
+        uint64_t lastBeatCount{0U};
+        std::chrono::steady_clock::time_point lastBeatCountChange;
+    };
+    /// @brief Indexed by the heartbeat pool index in order to find the process of a heartbeat in constant time
+    vector<MonitoredProcess, MAX_PROCESS_NUMBER> m_monitoredProcesses{MAX_PROCESS_NUMBER};
 };
 
 } // namespace roudi
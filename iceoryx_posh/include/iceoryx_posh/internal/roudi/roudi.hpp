@@ -17,19 +17,19 @@
 #ifndef IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 #define IOX_POSH_ROUDI_ROUDI_MULTI_PROCESS_HPP
 
-#include "iceoryx_hoofs/internal/concurrent/smart_lock.hpp"
+#include "iceoryx_hoofs/concurrent/lockfree_queue.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_platform/file.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
-#include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/scope_guard.hpp"
+#include "iox/vector.hpp"
 
 #include <cstdint>
 #include <thread>
@@ -59,13 +59,15 @@ class RouDi
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
             const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
-            const units::Duration processTerminationDelay = roudi::PROCESS_DEFAULT_TERMINATION_DELAY) noexcept
+            const units::Duration processTerminationDelay = roudi::PROCESS_DEFAULT_TERMINATION_DELAY,
+            const uint32_t runtimeMessageWorkers = roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
             , m_processTerminationDelay(processTerminationDelay)
+            , m_runtimeMessageWorkers(runtimeMessageWorkers)
         {
         }
 
@@ -75,6 +77,10 @@ class RouDi
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
         const units::Duration m_processTerminationDelay;
+        /// @brief the number of threads which handle the messages from the runtimes, limited to
+        /// MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS; with a single worker the messages are handled by the thread which
+        /// receives them
+        const uint32_t m_runtimeMessageWorkers;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -86,13 +92,14 @@ class RouDi
 
     virtual ~RouDi() noexcept;
 
-    /// @brief Triggers the discovery loop to run immediately instead of waiting for the next tick interval
+    /// @brief Triggers a discovery run for all ports; usually the discovery loop only handles the ports which
+    /// requested a discovery
     /// @param[in] timeout is the time to wait to unblock the function call in case the discovery loop never signals to
     /// have finished the run
     void triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcept;
 
   protected:
-    /// @brief Starts the thread processing messages from the runtimes
+    /// @brief Starts the thread processing messages from the runtimes and the runtime message workers
     /// Once this is done, applications can register and Roudi is fully operational.
     void startProcessRuntimeMessagesThread() noexcept;
 
@@ -101,6 +108,10 @@ class RouDi
     ///
     /// @note Intentionally not virtual to be able to call it in derived class
     void shutdown() noexcept;
+
+    /// @brief Handles a message from a runtime
+    /// @note with more than one runtime message worker, this is called concurrently for messages from different
+    /// runtimes; the messages from one runtime are always handled in order by the same worker
     virtual void processMessage(const runtime::IpcMessage& message,
                                 const iox::runtime::IpcMessageType& cmd,
                                 const RuntimeName_t& runtimeName) noexcept;
@@ -112,6 +123,13 @@ class RouDi
                                               uid_t& userId,
                                               int64_t& transmissionTimestamp) noexcept;
 
+    /// @brief deserializes the port requests of a CREATE_PORTS message in a single pass over the message
+    /// @param[in] message the CREATE_PORTS message
+    /// @param[out] requests the deserialized port requests
+    /// @return true if all port requests could be deserialized, false otherwise
+    bool parseCreatePortsMessage(const runtime::IpcMessage& message,
+                                 ProcessManager::PortRequests_t& requests) noexcept;
+
     /// @brief Handles the registration request from process
     /// @param [in] name of the process which wants to register at roudi; this is equal to the IPC channel name
     /// @param [in] pid is the host system process id
@@ -131,19 +149,48 @@ class RouDi
     static uint64_t getUniqueSessionIdForProcess() noexcept;
 
   private:
+    /// @brief A message from a runtime with the already parsed message type and runtime name
+    struct RuntimeMessage
+    {
+        runtime::IpcMessage message;
+        runtime::IpcMessageType cmd{runtime::IpcMessageType::NOTYPE};
+        RuntimeName_t runtimeName;
+    };
+
+    static constexpr uint64_t RUNTIME_MESSAGE_QUEUE_CAPACITY{32U};
+
+    /// @brief A thread which handles the messages of the runtimes assigned to it
+    struct RuntimeMessageWorker
+    {
+        concurrent::LockFreeQueue<RuntimeMessage, RUNTIME_MESSAGE_QUEUE_CAPACITY> queue;
+        optional<posix::UnnamedSemaphore> wakeUpSemaphore;
+        std::thread thread;
+    };
+
     void processRuntimeMessages() noexcept;
 
-    void monitorAndDiscoveryUpdate() noexcept;
+    /// @brief Passes the message to the worker of its runtime; waits while the queue of the worker is full
+    void dispatchRuntimeMessage(RuntimeMessage&& runtimeMessage) noexcept;
+
+    void handleRuntimeMessages(RuntimeMessageWorker& worker) noexcept;
+
+    void discoveryUpdate() noexcept;
+
+    void monitorProcesses() noexcept;
+
+    void triggerDiscoveryLoop() noexcept;
 
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
     bool m_killProcessesInDestructor;
-    std::atomic_bool m_runMonitoringAndDiscoveryThread;
+    std::atomic_bool m_runDiscoveryThread;
+    std::atomic_bool m_runMonitoringThread;
     std::atomic_bool m_runHandleRuntimeMessageThread;
 
-    popo::UserTrigger m_discoveryLoopTrigger;
     optional<iox::posix::UnnamedSemaphore> m_discoveryFinishedSemaphore;
+    optional<iox::posix::UnnamedSemaphore> m_monitoringWakeUpSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
+    uint32_t m_numberOfRuntimeMessageWorkers{roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS};
 
   protected:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
@@ -157,11 +204,16 @@ class RouDi
         };
     }};
     PortManager* m_portManager{nullptr};
-    concurrent::smart_lock<ProcessManager> m_prcMgr;
+    /// @note the ProcessManager synchronizes the runtime message workers, the discovery and the monitoring thread
+    /// itself, so that the requests of different runtimes can be handled in parallel
+    ProcessManager m_prcMgr;
 
   private:
-    std::thread m_monitoringAndDiscoveryThread;
+    std::thread m_discoveryThread;
+    std::thread m_monitoringThread;
     std::thread m_handleRuntimeMessageThread;
+    /// @brief empty with a single worker, since then the messages are handled by the receiving thread
+    vector<RuntimeMessageWorker, MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS> m_runtimeMessageWorkers;
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
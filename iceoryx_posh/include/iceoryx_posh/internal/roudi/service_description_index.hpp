@@ -0,0 +1,120 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_HPP
+#define IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iox/function_ref.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+namespace detail
+{
+/// @brief the smallest power of two which is at least twice the capacity keeps the probe sequences short
+constexpr uint32_t numberOfServiceDescriptionIndexBuckets(const uint32_t capacity,
+                                                          const uint32_t numberOfBuckets = 1U) noexcept
+{
+    return (numberOfBuckets >= 2U * capacity) ? numberOfBuckets
+                                              : numberOfServiceDescriptionIndexBuckets(capacity, 2U * numberOfBuckets);
+}
+} // namespace detail
+
+/// @brief Fixed capacity open addressing hash index which groups the slots of an external container, e.g. the
+/// ServiceRegistry or the PortPool, by a key which is derived from a ServiceDescription, e.g. the whole
+/// ServiceDescription or only the service string. The keys are not stored in the index but obtained from the
+/// external container via the 'hasKey' callable. All slots with the same key are chained in ascending order,
+/// therefore a lookup costs O(number of matches) and iterates the slots in the same order as a linear search.
+/// @note The index does not contain pointers and can therefore be copied, e.g. as part of the ServiceRegistry
+/// which is sent via shared memory
+/// @tparam Capacity of the external container; the slots must be smaller than the capacity
+template <uint32_t Capacity>
+class ServiceDescriptionIndex
+{
+  public:
+    using Slot_t = uint32_t;
+    using Hash_t = uint64_t;
+    /// @brief returns true when the provided slot has the key which is looked up
+    using HasKey_t = function_ref<bool(const Slot_t)>;
+
+    static constexpr Slot_t NO_SLOT{Capacity};
+
+    ServiceDescriptionIndex() noexcept;
+
+    /// @brief Hash of a single id string, e.g. to look up all slots with a specific service
+    static Hash_t hash(const capro::IdString_t& id) noexcept;
+
+    /// @brief Hash of a whole service description; only the service, instance and event strings are considered
+    static Hash_t hash(const capro::IdString_t& service,
+                       const capro::IdString_t& instance,
+                       const capro::IdString_t& event) noexcept;
+
+    /// @brief Hash of a whole service description; only the service, instance and event strings are considered
+    static Hash_t hash(const capro::ServiceDescription& serviceDescription) noexcept;
+
+    /// @brief Looks up the first slot with the key
+    /// @param[in] hash of the key
+    /// @param[in] hasKey checks whether a slot has the key
+    /// @return the smallest slot with the key or NO_SLOT if there is none
+    Slot_t find(const Hash_t hash, const HasKey_t& hasKey) const noexcept;
+
+    /// @brief Iterates over all slots with the same key
+    /// @param[in] slot which is contained in the index
+    /// @return the next larger slot with the same key or NO_SLOT if there is none
+    Slot_t next(const Slot_t slot) const noexcept;
+
+    /// @brief Adds a slot to the index; the external container must already contain the key for this slot
+    /// @param[in] slot to add, must not be contained in the index
+    /// @param[in] hash of the key of the slot
+    /// @param[in] hasKey checks whether a slot has the same key as the slot to add
+    void insert(const Slot_t slot, const Hash_t hash, const HasKey_t& hasKey) noexcept;
+
+    /// @brief Removes a slot from the index; the external container must still contain the key for this slot
+    /// @param[in] slot to remove, nothing happens if it is not contained in the index
+    /// @param[in] hash of the key of the slot
+    /// @param[in] hasKey checks whether a slot has the same key as the slot to remove
+    void remove(const Slot_t slot, const Hash_t hash, const HasKey_t& hasKey) noexcept;
+
+  private:
+    static constexpr uint32_t NUMBER_OF_BUCKETS{detail::numberOfServiceDescriptionIndexBuckets(Capacity)};
+    static constexpr uint32_t BUCKET_MASK{NUMBER_OF_BUCKETS - 1U};
+    static constexpr uint32_t NO_BUCKET{NUMBER_OF_BUCKETS};
+
+    struct Bucket
+    {
+        Slot_t head{NO_SLOT};
+        uint32_t hash{0U};
+    };
+
+    uint32_t findBucket(const Hash_t hash, const HasKey_t& hasKey) const noexcept;
+    void eraseBucket(const uint32_t bucket) noexcept;
+
+    // NOLINTBEGIN(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) fixed size storage without indirection
+    Bucket m_buckets[NUMBER_OF_BUCKETS];
+    Slot_t m_next[Capacity];
+    Slot_t m_previous[Capacity];
+    // NOLINTEND(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+};
+
+} // namespace roudi
+} // namespace iox
+
+#include "iceoryx_posh/internal/roudi/service_description_index.inl"
+
+#endif // IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_HPP
@@ -0,0 +1,225 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_INL
+#define IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_INL
+
+#include "iceoryx_posh/internal/roudi/service_description_index.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+template <uint32_t Capacity>
+constexpr typename ServiceDescriptionIndex<Capacity>::Slot_t ServiceDescriptionIndex<Capacity>::NO_SLOT;
+
+template <uint32_t Capacity>
+inline ServiceDescriptionIndex<Capacity>::ServiceDescriptionIndex() noexcept
+{
+    for (uint32_t i = 0U; i < Capacity; ++i)
+    {
+        m_next[i] = NO_SLOT;
+        m_previous[i] = NO_SLOT;
+    }
+}
+
+template <uint32_t Capacity>
+inline typename ServiceDescriptionIndex<Capacity>::Hash_t
+ServiceDescriptionIndex<Capacity>::hash(const capro::IdString_t& id) noexcept
+{
+    // FNV-1a
+    constexpr Hash_t FNV_OFFSET_BASIS{14695981039346656037U};
+    constexpr Hash_t FNV_PRIME{1099511628211U};
+
+    Hash_t result{FNV_OFFSET_BASIS};
+    const char* const data = id.c_str();
+    for (uint64_t i = 0U; i < id.size(); ++i)
+    {
+        result ^= static_cast<Hash_t>(static_cast<uint8_t>(data[i]));
+        result *= FNV_PRIME;
+    }
+    return result;
+}
+
+template <uint32_t Capacity>
+inline typename ServiceDescriptionIndex<Capacity>::Hash_t ServiceDescriptionIndex<Capacity>::hash(
+    const capro::IdString_t& service, const capro::IdString_t& instance, const capro::IdString_t& event) noexcept
+{
+    constexpr Hash_t GOLDEN_RATIO{0x9e3779b97f4a7c15U};
+    constexpr Hash_t LEFT_SHIFT{6U};
+    constexpr Hash_t RIGHT_SHIFT{2U};
+
+    auto combine = [&](const Hash_t seed, const Hash_t value) {
+        return seed ^ (value + GOLDEN_RATIO + (seed << LEFT_SHIFT) + (seed >> RIGHT_SHIFT));
+    };
+
+    return combine(combine(hash(service), hash(instance)), hash(event));
+}
+
+template <uint32_t Capacity>
+inline typename ServiceDescriptionIndex<Capacity>::Hash_t
+ServiceDescriptionIndex<Capacity>::hash(const capro::ServiceDescription& serviceDescription) noexcept
+{
+    return hash(serviceDescription.getServiceIDString(),
+                serviceDescription.getInstanceIDString(),
+                serviceDescription.getEventIDString());
+}
+
+template <uint32_t Capacity>
+inline uint32_t ServiceDescriptionIndex<Capacity>::findBucket(const Hash_t hash, const HasKey_t& hasKey) const noexcept
+{
+    const auto truncatedHash = static_cast<uint32_t>(hash);
+    // there are more buckets than keys, therefore there is always an empty bucket which terminates the probing
+    for (uint32_t bucket = truncatedHash & BUCKET_MASK; m_buckets[bucket].head != NO_SLOT;
+         bucket = (bucket + 1U) & BUCKET_MASK)
+    {
+        if (m_buckets[bucket].hash == truncatedHash && hasKey(m_buckets[bucket].head))
+        {
+            return bucket;
+        }
+    }
+    return NO_BUCKET;
+}
+
+template <uint32_t Capacity>
+inline typename ServiceDescriptionIndex<Capacity>::Slot_t
+ServiceDescriptionIndex<Capacity>::find(const Hash_t hash, const HasKey_t& hasKey) const noexcept
+{
+    const auto bucket = findBucket(hash, hasKey);
+    return (bucket == NO_BUCKET) ? NO_SLOT : m_buckets[bucket].head;
+}
+
+template <uint32_t Capacity>
+inline typename ServiceDescriptionIndex<Capacity>::Slot_t
+ServiceDescriptionIndex<Capacity>::next(const Slot_t slot) const noexcept
+{
+    return (slot < Capacity) ? m_next[slot] : NO_SLOT;
+}
+
+template <uint32_t Capacity>
+inline void
+ServiceDescriptionIndex<Capacity>::insert(const Slot_t slot, const Hash_t hash, const HasKey_t& hasKey) noexcept
+{
+    if (slot >= Capacity)
+    {
+        return;
+    }
+
+    const auto bucket = findBucket(hash, hasKey);
+    if (bucket == NO_BUCKET)
+    {
+        auto emptyBucket = static_cast<uint32_t>(hash) & BUCKET_MASK;
+        while (m_buckets[emptyBucket].head != NO_SLOT)
+        {
+            emptyBucket = (emptyBucket + 1U) & BUCKET_MASK;
+        }
+        m_buckets[emptyBucket].head = slot;
+        m_buckets[emptyBucket].hash = static_cast<uint32_t>(hash);
+        m_next[slot] = NO_SLOT;
+        m_previous[slot] = NO_SLOT;
+        return;
+    }
+
+    // keep the chain sorted to iterate in the same order as a linear search over the external container
+    const auto head = m_buckets[bucket].head;
+    if (slot < head)
+    {
+        m_next[slot] = head;
+        m_previous[slot] = NO_SLOT;
+        m_previous[head] = slot;
+        m_buckets[bucket].head = slot;
+        return;
+    }
+
+    auto predecessor = head;
+    while (m_next[predecessor] != NO_SLOT && m_next[predecessor] < slot)
+    {
+        predecessor = m_next[predecessor];
+    }
+    const auto successor = m_next[predecessor];
+    m_next[slot] = successor;
+    m_previous[slot] = predecessor;
+    if (successor != NO_SLOT)
+    {
+        m_previous[successor] = slot;
+    }
+    m_next[predecessor] = slot;
+}
+
+template <uint32_t Capacity>
+inline void
+ServiceDescriptionIndex<Capacity>::remove(const Slot_t slot, const Hash_t hash, const HasKey_t& hasKey) noexcept
+{
+    if (slot >= Capacity)
+    {
+        return;
+    }
+
+    const auto predecessor = m_previous[slot];
+    const auto successor = m_next[slot];
+    if (predecessor != NO_SLOT)
+    {
+        m_next[predecessor] = successor;
+        if (successor != NO_SLOT)
+        {
+            m_previous[successor] = predecessor;
+        }
+        m_next[slot] = NO_SLOT;
+        m_previous[slot] = NO_SLOT;
+        return;
+    }
+
+    const auto bucket = findBucket(hash, hasKey);
+    if (bucket == NO_BUCKET || m_buckets[bucket].head != slot)
+    {
+        // not contained in the index
+        return;
+    }
+
+    m_next[slot] = NO_SLOT;
+    if (successor != NO_SLOT)
+    {
+        m_previous[successor] = NO_SLOT;
+        m_buckets[bucket].head = successor;
+        return;
+    }
+
+    eraseBucket(bucket);
+}
+
+template <uint32_t Capacity>
+inline void ServiceDescriptionIndex<Capacity>::eraseBucket(const uint32_t bucket) noexcept
+{
+    // backward shift deletion keeps the probe sequences intact without the need for tombstones
+    auto hole = bucket;
+    for (auto current = (hole + 1U) & BUCKET_MASK; m_buckets[current].head != NO_SLOT;
+         current = (current + 1U) & BUCKET_MASK)
+    {
+        const auto home = m_buckets[current].hash & BUCKET_MASK;
+        const auto distanceFromHome = (current - home) & BUCKET_MASK;
+        const auto distanceFromHole = (current - hole) & BUCKET_MASK;
+        if (distanceFromHome >= distanceFromHole)
+        {
+            m_buckets[hole] = m_buckets[current];
+            hole = current;
+        }
+    }
+    m_buckets[hole] = Bucket();
+}
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_DESCRIPTION_INDEX_INL
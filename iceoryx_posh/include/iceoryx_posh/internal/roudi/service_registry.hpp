@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/service_description_index.hpp"
 #include "iox/expected.hpp"
 #include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
@@ -86,6 +87,8 @@ class ServiceRegistry
     /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
     /// @param[in] event, string or wildcard (= iox::nullopt) to search for
     /// @param[in] callable, callable to apply to each matching entry
+    /// @note Searches with a given service or instance cost O(number of matches), only searches with wildcards for
+    ///       both, service and instance, iterate over all entries
     void find(const optional<capro::IdString_t>& service,
               const optional<capro::IdString_t>& instance,
               const optional<capro::IdString_t>& event,
@@ -100,24 +103,46 @@ class ServiceRegistry
     /// @return true when the registry changed since the last call, false otherwise
     bool hasDataChangedSinceLastCall() noexcept;
 
+    /// @brief The sequence number is increased with every change of the registry data, i.e. two registries which
+    ///        started empty and have the same sequence number after the same changes contain the same entries
+    /// @return the number of changes of the registry data
+    uint64_t sequenceNumber() const noexcept;
+
   private:
     using Entry_t = optional<ServiceDescriptionEntry>;
     using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
+    using Index_t = ServiceDescriptionIndex<CAPACITY>;
 
-    static constexpr uint32_t NO_INDEX = CAPACITY;
+    static constexpr uint32_t NO_INDEX = Index_t::NO_SLOT;
 
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
-    // store the last known free Index (if any is known)
-    // we could use a queue (or stack) here since they are not optimal
-    // for the filling pattern of a vector (prefer entries close to the front)
-    uint32_t m_freeIndex{NO_INDEX};
+    // slots which were occupied by previously removed entries and are reused before the container grows
+    vector<uint32_t, CAPACITY> m_freeIndices;
+
+    // the indices are part of the registry and are therefore also available for the findService calls of the
+    // runtimes which obtain a copy of the registry
+    Index_t m_serviceDescriptionIndex;
+    Index_t m_serviceIndex;
+    Index_t m_instanceIndex;
 
     bool m_dataChanged{true}; // initially true in order to also get notified of the empty registry
+    uint64_t m_sequenceNumber{0U};
 
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
+    uint32_t findIndex(const capro::IdString_t& service,
+                       const capro::IdString_t& instance,
+                       const capro::IdString_t& event) const noexcept;
+
+    using IndexUpdate_t = void (Index_t::*)(const uint32_t, const Index_t::Hash_t, const Index_t::HasKey_t&);
+
+    /// @brief inserts the entry at the index into all indices or removes it from all indices
+    void updateIndices(const uint32_t index, IndexUpdate_t update) noexcept;
+
+    /// @brief removes the entry at the index from the registry and the indices
+    void removeEntry(const uint32_t index) noexcept;
 
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
                               ReferenceCounter_t ServiceDescriptionEntry::*count);
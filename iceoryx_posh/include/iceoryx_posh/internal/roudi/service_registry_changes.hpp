@@ -0,0 +1,76 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_ROUDI_SERVICE_REGISTRY_CHANGES_HPP
+#define IOX_POSH_ROUDI_SERVICE_REGISTRY_CHANGES_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief A single modification of the ServiceRegistry
+struct ServiceRegistryChange
+{
+    enum class Type : uint8_t
+    {
+        ADD_PUBLISHER,
+        REMOVE_PUBLISHER,
+        ADD_SERVER,
+        REMOVE_SERVER
+    };
+
+    Type type{Type::ADD_PUBLISHER};
+    capro::ServiceDescription serviceDescription;
+};
+
+/// @brief The modifications of the ServiceRegistry which RouDi made during one discovery run. They are published
+/// alongside the ServiceRegistry snapshots and allow the runtimes to keep their copy of the registry up to date
+/// without copying the whole registry on every change. A copy of the registry can only be updated with the changes
+/// when it is not older than the state before the first change, otherwise the next snapshot is required.
+/// @note RouDi publishes a snapshot at least with every SNAPSHOT_INTERVAL-th publication of changes and before the
+/// changes of the same discovery run. A subscriber which receives the last SNAPSHOT_INTERVAL publications of changes,
+/// either as history or from its queue, therefore always finds a snapshot from which it can continue.
+struct ServiceRegistryChanges
+{
+    static constexpr uint32_t CAPACITY{16U};
+    static constexpr uint64_t SNAPSHOT_INTERVAL{8U};
+    static constexpr uint64_t HISTORY_CAPACITY{SNAPSHOT_INTERVAL};
+    static constexpr uint64_t QUEUE_CAPACITY{SNAPSHOT_INTERVAL};
+
+    /// @brief Applies the changes to a copy of the ServiceRegistry, changes which the copy already contains are
+    /// skipped
+    /// @param[in] registry copy of the ServiceRegistry to update
+    /// @return true when the copy is up to date afterwards, false when the copy misses changes which happened before
+    /// these changes and needs to be replaced by a newer snapshot
+    bool applyTo(ServiceRegistry& registry) const noexcept;
+
+    /// @brief sequence number of the ServiceRegistry after all changes were made
+    uint64_t sequenceNumber{0U};
+
+    /// @brief the changes in the order they were made; if there were more changes than the capacity, only the last
+    /// ones are contained and the copies of the registry need to be replaced by a snapshot
+    vector<ServiceRegistryChange, CAPACITY> changes;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_REGISTRY_CHANGES_HPP
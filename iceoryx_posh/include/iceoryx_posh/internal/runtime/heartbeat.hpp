@@ -18,12 +18,14 @@
 #define IOX_POSH_RUNTIME_HEARTBEAT_HPP
 
 #include <atomic>
+#include <cstdint>
 
 namespace iox
 {
 namespace runtime
 {
-/// @brief A small class to handle the heartbeat
+/// @brief A small class to handle the heartbeat. The heartbeat does not use a clock but counts the beats; the
+/// monitoring in RouDi detects a process which is not alive by a beat count which does not change
 class Heartbeat
 {
   public:
@@ -35,17 +37,14 @@ class Heartbeat
     Heartbeat& operator=(const Heartbeat&) = delete;
     Heartbeat& operator=(Heartbeat&&) = delete;
 
-    /// @brief Get the elapsed milliseconds since the last heartbeat
-    uint64_t elapsed_milliseconds_since_last_beat() const noexcept;
+    /// @brief Get the number of beats since the creation of the heartbeat
+    uint64_t beat_count() const noexcept;
 
-    /// @brief Update the heartbeat timestamp
+    /// @brief Increments the beat count
     void beat() noexcept;
 
   private:
-    static uint64_t milliseconds_since_epoch() noexcept;
-
-  private:
-    std::atomic<uint64_t> m_timestamp_last_beat{0};
+    std::atomic<uint64_t> m_beat_count{0};
 };
 } // namespace runtime
 } // namespace iox
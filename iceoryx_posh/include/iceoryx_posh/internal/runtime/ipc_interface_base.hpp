@@ -88,6 +88,8 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     MESSAGE_NOT_SUPPORTED,
+    CREATE_PORTS, // create several publisher, subscriber, client and server ports with one request
+    CREATE_PORTS_ACK,
     // etc..
     END,
 };
@@ -18,6 +18,7 @@
 #define IOX_POSH_RUNTIME_IPC_MESSAGE_HPP
 
 #include "iox/logging.hpp"
+#include "iox/optional.hpp"
 
 #include <cstdint>
 #include <sstream>
@@ -77,6 +78,13 @@ class IpcMessage
     //          If the message is invalid the return value is undefined.
     std::string getElementAtIndex(const uint32_t index) const noexcept;
 
+    /// @brief Returns the entry which starts at the given position and moves the position to the following entry.
+    ///        In contrast to getElementAtIndex this allows to read all entries of a message in a single pass.
+    /// @param[in,out] position of the entry in the message, 0 for the first entry
+    /// @return If an entry starts at the position it returns the entry
+    ///         otherwise an empty optional
+    optional<std::string> getNextElement(uint64_t& position) const noexcept;
+
     /// @brief returns if an entry is valid.
     ///      Non valid entries are containing at least one separator
     /// @param[in] entry sstring to check
@@ -114,6 +122,11 @@ class IpcMessage
     template <typename T>
     void addEntry(const T& entry) noexcept;
 
+    /// @brief Appends all entries of another IpcMessage. If the other
+    ///         IpcMessage is invalid this IpcMessage becomes invalid.
+    /// @param[in] message with the entries to append
+    void addEntries(const IpcMessage& message) noexcept;
+
     /// @brief Compares two IpcMessages to be equal
     /// @param rhs IpcMessage to compare with
     bool operator==(const IpcMessage& rhs) const noexcept;
@@ -18,6 +18,7 @@
 #define IOX_POSH_RUNTIME_NODE_DATA_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_requester.hpp"
 
 #include <atomic>
 
@@ -47,6 +48,7 @@ class NodeData
     NodeName_t m_nodeName;
     uint64_t m_nodeDeviceIdentifier;
     std::atomic_bool m_toBeDestroyed{false};
+    popo::DiscoveryRequester m_discoveryRequester;
 };
 } // namespace runtime
 } // namespace iox
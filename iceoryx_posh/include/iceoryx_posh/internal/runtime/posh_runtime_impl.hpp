@@ -69,6 +69,9 @@ class PoshRuntimeImpl : public PoshRuntime
                         const popo::ServerOptions& ServerOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
 
+    /// @copydoc PoshRuntime::getMiddlewarePorts
+    PortResponses_t getMiddlewarePorts(const PortRequests_t& requests) noexcept override;
+
     /// @copydoc PoshRuntime::getMiddlewareInterface
     popo::InterfacePortData* getMiddlewareInterface(const capro::Interfaces interface,
                                                     const NodeName_t& nodeName = {""}) noexcept override;
@@ -106,6 +109,21 @@ class PoshRuntimeImpl : public PoshRuntime
     expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    popo::PublisherOptions limitPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept;
+    popo::SubscriberOptions limitSubscriberOptions(const capro::ServiceDescription& service,
+                                                   const popo::SubscriberOptions& subscriberOptions) const noexcept;
+    popo::ClientOptions limitClientOptions(const popo::ClientOptions& clientOptions) const noexcept;
+    popo::ServerOptions limitServerOptions(const popo::ServerOptions& serverOptions) const noexcept;
+
+    /// @brief serializes a port request to the entries of a CREATE_PORTS message
+    IpcMessage serializePortRequest(const PortRequest& request) const noexcept;
+
+    /// @brief sends a CREATE_PORTS message with the given requests and appends the responses for these requests
+    void requestPortsFromRoudi(const IpcMessage& sendBuffer,
+                               const PortRequest* const requests,
+                               const uint64_t numberOfRequests,
+                               PortResponses_t& responses) noexcept;
+
     mutable optional<posix::mutex> m_appIpcRequestMutex;
 
     IpcRuntimeInterface m_ipcChannelInterface;
@@ -29,6 +29,15 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines how the MemoryManager reacts when the best fitting mempool for a chunk request is exhausted
+enum class MemPoolFallbackPolicy : uint8_t
+{
+    /// @brief the chunk request fails with 'MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS'
+    NONE,
+    /// @brief the chunk is acquired from the next larger mempool which has free chunks left
+    NEXT_LARGER_MEMPOOL
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +55,7 @@ struct MePooConfig
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolFallbackPolicy m_fallbackPolicy{MemPoolFallbackPolicy::NONE};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -58,6 +68,10 @@ struct MePooConfig
     /// @param[in] Entry structure of mempool configuration
     void addMemPool(Entry f_entry) noexcept;
 
+    /// @brief Sets the policy which is applied when the best fitting mempool has no free chunks left
+    /// @param[in] fallbackPolicy the policy to apply
+    MePooConfig& setFallbackPolicy(const MemPoolFallbackPolicy fallbackPolicy) noexcept;
+
     /// @brief Function for creating default memory pools
     MePooConfig& setDefaults() noexcept;
 
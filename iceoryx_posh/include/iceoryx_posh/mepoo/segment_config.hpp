@@ -19,6 +19,7 @@
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
+#include "iceoryx_hoofs/internal/posix_wrapper/shared_memory_object.hpp"
 #include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iox/vector.hpp"
@@ -34,11 +35,13 @@ struct SegmentConfig
         SegmentEntry(const posix::PosixGroup::groupName_t& readerGroup,
                      const posix::PosixGroup::groupName_t& writerGroup,
                      const MePooConfig& memPoolConfig,
-                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo()) noexcept
+                     iox::mepoo::MemoryInfo memoryInfo = iox::mepoo::MemoryInfo(),
+                     const posix::MemoryMapPageOptions& pageOptions = posix::MemoryMapPageOptions()) noexcept
             : m_readerGroup(readerGroup)
             , m_writerGroup(writerGroup)
             , m_mempoolConfig(memPoolConfig)
             , m_memoryInfo(memoryInfo)
+            , m_pageOptions(pageOptions)
 
         {
         }
@@ -47,10 +50,18 @@ struct SegmentConfig
         posix::PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief defines if the segment is backed by transparent huge pages, prefaulted and locked in RAM; this is
+        /// applied by RouDi and by the applications which map the segment; the NUMA node is only applied by RouDi
+        posix::MemoryMapPageOptions m_pageOptions;
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
 
+    /// @brief defines if and how the shared memory of the segments and of the management segment is zeroed when
+    /// RouDi creates it; zeroing with multiple threads and relying on the zeroed pages of the kernel reduces the
+    /// startup time of RouDi for large segments
+    posix::SharedMemoryZeroingOptions m_zeroingOptions;
+
     /// @brief Set Function for default values to be added in SegmentConfig
     SegmentConfig& setDefaults() noexcept;
 
@@ -24,6 +24,7 @@
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/expected.hpp"
 #include "iox/function.hpp"
@@ -103,6 +104,10 @@ class ListenerImpl
 {
   public:
     ListenerImpl() noexcept;
+
+    /// @brief Creates a Listener whose background thread waits for notifications with the given strategy
+    /// @param[in] waitStrategy defines if and how long the background thread polls before blocking
+    explicit ListenerImpl(const WaitStrategy& waitStrategy) noexcept;
     ListenerImpl(const ListenerImpl&) = delete;
     ListenerImpl(ListenerImpl&&) = delete;
     ~ListenerImpl() noexcept;
@@ -168,7 +173,8 @@ class ListenerImpl
     uint64_t size() const noexcept;
 
   protected:
-    ListenerImpl(ConditionVariableData& conditionVariableData) noexcept;
+    ListenerImpl(ConditionVariableData& conditionVariableData,
+                 const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
 
   private:
     class Event_t;
@@ -220,9 +226,10 @@ class Listener : public ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>
   public:
     using Parent = ListenerImpl<MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     Listener() noexcept;
+    explicit Listener(const WaitStrategy& waitStrategy) noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
 };
 
 } // namespace popo
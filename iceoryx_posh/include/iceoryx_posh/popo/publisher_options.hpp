@@ -44,6 +44,11 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether the publisher acquires chunks in batches via a publisher-local chunk cache. This
+    /// reduces the contention on the mempools with many concurrently loaning publishers but keeps a few chunks reserved
+    /// for this publisher
+    bool useChunkCache{false};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
@@ -0,0 +1,52 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_WAIT_STRATEGY_HPP
+#define IOX_POSH_POPO_WAIT_STRATEGY_HPP
+
+#include "iox/duration.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Defines how a WaitSet or a Listener waits for notifications
+enum class WaitStrategyType : uint8_t
+{
+    /// Blocks on the semaphore until a notification arrives
+    BLOCKING,
+    /// Polls the active notifications for the spin duration and blocks afterwards
+    SPIN_THEN_BLOCK,
+    /// Polls the active notifications without ever blocking; intended for threads with a dedicated core
+    BUSY_POLL
+};
+
+/// @brief Used by the WaitSet and the Listener to configure the trade-off between wake-up latency and CPU usage.
+/// While the waiting thread polls, the notifiers do not need to post the semaphore and both sides save the
+/// syscall.
+struct WaitStrategy
+{
+    WaitStrategyType type{WaitStrategyType::BLOCKING};
+    /// @brief How long the active notifications are polled before blocking; only used by SPIN_THEN_BLOCK
+    units::Duration spinDuration{units::Duration::fromMicroseconds(50U)};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_WAIT_STRATEGY_HPP
@@ -35,6 +35,7 @@ struct CmdLineArgs_t
     optional<uint16_t> uniqueRouDiId{nullopt};
     units::Duration processTerminationDelay{roudi::PROCESS_DEFAULT_TERMINATION_DELAY};
     units::Duration processKillDelay{roudi::PROCESS_DEFAULT_KILL_DELAY};
+    uint32_t runtimeMessageWorkers{roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS};
     roudi::ConfigFilePathString_t configFilePath;
 };
 
@@ -47,6 +48,7 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Cmd
         .or_else([&logstream] { logstream << "Unique RouDi ID: < unset >\n"; });
     logstream << "Process termination delay: " << cmdLineArgs.processTerminationDelay.toSeconds() << " s\n";
     logstream << "Process kill delay: " << cmdLineArgs.processKillDelay.toSeconds() << " s\n";
+    logstream << "Runtime message workers: " << cmdLineArgs.runtimeMessageWorkers << "\n";
     if (!cmdLineArgs.configFilePath.empty())
     {
         logstream << "Config file used is: " << cmdLineArgs.configFilePath;
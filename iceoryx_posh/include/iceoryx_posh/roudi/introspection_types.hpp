@@ -125,6 +125,45 @@ struct SubscriberPortChangingIntrospectionFieldTopic
     vector<SubscriberPortChangingData, MAX_SUBSCRIBERS> subscriberPortChangingDataList;
 };
 
+/// @brief the latency topic is only offered when iceoryx is built with the LATENCY_INSTRUMENTATION cmake option
+const capro::ServiceDescription IntrospectionPortLatencyService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "PortLatency");
+
+/// @brief percentiles of the latencies of a stage on the way of the chunks from the publishers to the subscribers;
+/// the percentiles are the upper bounds of the histogram buckets and have a relative error of up to 12.5%
+struct LatencyPercentiles
+{
+    uint64_t m_sampleCount{0};
+    uint64_t m_p50Nanoseconds{0};
+    uint64_t m_p90Nanoseconds{0};
+    uint64_t m_p99Nanoseconds{0};
+    uint64_t m_p999Nanoseconds{0};
+    uint64_t m_maxNanoseconds{0};
+};
+
+struct PublisherPortLatencyData
+{
+    uint64_t m_publisherPortID{0};
+    /// time between loaning a chunk and publishing it
+    LatencyPercentiles m_loanToPublish;
+    /// time between publishing a chunk and having it pushed to the queues of all subscribers
+    LatencyPercentiles m_publishToDelivery;
+};
+
+struct SubscriberPortLatencyData
+{
+    // index used to identify subscriber is same as in PortIntrospectionFieldTopic->subscriberList
+    /// end-to-end time between publishing a chunk and taking it; this also contains the time a chunk was kept in the
+    /// history of the publisher until the subscriber subscribed
+    LatencyPercentiles m_publishToTake;
+};
+
+/// @brief the topic for the port latency that a user can subscribe to
+struct PortLatencyIntrospectionFieldTopic
+{
+    vector<PublisherPortLatencyData, MAX_PUBLISHERS> m_publisherLatencyList;
+    vector<SubscriberPortLatencyData, MAX_SUBSCRIBERS> m_subscriberLatencyList;
+};
+
 const capro::ServiceDescription IntrospectionProcessService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "Process");
 
 struct ProcessIntrospectionData
@@ -40,9 +40,12 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] shmName is the name of the posix share memory
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
-    PosixShmMemoryProvider(const ShmName_t& shmName,
-                           const posix::AccessMode accessMode,
-                           const posix::OpenMode openMode) noexcept;
+    /// @param [in] zeroingOptions defines if and how the shared memory is zeroed when it is created
+    PosixShmMemoryProvider(
+        const ShmName_t& shmName,
+        const posix::AccessMode accessMode,
+        const posix::OpenMode openMode,
+        const posix::SharedMemoryZeroingOptions& zeroingOptions = posix::SharedMemoryZeroingOptions()) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -64,6 +67,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     ShmName_t m_shmName;
     posix::AccessMode m_accessMode{posix::AccessMode::READ_ONLY};
     posix::OpenMode m_openMode{posix::OpenMode::OPEN_EXISTING};
+    posix::SharedMemoryZeroingOptions m_zeroingOptions;
     optional<posix::SharedMemoryObject> m_shmObject;
 
     static constexpr access_rights SHM_MEMORY_PERMISSIONS =
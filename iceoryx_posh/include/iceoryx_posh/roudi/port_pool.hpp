@@ -28,11 +28,13 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/roudi/port_pool_data.hpp"
+#include "iceoryx_posh/internal/roudi/service_description_index.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/type_traits.hpp"
 
 namespace iox
@@ -71,6 +73,10 @@ class PortPool
     PortPoolData::NodeContainer& getNodeDataList() noexcept;
     PortPoolData::CondVarContainer& getConditionVariableDataList() noexcept;
 
+    /// @brief The queue of PortPool entries which requested a discovery run
+    /// @return reference to the DiscoveryRequestQueueData in the PortPool
+    popo::DiscoveryRequestQueueData& getDiscoveryRequestQueue() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -169,8 +175,62 @@ class PortPool
     /// @note after this call the provided ConditionVariableData is no longer available for usage
     void removeConditionVariableData(const popo::ConditionVariableData* const conditionVariableData) noexcept;
 
+    /// @brief Calls the provided callable for every PublisherPortData with the given service description
+    /// @param[in] serviceDescription of the publisher ports; only service, instance and event are considered
+    /// @param[in] callable which is called for every matching PublisherPortData
+    /// @note the ports are indexed by their service description, therefore this costs O(number of matches)
+    void forEachPublisherPort(const capro::ServiceDescription& serviceDescription,
+                              const function_ref<void(PublisherPortRouDiType::MemberType_t&)> callable) noexcept;
+
+    /// @brief Calls the provided callable for every SubscriberPortData with the given service description
+    /// @param[in] serviceDescription of the subscriber ports; only service, instance and event are considered
+    /// @param[in] callable which is called for every matching SubscriberPortData
+    /// @note the ports are indexed by their service description, therefore this costs O(number of matches)
+    void forEachSubscriberPort(const capro::ServiceDescription& serviceDescription,
+                               const function_ref<void(SubscriberPortType::MemberType_t&)> callable) noexcept;
+
+    /// @brief Calls the provided callable for every ClientPortData with the given service description
+    /// @param[in] serviceDescription of the client ports; only service, instance and event are considered
+    /// @param[in] callable which is called for every matching ClientPortData
+    /// @note the ports are indexed by their service description, therefore this costs O(number of matches)
+    void forEachClientPort(const capro::ServiceDescription& serviceDescription,
+                           const function_ref<void(popo::ClientPortData&)> callable) noexcept;
+
+    /// @brief Calls the provided callable for every ServerPortData with the given service description
+    /// @param[in] serviceDescription of the server ports; only service, instance and event are considered
+    /// @param[in] callable which is called for every matching ServerPortData
+    /// @note the ports are indexed by their service description, therefore this costs O(number of matches)
+    void forEachServerPort(const capro::ServiceDescription& serviceDescription,
+                           const function_ref<void(popo::ServerPortData&)> callable) noexcept;
+
+  private:
+    template <uint64_t Capacity>
+    using PortIndex_t = ServiceDescriptionIndex<static_cast<uint32_t>(Capacity)>;
+
+    template <typename T, uint64_t Capacity>
+    static void addToPortIndex(PortIndex_t<Capacity>& portIndex,
+                               FixedPositionContainer<T, Capacity>& ports,
+                               const typename FixedPositionContainer<T, Capacity>::IndexType index) noexcept;
+
+    template <typename T, uint64_t Capacity>
+    static void removeFromPortIndex(PortIndex_t<Capacity>& portIndex,
+                                    FixedPositionContainer<T, Capacity>& ports,
+                                    const T* const portData) noexcept;
+
+    template <typename T, uint64_t Capacity>
+    static void forEachPortInIndex(const PortIndex_t<Capacity>& portIndex,
+                                   FixedPositionContainer<T, Capacity>& ports,
+                                   const capro::ServiceDescription& serviceDescription,
+                                   const function_ref<void(T&)> callable) noexcept;
+
   private:
     PortPoolData* m_portPoolData;
+
+    // the indices are only used by RouDi and therefore not part of the PortPoolData in the shared memory
+    PortIndex_t<MAX_PUBLISHERS> m_publisherPortIndex;
+    PortIndex_t<MAX_SUBSCRIBERS> m_subscriberPortIndex;
+    PortIndex_t<MAX_CLIENTS> m_clientPortIndex;
+    PortIndex_t<MAX_SERVERS> m_serverPortIndex;
 };
 
 } // namespace roudi
@@ -40,6 +40,9 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         return nullptr;
     }
 
+    port->m_discoveryRequester.init(m_portPoolData->m_discoveryRequests,
+                                    {popo::DiscoveryRequestSource::SUBSCRIBER_PORT, port.to_index()});
+    addToPortIndex(m_subscriberPortIndex, getSubscriberPortDataList(), port.to_index());
     return port.to_ptr();
 }
 
@@ -62,8 +65,67 @@ inline iox::popo::SubscriberPortData* PortPool::constructSubscriber(const capro:
         return nullptr;
     }
 
+    port->m_discoveryRequester.init(m_portPoolData->m_discoveryRequests,
+                                    {popo::DiscoveryRequestSource::SUBSCRIBER_PORT, port.to_index()});
+    addToPortIndex(m_subscriberPortIndex, getSubscriberPortDataList(), port.to_index());
     return port.to_ptr();
 }
+
+template <typename T, uint64_t Capacity>
+inline void PortPool::addToPortIndex(PortIndex_t<Capacity>& portIndex,
+                                     FixedPositionContainer<T, Capacity>& ports,
+                                     const typename FixedPositionContainer<T, Capacity>::IndexType index) noexcept
+{
+    using IndexType = typename FixedPositionContainer<T, Capacity>::IndexType;
+    const auto& serviceDescription = ports.iter_from_index(index)->m_serviceDescription;
+    portIndex.insert(index, PortIndex_t<Capacity>::hash(serviceDescription), [&](const uint32_t slot) {
+        return ports.iter_from_index(static_cast<IndexType>(slot))->m_serviceDescription == serviceDescription;
+    });
+}
+
+template <typename T, uint64_t Capacity>
+inline void PortPool::removeFromPortIndex(PortIndex_t<Capacity>& portIndex,
+                                          FixedPositionContainer<T, Capacity>& ports,
+                                          const T* const portData) noexcept
+{
+    using IndexType = typename FixedPositionContainer<T, Capacity>::IndexType;
+    const auto& serviceDescription = portData->m_serviceDescription;
+    auto hasServiceDescription = [&](const uint32_t slot) {
+        return ports.iter_from_index(static_cast<IndexType>(slot))->m_serviceDescription == serviceDescription;
+    };
+
+    // the slot of the port is not known, but it is one of the slots with the same service description
+    const auto hash = PortIndex_t<Capacity>::hash(serviceDescription);
+    for (auto slot = portIndex.find(hash, hasServiceDescription); slot != PortIndex_t<Capacity>::NO_SLOT;
+         slot = portIndex.next(slot))
+    {
+        if (ports.iter_from_index(static_cast<IndexType>(slot)).to_ptr() == portData)
+        {
+            portIndex.remove(slot, hash, hasServiceDescription);
+            return;
+        }
+    }
+}
+
+template <typename T, uint64_t Capacity>
+inline void PortPool::forEachPortInIndex(const PortIndex_t<Capacity>& portIndex,
+                                         FixedPositionContainer<T, Capacity>& ports,
+                                         const capro::ServiceDescription& serviceDescription,
+                                         const function_ref<void(T&)> callable) noexcept
+{
+    using IndexType = typename FixedPositionContainer<T, Capacity>::IndexType;
+    auto hasServiceDescription = [&](const uint32_t slot) {
+        return ports.iter_from_index(static_cast<IndexType>(slot))->m_serviceDescription == serviceDescription;
+    };
+
+    for (auto slot = portIndex.find(PortIndex_t<Capacity>::hash(serviceDescription), hasServiceDescription);
+         slot != PortIndex_t<Capacity>::NO_SLOT;
+         slot = portIndex.next(slot))
+    {
+        callable(*ports.iter_from_index(static_cast<IndexType>(slot)));
+    }
+}
+
 } // namespace roudi
 } // namespace iox
 
@@ -0,0 +1,78 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+#define IOX_POSH_RUNTIME_PORT_REQUEST_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/variant.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Describes one port which RouDi shall create as part of a batch request, see
+/// PoshRuntime::getMiddlewarePorts. The kind of the port is defined by the type of the options.
+struct PortRequest
+{
+    using Options_t =
+        variant<popo::PublisherOptions, popo::SubscriberOptions, popo::ClientOptions, popo::ServerOptions>;
+
+    /// @brief creates a request for a publisher port
+    /// @param[in] service service description for the new publisher port
+    /// @param[in] publisherOptions like the history capacity of a publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    PortRequest(const capro::ServiceDescription& service,
+                const popo::PublisherOptions& publisherOptions,
+                const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    /// @brief creates a request for a subscriber port
+    /// @param[in] service service description for the new subscriber port
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    PortRequest(const capro::ServiceDescription& service,
+                const popo::SubscriberOptions& subscriberOptions,
+                const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    /// @brief creates a request for a client port
+    /// @param[in] service service description for the new client port
+    /// @param[in] clientOptions like the queue capacity and queue full policy by a client
+    /// @param[in] portConfigInfo configuration information for the port
+    PortRequest(const capro::ServiceDescription& service,
+                const popo::ClientOptions& clientOptions,
+                const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    /// @brief creates a request for a server port
+    /// @param[in] service service description for the new server port
+    /// @param[in] serverOptions like the queue capacity and queue full policy by a server
+    /// @param[in] portConfigInfo configuration information for the port
+    PortRequest(const capro::ServiceDescription& service,
+                const popo::ServerOptions& serverOptions,
+                const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
+
+    capro::ServiceDescription service;
+    Options_t options;
+    PortConfigInfo portConfigInfo;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_REQUEST_HPP
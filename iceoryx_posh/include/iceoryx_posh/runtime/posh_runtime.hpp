@@ -31,8 +31,12 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
+#include "iox/expected.hpp"
 #include "iox/optional.hpp"
 #include "iox/scope_guard.hpp"
+#include "iox/variant.hpp"
+#include "iox/vector.hpp"
 
 #include <atomic>
 
@@ -52,6 +56,14 @@ class NodeData;
 class PoshRuntime
 {
   public:
+    using PortRequests_t = vector<PortRequest, MAX_NUMBER_OF_PORTS_PER_REQUEST>;
+    /// @brief The data of a port created from a PortRequest; the alternative corresponds to the options of the request
+    using PortData_t = variant<PublisherPortUserType::MemberType_t*,
+                               SubscriberPortUserType::MemberType_t*,
+                               popo::ClientPortUser::MemberType_t*,
+                               popo::ServerPortUser::MemberType_t*>;
+    using PortResponses_t = vector<expected<PortData_t, IpcMessageErrorType>, MAX_NUMBER_OF_PORTS_PER_REQUEST>;
+
     PoshRuntime(const PoshRuntime&) = delete;
     PoshRuntime& operator=(const PoshRuntime&) = delete;
     PoshRuntime(PoshRuntime&&) = delete;
@@ -135,6 +147,13 @@ class PoshRuntime
                         const popo::ServerOptions& serverOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create several publisher, subscriber, client and server ports at once; the
+    /// requests are sent with as few IPC messages as possible and RouDi creates all ports of a message in one pass
+    /// @param[in] requests the ports to create
+    /// @return for each request in the same order either the data of the created port or the reason why it could not
+    /// be created
+    virtual PortResponses_t getMiddlewarePorts(const PortRequests_t& requests) noexcept = 0;
+
     /// @brief request the RouDi daemon to create an interface port
     /// @param[in] interface interface to create
     /// @param[in] nodeName name of the node where the interface should belong to
@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_changes.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 
@@ -78,12 +79,22 @@ class ServiceDiscovery
     /// @todo iox-#1155 improve solution to avoid stack usage without using dynamic memory
     std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry{new iox::roudi::ServiceRegistry};
     std::mutex m_serviceRegistryMutex;
+    // the local copy of the registry is only replaced by a snapshot when it misses changes, e.g. initially
+    bool m_isServiceRegistryUpToDate{false};
 
     popo::Subscriber<roudi::ServiceRegistry> m_serviceRegistrySubscriber{
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
+    popo::Subscriber<roudi::ServiceRegistryChanges> m_serviceRegistryChangesSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+        {roudi::ServiceRegistryChanges::QUEUE_CAPACITY,
+         roudi::ServiceRegistryChanges::HISTORY_CAPACITY,
+         iox::NodeName_t("Service Registry"),
+         true}};
+
     void update();
+    void updateFromSnapshot();
 };
 
 } // namespace runtime
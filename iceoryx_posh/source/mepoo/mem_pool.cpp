@@ -36,6 +36,7 @@ MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
 {
 }
 
+constexpr uint32_t MemPoolCache::CAPACITY;
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
 
 MemPool::MemPool(const greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
@@ -81,14 +82,28 @@ void MemPool::adjustMinFree() noexcept
                              m_minFree.load(std::memory_order_relaxed)));
 }
 
+void MemPool::warnAboutNoSpaceLeft() const noexcept
+{
+    IOX_LOG(WARN,
+            "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
+                                      << ", used_chunks = " << getUsedChunks() << " ] has no more space left");
+}
+
 void* MemPool::getChunk() noexcept
+{
+    auto chunk = tryGetChunk();
+    if (chunk == nullptr)
+    {
+        warnAboutNoSpaceLeft();
+    }
+    return chunk;
+}
+
+void* MemPool::tryGetChunk() noexcept
 {
     uint32_t l_index{0U};
     if (!m_freeIndices.pop(l_index))
     {
-        IOX_LOG(WARN,
-                "Mempool [m_chunkSize = " << m_chunkSize << ", numberOfChunks = " << m_numberOfChunks
-                                          << ", used_chunks = " << m_usedChunks.load() << " ] has no more space left");
         return nullptr;
     }
 
@@ -97,7 +112,79 @@ void* MemPool::getChunk() noexcept
     m_usedChunks.fetch_add(1U, std::memory_order_relaxed);
     adjustMinFree();
 
-    return m_rawMemory.get() + l_index * m_chunkSize;
+    return chunkFromIndex(l_index);
+}
+
+void* MemPool::chunkFromIndex(const uint32_t index) noexcept
+{
+    return m_rawMemory.get() + static_cast<uint64_t>(index) * m_chunkSize;
+}
+
+void MemPool::refillCache(MemPoolCache& cache, const uint32_t maxNumberOfCachedChunks) noexcept
+{
+    cache.m_size =
+        m_freeIndices.popBatch(&cache.m_indices[0], std::min(maxNumberOfCachedChunks, MemPoolCache::CAPACITY));
+    if (cache.m_size == 0U)
+    {
+        return;
+    }
+
+    // m_usedChunks must be increased first so that getUsedChunks never observes more cached than used chunks
+    m_usedChunks.fetch_add(cache.m_size, std::memory_order_relaxed);
+    m_cachedChunks.fetch_add(cache.m_size, std::memory_order_release);
+    adjustMinFree();
+}
+
+void* MemPool::getChunk(MemPoolCache& cache, const uint32_t maxNumberOfCachedChunks) noexcept
+{
+    auto chunk = tryGetChunk(cache, maxNumberOfCachedChunks);
+    if (chunk == nullptr)
+    {
+        warnAboutNoSpaceLeft();
+    }
+    return chunk;
+}
+
+void* MemPool::tryGetChunk(MemPoolCache& cache, const uint32_t maxNumberOfCachedChunks) noexcept
+{
+    if (cache.m_memPool.get() != this)
+    {
+        releaseCache(cache);
+        cache.m_memPool = this;
+    }
+
+    if (cache.m_size == 0U)
+    {
+        refillCache(cache, maxNumberOfCachedChunks);
+        if (cache.m_size == 0U)
+        {
+            return nullptr;
+        }
+    }
+
+    --cache.m_size;
+    m_cachedChunks.fetch_sub(1U, std::memory_order_relaxed);
+
+    return chunkFromIndex(cache.m_indices[cache.m_size]);
+}
+
+void MemPool::releaseCache(MemPoolCache& cache) noexcept
+{
+    auto* memPool = cache.m_memPool.get();
+    if (memPool == nullptr || cache.m_size == 0U)
+    {
+        cache.m_size = 0U;
+        return;
+    }
+
+    if (!memPool->m_freeIndices.pushBatch(&cache.m_indices[0], cache.m_size))
+    {
+        errorHandler(PoshError::POSH__MEMPOOL_POSSIBLE_DOUBLE_FREE);
+    }
+
+    memPool->m_cachedChunks.fetch_sub(cache.m_size, std::memory_order_relaxed);
+    memPool->m_usedChunks.fetch_sub(cache.m_size, std::memory_order_relaxed);
+    cache.m_size = 0U;
 }
 
 void MemPool::freeChunk(const void* chunk) noexcept
@@ -130,7 +217,10 @@ uint32_t MemPool::getChunkCount() const noexcept
 
 uint32_t MemPool::getUsedChunks() const noexcept
 {
-    return m_usedChunks.load(std::memory_order_relaxed);
+    // the cached chunks are not handed out to a user and therefore not counted as used
+    const auto cachedChunks = m_cachedChunks.load(std::memory_order_acquire);
+    const auto usedChunks = m_usedChunks.load(std::memory_order_relaxed);
+    return (usedChunks > cachedChunks) ? usedChunks - cachedChunks : 0U;
 }
 
 uint32_t MemPool::getMinFree() const noexcept
@@ -140,7 +230,7 @@ uint32_t MemPool::getMinFree() const noexcept
 
 MemPoolInfo MemPool::getInfo() const noexcept
 {
-    return {m_usedChunks.load(std::memory_order_relaxed),
+    return {getUsedChunks(),
             m_minFree.load(std::memory_order_relaxed),
             m_numberOfChunks,
             m_chunkSize};
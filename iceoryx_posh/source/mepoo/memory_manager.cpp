@@ -74,6 +74,52 @@ void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocat
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
 }
 
+void MemoryManager::generateSizeClassIndex() noexcept
+{
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClass = 0U; sizeClass < NUMBER_OF_SIZE_CLASSES; ++sizeClass)
+    {
+        const uint64_t sizeClassLowerBound{1ULL << sizeClass};
+        while (memPoolIndex < m_memPoolVector.size()
+               && m_memPoolVector[memPoolIndex].getChunkSize() < sizeClassLowerBound)
+        {
+            ++memPoolIndex;
+        }
+        m_sizeClassIndex[sizeClass] = memPoolIndex;
+    }
+}
+
+uint32_t MemoryManager::sizeClassOf(const uint32_t chunkSize) noexcept
+{
+    // floor(log2(chunkSize)) with a fixed number of steps
+    uint32_t value{chunkSize};
+    uint32_t sizeClass{0U};
+    for (const uint32_t shift : {16U, 8U, 4U, 2U, 1U})
+    {
+        if (value >= (1U << shift))
+        {
+            value >>= shift;
+            sizeClass += shift;
+        }
+    }
+    return sizeClass;
+}
+
+uint32_t MemoryManager::memPoolIndexForChunkSize(const uint32_t chunkSize) const noexcept
+{
+    const auto sizeClass = sizeClassOf(chunkSize);
+    auto memPoolIndex = m_sizeClassIndex[sizeClass];
+    const auto firstMemPoolOfNextSizeClass = m_sizeClassIndex[sizeClass + 1U];
+
+    // all mempools of the next size class are large enough, therefore only the mempools
+    // within the size class of the requested chunk size need to be compared
+    while (memPoolIndex < firstMemPoolOfNextSizeClass && m_memPoolVector[memPoolIndex].getChunkSize() < chunkSize)
+    {
+        ++memPoolIndex;
+    }
+    return memPoolIndex;
+}
+
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
 {
     return static_cast<uint32_t>(m_memPoolVector.size());
@@ -139,28 +185,87 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
     {
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
+    m_fallbackPolicy = mePooConfig.m_fallbackPolicy;
 
     generateChunkManagementPool(managementAllocator);
+    generateSizeClassIndex();
 }
 
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
+{
+    return acquireChunk(chunkSettings, nullptr);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings,
+                                                                    ChunkCache& chunkCache) noexcept
+{
+    return acquireChunk(chunkSettings, &chunkCache);
+}
+
+void MemoryManager::releaseChunkCache(ChunkCache& chunkCache) noexcept
+{
+    MemPool::releaseCache(chunkCache.m_chunkMemoryCache);
+    MemPool::releaseCache(chunkCache.m_chunkManagementCache);
+}
+
+void* MemoryManager::getChunkFromCache(MemPool& memPool, ChunkCache& chunkCache) noexcept
+{
+    if (chunkCache.m_chunkMemoryCache.m_memPool.get() != &memPool)
+    {
+        releaseChunkCache(chunkCache);
+    }
+    return memPool.tryGetChunk(chunkCache.m_chunkMemoryCache);
+}
+
+void* MemoryManager::getChunkManagementFromCache(ChunkCache& chunkCache) noexcept
+{
+    // there are only as many chunk management entries as chunks in all mempools; therefore the chunk management
+    // cache must not contain more entries than the chunk memory cache, else it could starve other users
+    const auto maxNumberOfCachedChunks = chunkCache.m_chunkMemoryCache.m_size + 1U;
+    return m_chunkManagementPool.front().getChunk(chunkCache.m_chunkManagementCache, maxNumberOfCachedChunks);
+}
+
+expected<SharedChunk, MemoryManager::Error> MemoryManager::acquireChunk(const ChunkSettings& chunkSettings,
+                                                                        ChunkCache* const chunkCache) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
+    bool useChunkManagementCache{false};
 
-    for (auto& memPool : m_memPoolVector)
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    auto memPoolIndex = memPoolIndexForChunkSize(requiredChunkSize);
+    if (memPoolIndex < numberOfMemPools)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        const auto bestFittingMemPoolIndex = memPoolIndex;
+        memPoolPointer = &m_memPoolVector[memPoolIndex];
+        chunk =
+            (chunkCache != nullptr) ? getChunkFromCache(*memPoolPointer, *chunkCache) : memPoolPointer->tryGetChunk();
+        const bool isChunkFromCache = (chunkCache != nullptr) && (chunk != nullptr);
+        ++memPoolIndex;
+
+        if (m_fallbackPolicy == MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+            for (; chunk == nullptr && memPoolIndex < numberOfMemPools; ++memPoolIndex)
+            {
+                memPoolPointer = &m_memPoolVector[memPoolIndex];
+                chunk = memPoolPointer->tryGetChunk();
+            }
         }
+
+        // an exhausted MemPool is only reported when there is no other MemPool to fall back to
+        if (chunk == nullptr)
+        {
+            for (auto index = bestFittingMemPoolIndex; index < memPoolIndex; ++index)
+            {
+                m_memPoolVector[index].warnAboutNoSpaceLeft();
+            }
+        }
+
+        aquiredChunkSize = memPoolPointer->getChunkSize();
+        useChunkManagementCache = isChunkFromCache;
     }
 
     if (m_memPoolVector.size() == 0)
@@ -200,7 +305,9 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     else
     {
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
+        auto chunkManagementMemory = useChunkManagementCache ? getChunkManagementFromCache(*chunkCache)
+                                                             : m_chunkManagementPool.front().getChunk();
+        auto chunkManagement = new (chunkManagementMemory)
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
         return ok(SharedChunk(chunkManagement));
     }
@@ -41,6 +41,12 @@ void MePooConfig::addMemPool(MePooConfig::Entry f_entry) noexcept
     }
 }
 
+MePooConfig& MePooConfig::setFallbackPolicy(const MemPoolFallbackPolicy fallbackPolicy) noexcept
+{
+    m_fallbackPolicy = fallbackPolicy;
+    return *this;
+}
+
 /// this is the default memory pool configuration if no one is provided by the user
 MePooConfig& MePooConfig::setDefaults() noexcept
 {
@@ -136,6 +136,12 @@ ChunkHeader* SharedChunk::getChunkHeader() const noexcept
     }
 }
 
+ChunkTimestamps_t& SharedChunk::getTimestamps() const noexcept
+{
+    IOX_EXPECTS(m_chunkManagement != nullptr);
+    return *m_chunkManagement;
+}
+
 ChunkManagement* SharedChunk::release() noexcept
 {
     ChunkManagement* returnValue = m_chunkManagement;
@@ -143,5 +149,26 @@ ChunkManagement* SharedChunk::release() noexcept
     return returnValue;
 }
 
+void SharedChunk::acquireReferences(const uint64_t numberOfReferences) const noexcept
+{
+    if ((m_chunkManagement != nullptr) && (numberOfReferences > 0U))
+    {
+        m_chunkManagement->m_referenceCounter.fetch_add(numberOfReferences, std::memory_order_relaxed);
+    }
+}
+
+SharedChunk SharedChunk::adoptAcquiredReference() const noexcept
+{
+    return SharedChunk(m_chunkManagement);
+}
+
+void SharedChunk::releaseAcquiredReferences(const uint64_t numberOfReferences) const noexcept
+{
+    if ((m_chunkManagement != nullptr) && (numberOfReferences > 0U))
+    {
+        m_chunkManagement->m_referenceCounter.fetch_sub(numberOfReferences, std::memory_order_relaxed);
+    }
+}
+
 } // namespace mepoo
 } // namespace iox
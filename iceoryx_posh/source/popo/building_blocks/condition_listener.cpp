@@ -17,13 +17,68 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iox/deadline_timer.hpp"
+
+#include <algorithm>
+#include <thread>
 
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+namespace
+{
+/// @brief the deadline of the spinning is only checked every this many polls since reading the clock is much more
+/// expensive than polling the notifications
+constexpr uint64_t SPIN_ITERATIONS_PER_DEADLINE_CHECK{64U};
+
+/// @brief tells the CPU that this is a spin loop, which saves power and frees resources for a sibling hyper-thread;
+/// without such an instruction the core is given to other threads instead
+void relaxWhileSpinning() noexcept
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+/// @brief returns the index of the lowest set bit; the word must not be zero
+uint64_t indexOfLowestSetBit(const uint64_t word) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint64_t>(__builtin_ctzll(word));
+#else
+    uint64_t index = 0U;
+    while ((word & (static_cast<uint64_t>(1U) << index)) == 0U)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/// @brief returns how long the active notifications are polled before blocking
+units::Duration spinDuration(const WaitStrategy& waitStrategy, const units::Duration& timeToWait) noexcept
+{
+    switch (waitStrategy.type)
+    {
+    case WaitStrategyType::SPIN_THEN_BLOCK:
+        return std::min(waitStrategy.spinDuration, timeToWait);
+    case WaitStrategyType::BUSY_POLL:
+        return timeToWait;
+    case WaitStrategyType::BLOCKING:
+        break;
+    }
+    return units::Duration::zero();
+}
+} // namespace
+
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitStrategy(waitStrategy)
 {
 }
 
@@ -58,7 +113,7 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
+    return waitImpl(spinDuration(m_waitStrategy, units::Duration::max()), [this]() -> bool {
         if (this->getMembers()->m_semaphore->wait().has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
@@ -70,8 +125,15 @@ ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
+    deadline_timer deadline(timeToWait);
+    return waitImpl(spinDuration(m_waitStrategy, timeToWait), [this, &deadline]() -> bool {
+        // the time spent with polling counts towards the timeout
+        const auto remainingTime = deadline.remainingTime();
+        if (remainingTime == units::Duration::zero())
+        {
+            return false;
+        }
+        if (this->getMembers()->m_semaphore->timedWait(remainingTime).has_error())
         {
             errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
         }
@@ -79,38 +141,100 @@ ConditionListener::NotificationVector_t ConditionListener::timedWait(const units
     });
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()>& waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const units::Duration& spinDuration,
+                                                                    const function_ref<bool()>& waitCall) noexcept
 {
-    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
+    bool hasSpun = false;
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
-        {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
-            {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
-            }
-        }
+        collectActiveNotifications(activeNotifications);
         if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
             return activeNotifications;
         }
 
+        if (!hasSpun && spinDuration > units::Duration::zero())
+        {
+            spinUntilNotified(spinDuration);
+            hasSpun = true;
+            continue;
+        }
+
         doReturnAfterNotificationCollection = !waitCall();
+        hasSpun = false;
     }
 
     return activeNotifications;
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+void ConditionListener::spinUntilNotified(const units::Duration& spinDuration) noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    getMembers()->m_isListenerSpinning.store(true, std::memory_order_seq_cst);
+
+    deadline_timer spinDeadline(spinDuration);
+    uint64_t iteration{0U};
+    while (!hasActiveNotifications() && !m_toBeDestroyed.load(std::memory_order_relaxed))
+    {
+        ++iteration;
+        if (iteration % SPIN_ITERATIONS_PER_DEADLINE_CHECK == 0U && spinDeadline.hasExpired())
+        {
+            break;
+        }
+        relaxWhileSpinning();
+    }
+
+    // the notifications are collected again after the flag is reset; a notifier which did not post the semaphore
+    // has set its notification before and the collection sees it
+    getMembers()->m_isListenerSpinning.store(false, std::memory_order_seq_cst);
+}
+
+bool ConditionListener::hasActiveNotifications() const noexcept
+{
+    for (const auto& activeWord : getMembers()->m_activeNotifications)
+    {
+        if (activeWord.load(std::memory_order_relaxed) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
+{
+    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+    using Word_t = ConditionVariableData::NotificationWord_t;
+    constexpr uint64_t WORD_BITS = ConditionVariableData::NOTIFICATION_WORD_BITS;
+
+    bool hasCollectedNotifications = false;
+    for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
+    {
+        auto& activeWord = getMembers()->m_activeNotifications[wordIndex];
+        // the load avoids the read-modify-write on words without active notifications; it is sequentially
+        // consistent so that a notification which was set while the listener was spinning cannot be missed
+        if (activeWord.load(std::memory_order_seq_cst) == 0U)
+        {
+            continue;
+        }
+
+        Word_t word = activeWord.exchange(0U, std::memory_order_acquire);
+        hasCollectedNotifications = hasCollectedNotifications || (word != 0U);
+        while (word != 0U)
+        {
+            const auto bitIndex = indexOfLowestSetBit(word);
+            activeNotifications.emplace_back(static_cast<Type_t>(wordIndex * WORD_BITS + bitIndex));
+            word &= word - 1U;
+        }
+    }
+
+    if (hasCollectedNotifications)
+    {
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    }
 }
 
 const ConditionVariableData* ConditionListener::getMembers() volatile const noexcept
@@ -37,10 +37,21 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    constexpr uint64_t WORD_BITS = ConditionVariableData::NOTIFICATION_WORD_BITS;
+    const auto bit = static_cast<ConditionVariableData::NotificationWord_t>(1U) << (m_notificationIndex % WORD_BITS);
+    // sequentially consistent together with the load of m_isListenerSpinning; either the spinning listener sees the
+    // notification or this notifier sees that the listener stopped spinning and posts the semaphore
+    getMembers()->m_activeNotifications[m_notificationIndex / WORD_BITS].fetch_or(bit, std::memory_order_seq_cst);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
-    getMembers()->m_semaphore->post().or_else(
-        [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
+
+    // the semaphore is posted even when the notification was already active, since the notifier which activated it
+    // shares the index and may have been interrupted or may have died before it posted
+    if (!getMembers()->m_isListenerSpinning.load(std::memory_order_seq_cst))
+    {
+        getMembers()->m_semaphore->post().or_else([](auto) {
+            errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL);
+        });
+    }
 }
 
 const ConditionVariableData* ConditionNotifier::getMembers() const noexcept
@@ -33,10 +33,16 @@ ConditionVariableData::ConditionVariableData(const RuntimeName_t& runtimeName) n
         errorHandler(PoshError::POPO__CONDITION_VARIABLE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
     });
 
-    for (auto& id : m_activeNotifications)
+    for (auto& word : m_activeNotifications)
     {
-        id.store(false, std::memory_order_relaxed);
+        word.store(0U, std::memory_order_relaxed);
     }
 }
+
+bool ConditionVariableData::isNotificationActive(const uint64_t index) const noexcept
+{
+    const auto word = m_activeNotifications[index / NOTIFICATION_WORD_BITS].load(std::memory_order_relaxed);
+    return (word & (static_cast<NotificationWord_t>(1U) << (index % NOTIFICATION_WORD_BITS))) != 0U;
+}
 } // namespace popo
 } // namespace iox
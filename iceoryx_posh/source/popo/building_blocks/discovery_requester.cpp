@@ -0,0 +1,63 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_requester.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_request_queue_data.hpp"
+
+namespace iox
+{
+namespace popo
+{
+void DiscoveryRequester::init(DiscoveryRequestQueueData& queue, const DiscoveryRequest request) noexcept
+{
+    m_queue = &queue;
+    m_request = request;
+    m_isRequested.store(false, std::memory_order_relaxed);
+}
+
+void DiscoveryRequester::requestDiscovery() noexcept
+{
+    if (!m_queue)
+    {
+        return;
+    }
+
+    // the acq_rel pairs with acknowledge and ensures that RouDi sees the state change which led to this request
+    if (m_isRequested.exchange(true, std::memory_order_acq_rel))
+    {
+        // already enqueued and not yet processed by RouDi
+        return;
+    }
+
+    if (!m_queue->m_requests.tryPush(m_request))
+    {
+        // cannot happen as long as every entry is only enqueued once; the full discovery run catches the change
+        m_isRequested.store(false, std::memory_order_relaxed);
+        m_queue->m_hasOverflowed.store(true, std::memory_order_release);
+    }
+
+    ConditionNotifier(m_queue->m_conditionVariableData, DiscoveryRequestQueueData::DISCOVERY_REQUEST_NOTIFICATION_INDEX)
+        .notify();
+}
+
+void DiscoveryRequester::acknowledge() noexcept
+{
+    m_isRequested.exchange(false, std::memory_order_acq_rel);
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,173 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+/// @brief returns the index of the highest set bit; the value must not be zero
+uint32_t indexOfHighestSetBit(const uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63U - static_cast<uint32_t>(__builtin_clzll(value));
+#else
+    uint32_t index = 63U;
+    while ((value & (static_cast<uint64_t>(1U) << index)) == 0U)
+    {
+        --index;
+    }
+    return index;
+#endif
+}
+
+/// @brief the latency between two timestamps; a later timestamp cannot be smaller but this is not trusted blindly
+uint64_t latencyBetween(const uint64_t earlier, const uint64_t later) noexcept
+{
+    return (later > earlier) ? later - earlier : 0U;
+}
+} // namespace
+
+constexpr uint32_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint64_t LatencyHistogram::SUB_BUCKET_COUNT;
+constexpr uint32_t LatencyHistogram::MAX_EXPONENT;
+constexpr uint32_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+void LatencyHistogram::record(const uint64_t nanoseconds) noexcept
+{
+    m_buckets[bucketIndex(nanoseconds)].fetch_add(1U, std::memory_order_relaxed);
+    m_sampleCount.fetch_add(1U, std::memory_order_relaxed);
+
+    auto maximum = m_maximum.load(std::memory_order_relaxed);
+    while (nanoseconds > maximum
+           && !m_maximum.compare_exchange_weak(maximum, nanoseconds, std::memory_order_relaxed))
+    {
+    }
+}
+
+uint64_t LatencyHistogram::sampleCount() const noexcept
+{
+    return m_sampleCount.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::maximum() const noexcept
+{
+    return m_maximum.load(std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::valueAtPercentile(const double percentile) const noexcept
+{
+    const auto numberOfSamples = sampleCount();
+    if (numberOfSamples == 0U)
+    {
+        return 0U;
+    }
+
+    const auto clampedPercentile = std::min(std::max(percentile, 0.0), 100.0);
+    const auto requiredSamples = std::max(
+        static_cast<uint64_t>(std::ceil(clampedPercentile / 100.0 * static_cast<double>(numberOfSamples))),
+        static_cast<uint64_t>(1U));
+
+    // the histogram might be recorded concurrently, therefore the buckets might not yet contain all samples of the
+    // sample count; in this case the maximum is returned
+    uint64_t samples{0U};
+    for (uint32_t index = 0U; index < NUMBER_OF_BUCKETS; ++index)
+    {
+        samples += m_buckets[index].load(std::memory_order_relaxed);
+        if (samples >= requiredSamples)
+        {
+            return std::min(upperBound(index), maximum());
+        }
+    }
+    return maximum();
+}
+
+uint32_t LatencyHistogram::bucketIndex(const uint64_t value) noexcept
+{
+    if (value < SUB_BUCKET_COUNT)
+    {
+        return static_cast<uint32_t>(value);
+    }
+
+    const auto exponent = indexOfHighestSetBit(value);
+    if (exponent >= MAX_EXPONENT)
+    {
+        return NUMBER_OF_BUCKETS - 1U;
+    }
+
+    // the bits below the highest set bit select the sub-bucket
+    const auto subBucket = (value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1U);
+    return (exponent - SUB_BUCKET_BITS + 1U) * static_cast<uint32_t>(SUB_BUCKET_COUNT) + static_cast<uint32_t>(subBucket);
+}
+
+uint64_t LatencyHistogram::lowerBound(const uint32_t index) noexcept
+{
+    if (index < SUB_BUCKET_COUNT)
+    {
+        return index;
+    }
+
+    const auto group = index / SUB_BUCKET_COUNT;
+    const auto subBucket = index % SUB_BUCKET_COUNT;
+    return (SUB_BUCKET_COUNT + subBucket) << (group - 1U);
+}
+
+uint64_t LatencyHistogram::upperBound(const uint32_t index) noexcept
+{
+    if (index + 1U >= NUMBER_OF_BUCKETS)
+    {
+        return (static_cast<uint64_t>(1U) << MAX_EXPONENT) - 1U;
+    }
+    return lowerBound(index + 1U) - 1U;
+}
+
+uint64_t latencyTimestamp() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+void recordLoan(mepoo::ChunkTimestamps& timestamps) noexcept
+{
+    timestamps.loan = latencyTimestamp();
+}
+
+void recordPublish(mepoo::ChunkTimestamps& timestamps, ChunkSenderLatencyHistograms& histograms) noexcept
+{
+    timestamps.publish = latencyTimestamp();
+    histograms.loanToPublish.record(latencyBetween(timestamps.loan, timestamps.publish));
+}
+
+void recordDelivery(const mepoo::ChunkTimestamps& timestamps, ChunkSenderLatencyHistograms& histograms) noexcept
+{
+    histograms.publishToDelivery.record(latencyBetween(timestamps.publish, latencyTimestamp()));
+}
+
+void recordTake(const mepoo::ChunkTimestamps& timestamps, ChunkReceiverLatencyHistograms& histograms) noexcept
+{
+    histograms.publishToTake.record(latencyBetween(timestamps.publish, latencyTimestamp()));
+}
+
+} // namespace popo
+} // namespace iox
@@ -24,8 +24,13 @@ Listener::Listener() noexcept
 {
 }
 
-Listener::Listener(ConditionVariableData& conditionVariableData) noexcept
-    : Parent(conditionVariableData)
+Listener::Listener(const WaitStrategy& waitStrategy) noexcept
+    : Parent(waitStrategy)
+{
+}
+
+Listener::Listener(ConditionVariableData& conditionVariableData, const WaitStrategy& waitStrategy) noexcept
+    : Parent(conditionVariableData, waitStrategy)
 {
 }
 
@@ -69,6 +69,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    getMembers()->m_discoveryRequester.requestDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -48,6 +48,17 @@ PublisherPortUser::tryAllocateChunk(const uint32_t userPayloadSize,
         getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
 }
 
+expected<void, AllocationError>
+PublisherPortUser::tryAllocateChunkBatch(const uint32_t userPayloadSize,
+                                         const uint32_t userPayloadAlignment,
+                                         const uint32_t userHeaderSize,
+                                         const uint32_t userHeaderAlignment,
+                                         const span<mepoo::ChunkHeader*> chunkHeaders) noexcept
+{
+    return m_chunkSender.tryAllocateBatch(
+        getUniqueID(), userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment, chunkHeaders);
+}
+
 void PublisherPortUser::releaseChunk(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkSender.release(chunkHeader);
@@ -71,6 +82,24 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunkBatch(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendBatch(chunkHeaders);
+    }
+    else
+    {
+        // if the publisher port is not offered, the chunks are only put in the history; see sendChunk
+        for (uint64_t i = 0U; i < chunkHeaders.size(); ++i)
+        {
+            m_chunkSender.pushToHistory(chunkHeaders[i]);
+        }
+    }
+}
+
 optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -81,6 +110,7 @@ void PublisherPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryRequester.requestDiscovery();
     }
 }
 
@@ -89,6 +119,7 @@ void PublisherPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryRequester.requestDiscovery();
     }
 }
 
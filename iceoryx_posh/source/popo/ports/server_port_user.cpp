@@ -162,6 +162,7 @@ void ServerPortUser::offer() noexcept
     if (!getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryRequester.requestDiscovery();
     }
 }
 
@@ -170,6 +171,7 @@ void ServerPortUser::stopOffer() noexcept
     if (getMembers()->m_offeringRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_offeringRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryRequester.requestDiscovery();
     }
 }
 
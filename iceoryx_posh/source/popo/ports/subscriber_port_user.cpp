@@ -47,6 +47,7 @@ void SubscriberPortUser::subscribe() noexcept
         m_chunkReceiver.clear();
 
         getMembers()->m_subscribeRequested.store(true, std::memory_order_relaxed);
+        getMembers()->m_discoveryRequester.requestDiscovery();
     }
 }
 
@@ -55,6 +56,7 @@ void SubscriberPortUser::unsubscribe() noexcept
     if (getMembers()->m_subscribeRequested.load(std::memory_order_relaxed))
     {
         getMembers()->m_subscribeRequested.store(false, std::memory_order_relaxed);
+        getMembers()->m_discoveryRequester.requestDiscovery();
     }
 }
 
@@ -68,11 +70,34 @@ expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryG
     return m_chunkReceiver.tryGet();
 }
 
+expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryGetChunk(uint32_t& slotIndex) noexcept
+{
+    return m_chunkReceiver.tryGet(slotIndex);
+}
+
+expected<uint64_t, ChunkReceiveResult>
+SubscriberPortUser::tryGetChunkBatch(const span<const mepoo::ChunkHeader*> chunkHeaders,
+                                     const span<uint32_t> slotIndices) noexcept
+{
+    return m_chunkReceiver.tryGetBatch(chunkHeaders, slotIndices);
+}
+
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkReceiver.release(chunkHeader);
 }
 
+void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader, const uint32_t slotIndex) noexcept
+{
+    m_chunkReceiver.release(chunkHeader, slotIndex);
+}
+
+void SubscriberPortUser::releaseChunkBatch(const span<const mepoo::ChunkHeader* const> chunkHeaders,
+                                           const span<const uint32_t> slotIndices) noexcept
+{
+    m_chunkReceiver.releaseBatch(chunkHeaders, slotIndices);
+}
+
 void SubscriberPortUser::releaseQueuedChunks() noexcept
 {
     m_chunkReceiver.clear();
@@ -49,7 +49,8 @@ uint8_t IceOryxRouDiApp::run() noexcept
                                                            RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
                                                            m_compatibilityCheckLevel,
                                                            m_processKillDelay,
-                                                           m_processTeminationDelay});
+                                                           m_processTeminationDelay,
+                                                           m_runtimeMessageWorkers});
         iox::posix::waitForTerminationRequest();
     }
     return EXIT_SUCCESS;
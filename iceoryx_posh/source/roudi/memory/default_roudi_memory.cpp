@@ -18,6 +18,7 @@
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_changes.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/memory.hpp"
 
@@ -29,7 +30,10 @@ DefaultRouDiMemory::DefaultRouDiMemory(const RouDiConfig_t& roudiConfig) noexcep
     : m_introspectionMemPoolBlock(introspectionMemPoolConfig(roudiConfig.introspectionChunkCount))
     , m_discoveryMemPoolBlock(discoveryMemPoolConfig(roudiConfig.discoveryChunkCount))
     , m_segmentManagerBlock(roudiConfig)
-    , m_managementShm(SHM_NAME, posix::AccessMode::READ_WRITE, posix::OpenMode::PURGE_AND_CREATE)
+    , m_managementShm(SHM_NAME,
+                      posix::AccessMode::READ_WRITE,
+                      posix::OpenMode::PURGE_AND_CREATE,
+                      roudiConfig.m_zeroingOptions)
 {
     m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         errorHandler(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK,
@@ -62,6 +66,11 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig(const uint32_t
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::SubscriberPortChangingIntrospectionFieldTopic)), ALIGNMENT),
          chunkCount});
+    if (build::IOX_LATENCY_INSTRUMENTATION)
+    {
+        mempoolConfig.m_mempoolConfig.push_back(
+            {align(static_cast<uint32_t>(sizeof(roudi::PortLatencyIntrospectionFieldTopic)), ALIGNMENT), chunkCount});
+    }
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -73,6 +82,10 @@ mepoo::MePooConfig DefaultRouDiMemory::discoveryMemPoolConfig(const uint32_t chu
     mepoo::MePooConfig mempoolConfig;
     mempoolConfig.m_mempoolConfig.push_back(
         {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistry)), ALIGNMENT), chunkCount});
+    // the subscribers keep up to SNAPSHOT_INTERVAL publications of changes in their queues
+    mempoolConfig.m_mempoolConfig.push_back(
+        {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistryChanges)), ALIGNMENT),
+         chunkCount * static_cast<uint32_t>(roudi::ServiceRegistryChanges::SNAPSHOT_INTERVAL)});
 
     mempoolConfig.optimize();
     return mempoolConfig;
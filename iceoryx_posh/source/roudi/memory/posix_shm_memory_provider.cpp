@@ -31,10 +31,12 @@ constexpr access_rights PosixShmMemoryProvider::SHM_MEMORY_PERMISSIONS;
 
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const posix::AccessMode accessMode,
-                                               const posix::OpenMode openMode) noexcept
+                                               const posix::OpenMode openMode,
+                                               const posix::SharedMemoryZeroingOptions& zeroingOptions) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_zeroingOptions(zeroingOptions)
 {
 }
 
@@ -60,6 +62,7 @@ expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(const
              .accessMode(m_accessMode)
              .openMode(m_openMode)
              .permissions(SHM_MEMORY_PERMISSIONS)
+             .zeroingOptions(m_zeroingOptions)
              .create()
              .and_then([this](auto& sharedMemoryObject) { m_shmObject.emplace(std::move(sharedMemoryObject)); }))
     {
@@ -20,6 +20,8 @@
 #include "iceoryx_posh/roudi/memory/memory_provider.hpp"
 #include "iox/logging.hpp"
 
+#include <chrono>
+
 namespace iox
 {
 namespace roudi
@@ -68,6 +70,7 @@ expected<void, RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMem
         return err(RouDiMemoryManagerError::NO_MEMORY_PROVIDER_PRESENT);
     }
 
+    const auto creationStart = std::chrono::steady_clock::now();
     for (auto memoryProvider : m_memoryProvider)
     {
         auto result = memoryProvider->create();
@@ -80,10 +83,20 @@ expected<void, RouDiMemoryManagerError> RouDiMemoryManager::createAndAnnounceMem
         }
     }
 
+    const auto announcementStart = std::chrono::steady_clock::now();
     for (auto memoryProvider : m_memoryProvider)
     {
         memoryProvider->announceMemoryAvailable();
     }
+    const auto announcementEnd = std::chrono::steady_clock::now();
+
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    const auto creationDuration = Milliseconds(announcementStart - creationStart);
+    const auto announcementDuration = Milliseconds(announcementEnd - announcementStart);
+    IOX_LOG(INFO,
+            "Created the memory of the memory providers in " << creationDuration.count()
+                                                             << " ms and initialized the memory blocks in "
+                                                             << announcementDuration.count() << " ms");
 
     return ok();
 }
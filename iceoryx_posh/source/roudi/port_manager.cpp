@@ -72,9 +72,21 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
         registryPortOptions,
         discoveryMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    popo::PublisherOptions registryChangesPortOptions;
+    registryChangesPortOptions.historyCapacity = ServiceRegistryChanges::HISTORY_CAPACITY;
+    registryChangesPortOptions.nodeName = iox::NodeName_t("Service Registry");
+    registryChangesPortOptions.offerOnCreate = true;
+
+    m_serviceRegistryChangesPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_CHANGES_EVENT_NAME},
+        registryChangesPortOptions,
+        discoveryMemoryManager);
+
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryChangesPort(*m_serviceRegistryChangesPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryChangesPort);
 
     auto maybeIntrospectionMemoryManager = m_roudiMemoryInterface->introspectionMemoryManager();
     if (!maybeIntrospectionMemoryManager.has_value())
@@ -100,6 +112,13 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     m_portIntrospection.registerPublisherPort(PublisherPortUserType(std::move(portGeneric)),
                                               PublisherPortUserType(std::move(portThroughput)),
                                               PublisherPortUserType(std::move(subscriberPortsData)));
+
+    if (build::IOX_LATENCY_INSTRUMENTATION)
+    {
+        auto portLatency =
+            acquireInternalPublisherPortData(IntrospectionPortLatencyService, options, introspectionMemoryManager);
+        m_portIntrospection.registerLatencyPublisherPort(PublisherPortUserType(std::move(portLatency)));
+    }
     m_portIntrospection.run();
 }
 
@@ -109,6 +128,12 @@ void PortManager::stopPortIntrospection() noexcept
 }
 
 void PortManager::doDiscovery() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    doDiscoveryForAllPorts();
+}
+
+void PortManager::doDiscoveryForAllPorts() noexcept
 {
     handlePublisherPorts();
 
@@ -127,6 +152,136 @@ void PortManager::doDiscovery() noexcept
     publishServiceRegistry();
 }
 
+void PortManager::handleDiscoveryRequests() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& discoveryRequests = m_portPool->getDiscoveryRequestQueue();
+    for (auto request = discoveryRequests.m_requests.pop(); request.has_value();
+         request = discoveryRequests.m_requests.pop())
+    {
+        handleDiscoveryRequest(request.value());
+    }
+
+    if (discoveryRequests.m_hasOverflowed.exchange(false, std::memory_order_acquire))
+    {
+        IOX_LOG(WARN, "Not all discovery requests could be enqueued! Doing the discovery for all ports.");
+        doDiscoveryForAllPorts();
+        return;
+    }
+
+    publishServiceRegistry();
+}
+
+popo::DiscoveryRequestQueueData& PortManager::discoveryRequestQueue() noexcept
+{
+    return m_portPool->getDiscoveryRequestQueue();
+}
+
+void PortManager::handleDiscoveryRequest(const popo::DiscoveryRequest& request) noexcept
+{
+    // the entry might already be removed or even replaced by a new one since the request was enqueued; the former
+    // case is skipped and the latter one is harmless since the discovery only acts on state changes
+    auto acknowledgedEntry = [&request](auto& container) -> decltype(container.begin().to_ptr()) {
+        using IndexType = typename std::remove_reference_t<decltype(container)>::IndexType;
+        auto entry = container.iter_from_index(static_cast<IndexType>(request.index));
+        if (entry == container.end())
+        {
+            return nullptr;
+        }
+        entry->m_discoveryRequester.acknowledge();
+        return entry.to_ptr();
+    };
+
+    switch (request.source)
+    {
+    case popo::DiscoveryRequestSource::PUBLISHER_PORT:
+        if (auto* const publisherPortData = acknowledgedEntry(m_portPool->getPublisherPortDataList()))
+        {
+            PublisherPortRouDiType publisherPort(publisherPortData);
+            doDiscoveryForPublisherPort(publisherPort);
+            if (publisherPort.toBeDestroyed())
+            {
+                destroyPublisherPort(publisherPortData);
+            }
+        }
+        break;
+    case popo::DiscoveryRequestSource::SUBSCRIBER_PORT:
+        if (auto* const subscriberPortData = acknowledgedEntry(m_portPool->getSubscriberPortDataList()))
+        {
+            SubscriberPortType subscriberPort(subscriberPortData);
+            doDiscoveryForSubscriberPort(subscriberPort);
+            if (subscriberPort.toBeDestroyed())
+            {
+                destroySubscriberPort(subscriberPortData);
+            }
+        }
+        break;
+    case popo::DiscoveryRequestSource::SERVER_PORT:
+        if (auto* const serverPortData = acknowledgedEntry(m_portPool->getServerPortDataList()))
+        {
+            popo::ServerPortRouDi serverPort(*serverPortData);
+            doDiscoveryForServerPort(serverPort);
+            if (serverPort.toBeDestroyed())
+            {
+                destroyServerPort(serverPortData);
+            }
+        }
+        break;
+    case popo::DiscoveryRequestSource::CLIENT_PORT:
+        if (auto* const clientPortData = acknowledgedEntry(m_portPool->getClientPortDataList()))
+        {
+            popo::ClientPortRouDi clientPort(*clientPortData);
+            doDiscoveryForClientPort(clientPort);
+            if (clientPort.toBeDestroyed())
+            {
+                destroyClientPort(clientPortData);
+            }
+        }
+        break;
+    case popo::DiscoveryRequestSource::INTERFACE_PORT:
+        if (auto* const interfacePortData = acknowledgedEntry(m_portPool->getInterfacePortDataList()))
+        {
+            if (interfacePortData->m_toBeDestroyed.load(std::memory_order_relaxed))
+            {
+                IOX_LOG(DEBUG,
+                        "Destroy interface port from runtime '" << interfacePortData->m_runtimeName
+                                                                << "' and with service description '"
+                                                                << interfacePortData->m_serviceDescription << "'");
+                m_portPool->removeInterfacePort(interfacePortData);
+            }
+            else if (interfacePortData->m_doInitialOfferForward)
+            {
+                interfacePortData->m_doInitialOfferForward = false;
+                const vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> newInterfacePorts(1U, interfacePortData);
+                forwardOffersToNewInterfacePorts(newInterfacePorts);
+            }
+        }
+        break;
+    case popo::DiscoveryRequestSource::NODE:
+        if (auto* const nodeData = acknowledgedEntry(m_portPool->getNodeDataList()))
+        {
+            if (nodeData->m_toBeDestroyed.load(std::memory_order_relaxed))
+            {
+                IOX_LOG(DEBUG,
+                        "Destroy NodeData from runtime '" << nodeData->m_runtimeName << "' and node name '"
+                                                          << nodeData->m_nodeName << "'");
+                m_portPool->removeNodeData(nodeData);
+            }
+        }
+        break;
+    case popo::DiscoveryRequestSource::CONDITION_VARIABLE:
+        if (auto* const condVarData = acknowledgedEntry(m_portPool->getConditionVariableDataList()))
+        {
+            if (condVarData->m_toBeDestroyed.load(std::memory_order_relaxed))
+            {
+                IOX_LOG(DEBUG, "Destroy ConditionVariableData from runtime '" << condVarData->m_runtimeName << "'");
+                m_portPool->removeConditionVariableData(condVarData);
+            }
+        }
+        break;
+    }
+}
+
 void PortManager::handlePublisherPorts() noexcept
 {
     // get the changes of publisher port offer state
@@ -411,7 +566,6 @@ void PortManager::handleInterfaces() noexcept
     // check if there are new interfaces that must get an initial offer information
     vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER> interfacePortsForInitialForwarding;
 
-
     auto& interfacePorts = m_portPool->getInterfacePortDataList();
     auto port = interfacePorts.begin();
     while (port != interfacePorts.end())
@@ -434,47 +588,55 @@ void PortManager::handleInterfaces() noexcept
         }
     }
 
-    if (interfacePortsForInitialForwarding.size() > 0)
+    forwardOffersToNewInterfacePorts(interfacePortsForInitialForwarding);
+}
+
+void PortManager::forwardOffersToNewInterfacePorts(
+    const vector<popo::InterfacePortData*, MAX_INTERFACE_NUMBER>& interfacePortsForInitialForwarding) noexcept
+{
+    if (interfacePortsForInitialForwarding.empty())
     {
-        // provide offer information from all active publisher ports to all new interfaces
-        capro::CaproMessage caproMessage;
-        caproMessage.m_type = capro::CaproMessageType::OFFER;
-        caproMessage.m_serviceType = capro::CaproServiceType::PUBLISHER;
-        for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
+        return;
+    }
+
+    // provide offer information from all active publisher ports to all new interfaces
+    capro::CaproMessage caproMessage;
+    caproMessage.m_type = capro::CaproMessageType::OFFER;
+    caproMessage.m_serviceType = capro::CaproServiceType::PUBLISHER;
+    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        PublisherPortUserType publisherPort(&publisherPortData);
+        if (publisherPort.isOffered())
         {
-            PublisherPortUserType publisherPort(&publisherPortData);
-            if (publisherPort.isOffered())
+            caproMessage.m_serviceDescription = publisherPort.getCaProServiceDescription();
+            for (auto& interfacePortData : interfacePortsForInitialForwarding)
             {
-                caproMessage.m_serviceDescription = publisherPort.getCaProServiceDescription();
-                for (auto& interfacePortData : interfacePortsForInitialForwarding)
+                auto interfacePort = popo::InterfacePort(interfacePortData);
+                // do not offer on same interface
+                if (publisherPort.getCaProServiceDescription().getSourceInterface()
+                    != interfacePort.getCaProServiceDescription().getSourceInterface())
                 {
-                    auto interfacePort = popo::InterfacePort(interfacePortData);
-                    // do not offer on same interface
-                    if (publisherPort.getCaProServiceDescription().getSourceInterface()
-                        != interfacePort.getCaProServiceDescription().getSourceInterface())
-                    {
-                        interfacePort.dispatchCaProMessage(caproMessage);
-                    }
+                    interfacePort.dispatchCaProMessage(caproMessage);
                 }
             }
         }
-        // provide offer information from all active server ports to all new interfaces
-        caproMessage.m_serviceType = capro::CaproServiceType::SERVER;
-        for (auto& serverPortData : m_portPool->getServerPortDataList())
+    }
+    // provide offer information from all active server ports to all new interfaces
+    caproMessage.m_serviceType = capro::CaproServiceType::SERVER;
+    for (auto& serverPortData : m_portPool->getServerPortDataList())
+    {
+        popo::ServerPortUser serverPort(serverPortData);
+        if (serverPort.isOffered())
         {
-            popo::ServerPortUser serverPort(serverPortData);
-            if (serverPort.isOffered())
+            caproMessage.m_serviceDescription = serverPort.getCaProServiceDescription();
+            for (auto& interfacePortData : interfacePortsForInitialForwarding)
             {
-                caproMessage.m_serviceDescription = serverPort.getCaProServiceDescription();
-                for (auto& interfacePortData : interfacePortsForInitialForwarding)
+                auto interfacePort = popo::InterfacePort(interfacePortData);
+                // do not offer on same interface
+                if (serverPort.getCaProServiceDescription().getSourceInterface()
+                    != interfacePort.getCaProServiceDescription().getSourceInterface())
                 {
-                    auto interfacePort = popo::InterfacePort(interfacePortData);
-                    // do not offer on same interface
-                    if (serverPort.getCaProServiceDescription().getSourceInterface()
-                        != interfacePort.getCaProServiceDescription().getSourceInterface())
-                    {
-                        interfacePort.dispatchCaProMessage(caproMessage);
-                    }
+                    interfacePort.dispatchCaProMessage(caproMessage);
                 }
             }
         }
@@ -542,8 +704,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
                                                   SubscriberPortType& subscriberSource) noexcept
 {
     bool publisherFound = false;
-    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
-    {
+    m_portPool->forEachPublisherPort(subscriberSource.getCaProServiceDescription(), [&](auto& publisherPortData) {
         PublisherPortRouDiType publisherPort(&publisherPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
@@ -554,7 +715,7 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
         if (publisherInterface != capro::Interfaces::INTERNAL && publisherInterface == messageInterface)
         {
             // iox-#1908
-            continue;
+            return;
         }
 
         if (isCompatiblePubSub(publisherPort, subscriberSource))
@@ -574,15 +735,14 @@ bool PortManager::sendToAllMatchingPublisherPorts(const capro::CaproMessage& mes
             }
             publisherFound = true;
         }
-    }
+    });
     return publisherFound;
 }
 
 void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& message,
                                                    PublisherPortRouDiType& publisherSource) noexcept
 {
-    for (auto& subscriberPortData : m_portPool->getSubscriberPortDataList())
-    {
+    m_portPool->forEachSubscriberPort(publisherSource.getCaProServiceDescription(), [&](auto& subscriberPortData) {
         SubscriberPortType subscriberPort(&subscriberPortData);
 
         auto messageInterface = message.m_serviceDescription.getSourceInterface();
@@ -593,7 +753,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
         if (subscriberInterface != capro::Interfaces::INTERNAL && subscriberInterface == messageInterface)
         {
             // iox-#1908
-            continue;
+            return;
         }
 
         if (isCompatiblePubSub(publisherSource, subscriberPort))
@@ -625,7 +785,7 @@ void PortManager::sendToAllMatchingSubscriberPorts(const capro::CaproMessage& me
                 }
             }
         }
-    }
+    });
 }
 
 bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
@@ -648,8 +808,7 @@ bool PortManager::isCompatibleClientServer(const popo::ServerPortRouDi& server,
 void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& message,
                                                popo::ServerPortRouDi& serverSource) noexcept
 {
-    for (auto& clientPortData : m_portPool->getClientPortDataList())
-    {
+    m_portPool->forEachClientPort(serverSource.getCaProServiceDescription(), [&](auto& clientPortData) {
         popo::ClientPortRouDi clientPort(clientPortData);
         if (isCompatibleClientServer(serverSource, clientPort))
         {
@@ -678,15 +837,14 @@ void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& messag
                 }
             }
         }
-    }
+    });
 }
 
 bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& message,
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
     bool serverFound = false;
-    for (auto& serverPortData : m_portPool->getServerPortDataList())
-    {
+    m_portPool->forEachServerPort(clientSource.getCaProServiceDescription(), [&](auto& serverPortData) {
         popo::ServerPortRouDi serverPort(serverPortData);
         if (isCompatibleClientServer(serverPort, clientSource))
         {
@@ -706,7 +864,7 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
             }
             serverFound = true;
         }
-    }
+    });
     return serverFound;
 }
 
@@ -726,6 +884,7 @@ void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& mes
 
 void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     for (auto& port : m_portPool->getPublisherPortDataList())
     {
         PublisherPortRouDiType publisherPort(&port);
@@ -749,6 +908,7 @@ void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexc
 
 void PortManager::unblockRouDiShutdown() noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     makeAllPublisherPortsToStopOffer();
     makeAllServerPortsToStopOffer();
 }
@@ -766,10 +926,12 @@ void PortManager::makeAllPublisherPortsToStopOffer() noexcept
 
 void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     // If we delete all ports from RouDi we need to reset the service registry publisher
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
+        m_serviceRegistryChangesPublisherPortData.reset();
     }
     auto& publisherPorts = m_portPool->getPublisherPortDataList();
     auto publisherPort = publisherPorts.begin();
@@ -921,6 +1083,18 @@ PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
                                       const RuntimeName_t& runtimeName,
                                       mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                       const PortConfigInfo& portConfigInfo) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return acquirePublisherPortDataWithoutLock(
+        service, publisherOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo);
+}
+
+expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
+PortManager::acquirePublisherPortDataWithoutLock(const capro::ServiceDescription& service,
+                                                 const popo::PublisherOptions& publisherOptions,
+                                                 const RuntimeName_t& runtimeName,
+                                                 mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                                 const PortConfigInfo& portConfigInfo) noexcept
 {
     return acquirePublisherPortDataWithoutDiscovery(
                service, publisherOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo)
@@ -982,6 +1156,7 @@ PortManager::acquireInternalPublisherPortData(const capro::ServiceDescription& s
                                               const popo::PublisherOptions& publisherOptions,
                                               mepoo::MemoryManager* const payloadDataSegmentMemoryManager) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return acquirePublisherPortDataWithoutDiscovery(
                service, publisherOptions, IPC_CHANNEL_ROUDI_NAME, payloadDataSegmentMemoryManager, PortConfigInfo())
         .or_else([&service](auto&) {
@@ -1015,6 +1190,16 @@ PortManager::acquireSubscriberPortData(const capro::ServiceDescription& service,
                                        const popo::SubscriberOptions& subscriberOptions,
                                        const RuntimeName_t& runtimeName,
                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return acquireSubscriberPortDataWithoutLock(service, subscriberOptions, runtimeName, portConfigInfo);
+}
+
+expected<SubscriberPortType::MemberType_t*, PortPoolError>
+PortManager::acquireSubscriberPortDataWithoutLock(const capro::ServiceDescription& service,
+                                                  const popo::SubscriberOptions& subscriberOptions,
+                                                  const RuntimeName_t& runtimeName,
+                                                  const PortConfigInfo& portConfigInfo) noexcept
 {
     auto maybeSubscriberPortData =
         m_portPool->addSubscriberPort(service, runtimeName, subscriberOptions, portConfigInfo.memoryInfo);
@@ -1040,6 +1225,18 @@ PortManager::acquireClientPortData(const capro::ServiceDescription& service,
                                    const RuntimeName_t& runtimeName,
                                    mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                    const PortConfigInfo& portConfigInfo) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return acquireClientPortDataWithoutLock(
+        service, clientOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo);
+}
+
+expected<popo::ClientPortData*, PortPoolError>
+PortManager::acquireClientPortDataWithoutLock(const capro::ServiceDescription& service,
+                                              const popo::ClientOptions& clientOptions,
+                                              const RuntimeName_t& runtimeName,
+                                              mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                              const PortConfigInfo& portConfigInfo) noexcept
 {
     // we can create a new port
     return m_portPool
@@ -1059,6 +1256,18 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                                    const RuntimeName_t& runtimeName,
                                    mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                    const PortConfigInfo& portConfigInfo) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return acquireServerPortDataWithoutLock(
+        service, serverOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo);
+}
+
+expected<popo::ServerPortData*, PortPoolError>
+PortManager::acquireServerPortDataWithoutLock(const capro::ServiceDescription& service,
+                                              const popo::ServerOptions& serverOptions,
+                                              const RuntimeName_t& runtimeName,
+                                              mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                              const PortConfigInfo& portConfigInfo) noexcept
 {
     // it is not allowed to have two servers with the same ServiceDescription;
     // check if the server is already in the list
@@ -1098,14 +1307,71 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
         });
 }
 
+void PortManager::acquirePortDataBatch(const function_ref<void(PortDataBatch&)> acquirePorts) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PortDataBatch portDataBatch(*this);
+    acquirePorts(portDataBatch);
+}
+
+PortManager::PortDataBatch::PortDataBatch(PortManager& portManager) noexcept
+    : m_portManager(portManager)
+{
+}
+
+expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
+PortManager::PortDataBatch::acquirePublisherPortData(const capro::ServiceDescription& service,
+                                                     const popo::PublisherOptions& publisherOptions,
+                                                     const RuntimeName_t& runtimeName,
+                                                     mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                                     const PortConfigInfo& portConfigInfo) noexcept
+{
+    return m_portManager.acquirePublisherPortDataWithoutLock(
+        service, publisherOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo);
+}
+
+expected<SubscriberPortType::MemberType_t*, PortPoolError>
+PortManager::PortDataBatch::acquireSubscriberPortData(const capro::ServiceDescription& service,
+                                                      const popo::SubscriberOptions& subscriberOptions,
+                                                      const RuntimeName_t& runtimeName,
+                                                      const PortConfigInfo& portConfigInfo) noexcept
+{
+    return m_portManager.acquireSubscriberPortDataWithoutLock(service, subscriberOptions, runtimeName, portConfigInfo);
+}
+
+expected<popo::ClientPortData*, PortPoolError>
+PortManager::PortDataBatch::acquireClientPortData(const capro::ServiceDescription& service,
+                                                  const popo::ClientOptions& clientOptions,
+                                                  const RuntimeName_t& runtimeName,
+                                                  mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                                  const PortConfigInfo& portConfigInfo) noexcept
+{
+    return m_portManager.acquireClientPortDataWithoutLock(
+        service, clientOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo);
+}
+
+expected<popo::ServerPortData*, PortPoolError>
+PortManager::PortDataBatch::acquireServerPortData(const capro::ServiceDescription& service,
+                                                  const popo::ServerOptions& serverOptions,
+                                                  const RuntimeName_t& runtimeName,
+                                                  mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
+                                                  const PortConfigInfo& portConfigInfo) noexcept
+{
+    return m_portManager.acquireServerPortDataWithoutLock(
+        service, serverOptions, runtimeName, payloadDataSegmentMemoryManager, portConfigInfo);
+}
+
 /// @todo iox-#518 return a expected
 popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces interface,
                                                                const RuntimeName_t& runtimeName,
                                                                const NodeName_t& /*node*/) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     auto result = m_portPool->addInterfacePort(runtimeName, interface);
     if (result.has_value())
     {
+        // the initial offer forwarding is done by the discovery loop
+        result.value()->m_discoveryRequester.requestDiscovery();
         return result.value();
     }
     else
@@ -1121,15 +1387,41 @@ void PortManager::publishServiceRegistry() noexcept
         return;
     }
 
-    if (!m_serviceRegistryPublisherPortData.has_value())
+    if (!m_serviceRegistryPublisherPortData.has_value() || !m_serviceRegistryChangesPublisherPortData.has_value())
     {
         // should not happen (except during RouDi shutdown)
-        // the port always exists, otherwise we would terminate during startup
+        // the ports always exist, otherwise we would terminate during startup
         IOX_LOG(WARN, "Could not publish service registry!");
         return;
     }
+
+    // the snapshot is published before the changes in order to be available when a subscriber detects missing changes
+    if (m_isServiceRegistrySnapshotRequired
+        || m_serviceRegistryChangesSinceSnapshot >= ServiceRegistryChanges::SNAPSHOT_INTERVAL)
+    {
+        if (publishServiceRegistrySnapshot())
+        {
+            m_isServiceRegistrySnapshotRequired = false;
+            m_serviceRegistryChangesSinceSnapshot = 0U;
+        }
+    }
+
+    if (publishServiceRegistryChanges())
+    {
+        ++m_serviceRegistryChangesSinceSnapshot;
+    }
+    else
+    {
+        // the subscribers miss these changes and need the next snapshot
+        m_isServiceRegistrySnapshotRequired = true;
+    }
+    m_serviceRegistryChanges.changes.clear();
+}
+
+bool PortManager::publishServiceRegistrySnapshot() noexcept
+{
     PublisherPortUserType publisher(m_serviceRegistryPublisherPortData.value());
-    publisher
+    return publisher
         .tryAllocateChunk(sizeof(ServiceRegistry),
                           alignof(ServiceRegistry),
                           CHUNK_NO_USER_HEADER_SIZE,
@@ -1140,7 +1432,26 @@ void PortManager::publishServiceRegistry() noexcept
 
             publisher.sendChunk(chunk);
         })
-        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the service registry!"); });
+        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the service registry!"); })
+        .has_value();
+}
+
+bool PortManager::publishServiceRegistryChanges() noexcept
+{
+    PublisherPortUserType publisher(m_serviceRegistryChangesPublisherPortData.value());
+    return publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryChanges),
+                          alignof(ServiceRegistryChanges),
+                          CHUNK_NO_USER_HEADER_SIZE,
+                          CHUNK_NO_USER_HEADER_ALIGNMENT)
+        .and_then([&](auto& chunk) {
+            m_serviceRegistryChanges.sequenceNumber = m_serviceRegistry.sequenceNumber();
+            new (chunk->userPayload()) ServiceRegistryChanges(m_serviceRegistryChanges);
+
+            publisher.sendChunk(chunk);
+        })
+        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the service registry changes!"); })
+        .has_value();
 }
 
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
@@ -1150,39 +1461,69 @@ const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 
 void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    const auto previousSequenceNumber = m_serviceRegistry.sequenceNumber();
     m_serviceRegistry.addPublisher(service).or_else([&](auto&) {
         IOX_LOG(WARN, "Could not add publisher with service description '" << service << "' to service registry!");
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
+    recordServiceRegistryChange(previousSequenceNumber, ServiceRegistryChange::Type::ADD_PUBLISHER, service);
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    const auto previousSequenceNumber = m_serviceRegistry.sequenceNumber();
     m_serviceRegistry.removePublisher(service);
+    recordServiceRegistryChange(previousSequenceNumber, ServiceRegistryChange::Type::REMOVE_PUBLISHER, service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    const auto previousSequenceNumber = m_serviceRegistry.sequenceNumber();
     m_serviceRegistry.addServer(service).or_else([&](auto&) {
         IOX_LOG(WARN, "Could not add server with service description '" << service << "' to service registry!");
         errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
     });
+    recordServiceRegistryChange(previousSequenceNumber, ServiceRegistryChange::Type::ADD_SERVER, service);
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
+    const auto previousSequenceNumber = m_serviceRegistry.sequenceNumber();
     m_serviceRegistry.removeServer(service);
+    recordServiceRegistryChange(previousSequenceNumber, ServiceRegistryChange::Type::REMOVE_SERVER, service);
+}
+
+void PortManager::recordServiceRegistryChange(const uint64_t previousSequenceNumber,
+                                              const ServiceRegistryChange::Type type,
+                                              const capro::ServiceDescription& service) noexcept
+{
+    // only changes which modified the registry are recorded, this keeps the sequence numbers of the registry copies
+    // in the runtimes in sync with the one of RouDi
+    if (m_serviceRegistry.sequenceNumber() == previousSequenceNumber)
+    {
+        return;
+    }
+
+    if (!m_serviceRegistryChanges.changes.emplace_back(ServiceRegistryChange{type, service}))
+    {
+        // the subscribers cannot apply an incomplete list of changes and need a snapshot
+        m_serviceRegistryChanges.changes.clear();
+        IOX_DISCARD_RESULT(m_serviceRegistryChanges.changes.emplace_back(ServiceRegistryChange{type, service}));
+        m_isServiceRegistrySnapshotRequired = true;
+    }
 }
 
 expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
                                                                          const NodeName_t& nodeName) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPool->addNodeData(runtimeName, nodeName, 0);
 }
 
 expected<popo::ConditionVariableData*, PortPoolError>
 PortManager::acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     return m_portPool->addConditionVariableData(runtimeName);
 }
 
@@ -52,6 +52,9 @@ expected<popo::InterfacePortData*, PortPoolError> PortPool::addInterfacePort(con
         errorHandler(PoshError::PORT_POOL__INTERFACELIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::INTERFACE_PORT_LIST_FULL);
     }
+    interfacePortData->m_discoveryRequester.init(
+        m_portPoolData->m_discoveryRequests,
+        {popo::DiscoveryRequestSource::INTERFACE_PORT, interfacePortData.to_index()});
     return ok(interfacePortData.to_ptr());
 }
 
@@ -67,6 +70,8 @@ expected<runtime::NodeData*, PortPoolError> PortPool::addNodeData(const RuntimeN
         errorHandler(PoshError::PORT_POOL__NODELIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::NODE_DATA_LIST_FULL);
     }
+    nodeData->m_discoveryRequester.init(m_portPoolData->m_discoveryRequests,
+                                        {popo::DiscoveryRequestSource::NODE, nodeData.to_index()});
     return ok(nodeData.to_ptr());
 }
 
@@ -80,6 +85,9 @@ PortPool::addConditionVariableData(const RuntimeName_t& runtimeName) noexcept
         errorHandler(PoshError::PORT_POOL__CONDITION_VARIABLE_LIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::CONDITION_VARIABLE_LIST_FULL);
     }
+    conditionVariableData->m_discoveryRequester.init(
+        m_portPoolData->m_discoveryRequests,
+        {popo::DiscoveryRequestSource::CONDITION_VARIABLE, conditionVariableData.to_index()});
     return ok(conditionVariableData.to_ptr());
 }
 
@@ -98,6 +106,11 @@ void PortPool::removeConditionVariableData(const popo::ConditionVariableData* co
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+popo::DiscoveryRequestQueueData& PortPool::getDiscoveryRequestQueue() noexcept
+{
+    return m_portPoolData->m_discoveryRequests;
+}
+
 PortPoolData::PublisherContainer& PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers;
@@ -125,6 +138,10 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
         errorHandler(PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::PUBLISHER_PORT_LIST_FULL);
     }
+    publisherPortData->m_discoveryRequester.init(
+        m_portPoolData->m_discoveryRequests,
+        {popo::DiscoveryRequestSource::PUBLISHER_PORT, publisherPortData.to_index()});
+    addToPortIndex(m_publisherPortIndex, getPublisherPortDataList(), publisherPortData.to_index());
     return ok(publisherPortData.to_ptr());
 }
 
@@ -174,6 +191,9 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         errorHandler(PoshError::PORT_POOL__CLIENTLIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
+    clientPortData->m_discoveryRequester.init(m_portPoolData->m_discoveryRequests,
+                                              {popo::DiscoveryRequestSource::CLIENT_PORT, clientPortData.to_index()});
+    addToPortIndex(m_clientPortIndex, getClientPortDataList(), clientPortData.to_index());
     return ok(clientPortData.to_ptr());
 }
 
@@ -194,27 +214,59 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         errorHandler(PoshError::PORT_POOL__SERVERLIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
+    serverPortData->m_discoveryRequester.init(m_portPoolData->m_discoveryRequests,
+                                              {popo::DiscoveryRequestSource::SERVER_PORT, serverPortData.to_index()});
+    addToPortIndex(m_serverPortIndex, getServerPortDataList(), serverPortData.to_index());
     return ok(serverPortData.to_ptr());
 }
 
 void PortPool::removePublisherPort(const PublisherPortRouDiType::MemberType_t* const portData) noexcept
 {
+    removeFromPortIndex(m_publisherPortIndex, getPublisherPortDataList(), portData);
     m_portPoolData->m_publisherPortMembers.erase(portData);
 }
 
 void PortPool::removeSubscriberPort(const SubscriberPortType::MemberType_t* const portData) noexcept
 {
+    removeFromPortIndex(m_subscriberPortIndex, getSubscriberPortDataList(), portData);
     m_portPoolData->m_subscriberPortMembers.erase(portData);
 }
 
 void PortPool::removeClientPort(const popo::ClientPortData* const portData) noexcept
 {
+    removeFromPortIndex(m_clientPortIndex, getClientPortDataList(), portData);
     m_portPoolData->m_clientPortMembers.erase(portData);
 }
 void PortPool::removeServerPort(const popo::ServerPortData* const portData) noexcept
 {
+    removeFromPortIndex(m_serverPortIndex, getServerPortDataList(), portData);
     m_portPoolData->m_serverPortMembers.erase(portData);
 }
 
+void PortPool::forEachPublisherPort(
+    const capro::ServiceDescription& serviceDescription,
+    const function_ref<void(PublisherPortRouDiType::MemberType_t&)> callable) noexcept
+{
+    forEachPortInIndex(m_publisherPortIndex, getPublisherPortDataList(), serviceDescription, callable);
+}
+
+void PortPool::forEachSubscriberPort(const capro::ServiceDescription& serviceDescription,
+                                     const function_ref<void(SubscriberPortType::MemberType_t&)> callable) noexcept
+{
+    forEachPortInIndex(m_subscriberPortIndex, getSubscriberPortDataList(), serviceDescription, callable);
+}
+
+void PortPool::forEachClientPort(const capro::ServiceDescription& serviceDescription,
+                                 const function_ref<void(popo::ClientPortData&)> callable) noexcept
+{
+    forEachPortInIndex(m_clientPortIndex, getClientPortDataList(), serviceDescription, callable);
+}
+
+void PortPool::forEachServerPort(const capro::ServiceDescription& serviceDescription,
+                                 const function_ref<void(popo::ServerPortData&)> callable) noexcept
+{
+    forEachPortInIndex(m_serverPortIndex, getServerPortDataList(), serviceDescription, callable);
+}
+
 } // namespace roudi
 } // namespace iox
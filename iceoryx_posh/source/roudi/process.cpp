@@ -31,7 +31,8 @@ Process::Process(const RuntimeName_t& name,
                  const HeartbeatPoolIndexType heartbeatPoolIndex,
                  const uint64_t sessionId) noexcept
     : m_pid(pid)
-    , m_ipcChannel(name)
+    // the response to a CREATE_PORTS request may use the whole message size of the IPC channel
+    , m_ipcChannel(name, APP_MAX_MESSAGES, runtime::IpcInterfaceUser::MAX_MESSAGE_SIZE)
     , m_heartbeatPoolIndex(heartbeatPoolIndex)
     , m_user(user)
     , m_sessionId(sessionId)
@@ -99,6 +99,7 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
 
 void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             m_portManager.unblockProcessShutdown(name);
@@ -112,11 +113,14 @@ void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t
 
 void ProcessManager::requestShutdownOfAllProcesses() noexcept
 {
-    // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
-    for (auto& process : m_processList)
     {
-        IOX_LOG(DEBUG, "Sending SIGTERM to Process ID " << process.getPid() << " named '" << process.getName());
-        requestShutdownOfProcess(process, ShutdownPolicy::SIG_TERM);
+        std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
+        // send SIG_TERM to all running applications and wait for processes to answer with TERMINATION
+        for (auto& process : m_processList)
+        {
+            IOX_LOG(DEBUG, "Sending SIGTERM to Process ID " << process.getPid() << " named '" << process.getName());
+            requestShutdownOfProcess(process, ShutdownPolicy::SIG_TERM);
+        }
     }
 
     // this unblocks the RouDi shutdown if a publisher port is blocked by a full subscriber queue
@@ -125,11 +129,13 @@ void ProcessManager::requestShutdownOfAllProcesses() noexcept
 
 uint64_t ProcessManager::registeredProcessCount() const noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     return m_processList.size();
 }
 
 bool ProcessManager::probeRegisteredProcessesAliveWithSigTerm() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         if (probeProcessAliveWithSigTerm(process))
@@ -142,6 +148,7 @@ bool ProcessManager::probeRegisteredProcessesAliveWithSigTerm() noexcept
 
 void ProcessManager::killAllProcesses() noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(WARN,
@@ -153,6 +160,7 @@ void ProcessManager::killAllProcesses() noexcept
 
 void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     for (auto& process : m_processList)
     {
         IOX_LOG(WARN,
@@ -160,6 +168,10 @@ void ProcessManager::printWarningForRegisteredProcessesAndClearProcessList() noe
                               << "' is still running after SIGKILL was sent. RouDi is ignoring this process.");
     }
     m_processList.clear();
+    for (auto& monitoredProcess : m_monitoredProcesses)
+    {
+        monitoredProcess.process.reset();
+    }
 }
 
 bool ProcessManager::requestShutdownOfProcess(Process& process, ShutdownPolicy shutdownPolicy) noexcept
@@ -226,6 +238,7 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
 {
     bool returnValue{false};
 
+    std::unique_lock<std::shared_timed_mutex> exclusiveLock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // process is already in list (i.e. registered)
@@ -251,23 +264,66 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
             else
             {
                 // try registration again, should succeed since removal was successful
-                returnValue =
-                    this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+                returnValue = this->addProcess(name, pid, user, isMonitored, sessionId, versionInfo);
             }
         })
         .or_else([&]() {
             // process does not exist in list and can be added
-            returnValue = this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+            returnValue = this->addProcess(name, pid, user, isMonitored, sessionId, versionInfo);
         });
+    exclusiveLock.unlock();
+
+    if (!returnValue)
+    {
+        return false;
+    }
+
+    // the acknowledgement only requires shared access, this lets the requests of other processes proceed while the
+    // new process is informed about the shared memory
+    std::shared_lock<std::shared_timed_mutex> sharedLock(m_processListMutex);
+    bool isAcknowledged{false};
+    findProcess(name).and_then([&](auto& process) {
+        // the process could have been removed and registered again in the meantime
+        if (process->getSessionId() == sessionId)
+        {
+            sendRegistrationAck(*process, transmissionTimestamp);
+            isAcknowledged = true;
+        }
+    });
+    return isAcknowledged;
+}
+
+void ProcessManager::sendRegistrationAck(Process& process, const int64_t transmissionTimestamp) noexcept
+{
+    /// @todo iox-#2055 this workaround is required sind the conversion of edge cases is broken
+    constexpr uint8_t IOX_2055_WORKAROUND{1};
+    iox::UntypedRelativePointer::offset_t heartbeatOffset{iox::UntypedRelativePointer::NULL_POINTER_OFFSET
+                                                          - IOX_2055_WORKAROUND};
+    auto heartbeat = m_heartbeatPool->iter_from_index(process.getHeartbeatPoolIndex());
+    if (heartbeat != m_heartbeatPool->end())
+    {
+        heartbeatOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, heartbeat.to_ptr());
+    }
+
+    // send REG_ACK and BaseAddrString
+    runtime::IpcMessage sendBuffer;
+
+    auto segmentManagerOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, m_segmentManager);
+    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
+               << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << segmentManagerOffset << transmissionTimestamp
+               << m_mgmtSegmentId << heartbeatOffset;
+
+    process.sendViaIpcChannel(sendBuffer);
 
-    return returnValue;
+    m_processIntrospection->addProcess(static_cast<int>(process.getPid()), process.getName());
+
+    IOX_LOG(DEBUG, "Registered new application " << process.getName());
 }
 
 bool ProcessManager::addProcess(const RuntimeName_t& name,
                                 const uint32_t pid,
                                 const posix::PosixUser& user,
                                 const bool isMonitored,
-                                const int64_t transmissionTimestamp,
                                 const uint64_t sessionId,
                                 const version::VersionInfo& versionInfo) noexcept
 {
@@ -289,36 +345,25 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         return false;
     }
     auto heartbeatPoolIndex = HeartbeatPool::Index::INVALID;
-    /// @todo iox-#2055 this workaround is required sind the conversion of edge cases is broken
-    constexpr uint8_t IOX_2055_WORKAROUND{1};
-    iox::UntypedRelativePointer::offset_t heartbeatOffset{iox::UntypedRelativePointer::NULL_POINTER_OFFSET
-                                                          - IOX_2055_WORKAROUND};
     if (isMonitored)
     {
-        auto heartbeat = m_heartbeatPool->emplace();
-        heartbeatPoolIndex = heartbeat.to_index();
-        heartbeatOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, heartbeat.to_ptr());
+        heartbeatPoolIndex = m_heartbeatPool->emplace().to_index();
+    }
+    auto processIter = m_processList.emplace(m_processList.cend(), name, pid, user, heartbeatPoolIndex, sessionId);
+    if (heartbeatPoolIndex != HeartbeatPool::Index::INVALID)
+    {
+        auto& monitoredProcess = m_monitoredProcesses[heartbeatPoolIndex];
+        monitoredProcess.process.emplace(processIter);
+        monitoredProcess.lastBeatCount = m_heartbeatPool->iter_from_index(heartbeatPoolIndex)->beat_count();
+        monitoredProcess.lastBeatCountChange = std::chrono::steady_clock::now();
     }
-    m_processList.emplace_back(name, pid, user, heartbeatPoolIndex, sessionId);
-
-    // send REG_ACK and BaseAddrString
-    runtime::IpcMessage sendBuffer;
-
-    auto segmentManagerOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, m_segmentManager);
-    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
-               << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << segmentManagerOffset << transmissionTimestamp
-               << m_mgmtSegmentId << heartbeatOffset;
-
-    m_processList.back().sendViaIpcChannel(sendBuffer);
-
-    m_processIntrospection->addProcess(static_cast<int>(pid), name);
 
-    IOX_LOG(DEBUG, "Registered new application " << name);
     return true;
 }
 
 bool ProcessManager::unregisterProcess(const RuntimeName_t& name) noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     constexpr TerminationFeedback FEEDBACK{TerminationFeedback::SEND_ACK_TO_PROCESS};
     if (!searchForProcessAndRemoveIt(name, FEEDBACK))
     {
@@ -367,6 +412,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
         auto heartbeatIter = m_heartbeatPool->iter_from_index(processIter->getHeartbeatPoolIndex());
         if (heartbeatIter != m_heartbeatPool->end())
         {
+            m_monitoredProcesses[heartbeatIter.to_index()].process.reset();
             m_heartbeatPool->erase(heartbeatIter);
         }
         processIter = m_processList.erase(processIter); // delete application
@@ -379,6 +425,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
                                             capro::Interfaces interface,
                                             const NodeName_t& node) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
             // create a ReceiverPort
@@ -399,6 +446,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
 
 void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const NodeName_t& nodeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) {
             m_portManager.acquireNodeData(runtimeName, nodeName)
@@ -432,6 +480,7 @@ void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const N
 
 void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name).and_then([&](auto& process) {
         runtime::IpcMessage sendBuffer;
         sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::MESSAGE_NOT_SUPPORTED);
@@ -446,36 +495,17 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
                                              const popo::SubscriberOptions& subscriberOptions,
                                              const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
         .and_then([&](auto& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (maybeSubscriber.has_value())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(DEBUG,
-                        "Created new SubscriberPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR,
-                        "Could not create SubscriberPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-            }
+            runtime::IpcMessage sendBuffer;
+            m_portManager.acquirePortDataBatch([&](PortManager::PortDataBatch& portDataBatch) {
+                addPortResponse(
+                    sendBuffer,
+                    runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                    createSubscriberPort(portDataBatch, *process, service, subscriberOptions, portConfigInfo));
+            });
+            process->sendViaIpcChannel(sendBuffer);
         })
         .or_else([&]() {
             IOX_LOG(WARN,
@@ -489,70 +519,17 @@ void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
-        .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
-
-            if (maybePublisher.has_value())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(DEBUG,
-                        "Created new PublisherPort for application '" << name << "' with service description '"
-                                                                      << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-
-                std::string error;
-                switch (maybePublisher.error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
-                    break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
-                    break;
-                }
-                }
-                sendBuffer << error;
-
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR,
-                        "Could not create PublisherPort for application '" << name << "' with service description '"
-                                                                           << service << "'");
-            }
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            m_portManager.acquirePortDataBatch([&](PortManager::PortDataBatch& portDataBatch) {
+                addPortResponse(
+                    sendBuffer,
+                    runtime::IpcMessageType::CREATE_PUBLISHER_ACK,
+                    createPublisherPort(portDataBatch, *process, service, publisherOptions, portConfigInfo));
+            });
+            process->sendViaIpcChannel(sendBuffer);
         })
         .or_else([&]() {
             IOX_LOG(WARN,
@@ -566,47 +543,16 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                                          const popo::ClientOptions& clientOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
-        .and_then([&](auto& process) { // create a ClientPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            m_portManager
-                .acquireClientPortData(
-                    service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& clientPort) {
-                    auto relativePtrToClientPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_CLIENT_ACK)
-                               << convert::toString(relativePtrToClientPort) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(DEBUG,
-                            "Created new ClientPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(ERROR,
-                            "Could not create ClientPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-                });
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            m_portManager.acquirePortDataBatch([&](PortManager::PortDataBatch& portDataBatch) {
+                addPortResponse(sendBuffer,
+                                runtime::IpcMessageType::CREATE_CLIENT_ACK,
+                                createClientPort(portDataBatch, *process, service, clientOptions, portConfigInfo));
+            });
+            process->sendViaIpcChannel(sendBuffer);
         })
         .or_else([&]() {
             IOX_LOG(WARN,
@@ -620,47 +566,16 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                                          const popo::ServerOptions& serverOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(name)
-        .and_then([&](auto& process) { // create a ServerPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
-
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
-
-            m_portManager
-                .acquireServerPortData(
-                    service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
-                .and_then([&](auto& serverPort) {
-                    auto relativePtrToServerPort =
-                        UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
-
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SERVER_ACK)
-                               << convert::toString(relativePtrToServerPort) << convert::toString(m_mgmtSegmentId);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(DEBUG,
-                            "Created new ServerPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-                })
-                .or_else([&](auto&) {
-                    runtime::IpcMessage sendBuffer;
-                    sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                    sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
-                    process->sendViaIpcChannel(sendBuffer);
-
-                    IOX_LOG(ERROR,
-                            "Could not create ServerPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-                });
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            m_portManager.acquirePortDataBatch([&](PortManager::PortDataBatch& portDataBatch) {
+                addPortResponse(sendBuffer,
+                                runtime::IpcMessageType::CREATE_SERVER_ACK,
+                                createServerPort(portDataBatch, *process, service, serverOptions, portConfigInfo));
+            });
+            process->sendViaIpcChannel(sendBuffer);
         })
         .or_else([&]() {
             IOX_LOG(WARN,
@@ -669,8 +584,207 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
         });
 }
 
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name, const PortRequests_t& requests) noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
+    findProcess(name)
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_ACK);
+
+            // the PortManager is locked only once for all ports of the request
+            m_portManager.acquirePortDataBatch([&](PortManager::PortDataBatch& portDataBatch) {
+                for (uint64_t i = 0U; i < requests.size(); ++i)
+                {
+                    const auto& request = requests[i];
+                    if (const auto* publisherOptions = request.options.get<popo::PublisherOptions>())
+                    {
+                        addPortResponse(sendBuffer,
+                                        runtime::IpcMessageType::CREATE_PUBLISHER_ACK,
+                                        createPublisherPort(portDataBatch,
+                                                            *process,
+                                                            request.service,
+                                                            *publisherOptions,
+                                                            request.portConfigInfo));
+                    }
+                    else if (const auto* subscriberOptions = request.options.get<popo::SubscriberOptions>())
+                    {
+                        addPortResponse(sendBuffer,
+                                        runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK,
+                                        createSubscriberPort(portDataBatch,
+                                                             *process,
+                                                             request.service,
+                                                             *subscriberOptions,
+                                                             request.portConfigInfo));
+                    }
+                    else if (const auto* clientOptions = request.options.get<popo::ClientOptions>())
+                    {
+                        addPortResponse(
+                            sendBuffer,
+                            runtime::IpcMessageType::CREATE_CLIENT_ACK,
+                            createClientPort(
+                                portDataBatch, *process, request.service, *clientOptions, request.portConfigInfo));
+                    }
+                    else if (const auto* serverOptions = request.options.get<popo::ServerOptions>())
+                    {
+                        addPortResponse(
+                            sendBuffer,
+                            runtime::IpcMessageType::CREATE_SERVER_ACK,
+                            createServerPort(
+                                portDataBatch, *process, request.service, *serverOptions, request.portConfigInfo));
+                    }
+                }
+            });
+
+            process->sendViaIpcChannel(sendBuffer);
+        })
+        .or_else([&]() {
+            IOX_LOG(WARN, "Unknown application '" << name << "' requested " << requests.size() << " ports");
+        });
+}
+
+ProcessManager::PortResult_t ProcessManager::createSubscriberPort(PortManager::PortDataBatch& portDataBatch,
+                                                                  Process& process,
+                                                                  const capro::ServiceDescription& service,
+                                                                  const popo::SubscriberOptions& subscriberOptions,
+                                                                  const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto& name = process.getName();
+    auto maybeSubscriber = portDataBatch.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+
+    if (maybeSubscriber.has_error())
+    {
+        IOX_LOG(ERROR,
+                "Could not create SubscriberPort for application '" << name << "' with service description '"
+                                                                    << service << "'");
+        return err(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+    }
+
+    IOX_LOG(DEBUG,
+            "Created new SubscriberPort for application '" << name << "' with service description '" << service
+                                                           << "'");
+    // the SubscriberPort is sent to the app as a serialized relative pointer
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value()));
+}
+
+ProcessManager::PortResult_t ProcessManager::createPublisherPort(PortManager::PortDataBatch& portDataBatch,
+                                                                 Process& process,
+                                                                 const capro::ServiceDescription& service,
+                                                                 const popo::PublisherOptions& publisherOptions,
+                                                                 const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto& name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return err(runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybePublisher = portDataBatch.acquirePublisherPortData(
+        service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybePublisher.has_error())
+    {
+        IOX_LOG(ERROR,
+                "Could not create PublisherPort for application '" << name << "' with service description '"
+                                                                   << service << "'");
+        switch (maybePublisher.error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+            return err(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+            return err(runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+        default:
+            return err(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+        }
+    }
+
+    IOX_LOG(DEBUG,
+            "Created new PublisherPort for application '" << name << "' with service description '" << service
+                                                          << "'");
+    // the PublisherPort is sent to the app as a serialized relative pointer
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value()));
+}
+
+ProcessManager::PortResult_t ProcessManager::createClientPort(PortManager::PortDataBatch& portDataBatch,
+                                                              Process& process,
+                                                              const capro::ServiceDescription& service,
+                                                              const popo::ClientOptions& clientOptions,
+                                                              const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto& name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return err(runtime::IpcMessageErrorType::REQUEST_CLIENT_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybeClient = portDataBatch.acquireClientPortData(
+        service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybeClient.has_error())
+    {
+        IOX_LOG(ERROR,
+                "Could not create ClientPort for application '" << name << "' with service description '" << service
+                                                                << "'");
+        return err(runtime::IpcMessageErrorType::CLIENT_LIST_FULL);
+    }
+
+    IOX_LOG(DEBUG,
+            "Created new ClientPort for application '" << name << "' with service description '" << service << "'");
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeClient.value()));
+}
+
+ProcessManager::PortResult_t ProcessManager::createServerPort(PortManager::PortDataBatch& portDataBatch,
+                                                              Process& process,
+                                                              const capro::ServiceDescription& service,
+                                                              const popo::ServerOptions& serverOptions,
+                                                              const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto& name = process.getName();
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        return err(runtime::IpcMessageErrorType::REQUEST_SERVER_NO_WRITABLE_SHM_SEGMENT);
+    }
+
+    auto maybeServer = portDataBatch.acquireServerPortData(
+        service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+
+    if (maybeServer.has_error())
+    {
+        IOX_LOG(ERROR,
+                "Could not create ServerPort for application '" << name << "' with service description '" << service
+                                                                << "'");
+        return err(runtime::IpcMessageErrorType::SERVER_LIST_FULL);
+    }
+
+    IOX_LOG(DEBUG,
+            "Created new ServerPort for application '" << name << "' with service description '" << service << "'");
+    return ok(UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeServer.value()));
+}
+
+void ProcessManager::addPortResponse(runtime::IpcMessage& sendBuffer,
+                                     const runtime::IpcMessageType ackType,
+                                     const PortResult_t& result) const noexcept
+{
+    if (result.has_error())
+    {
+        sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR)
+                   << runtime::IpcMessageErrorTypeToString(result.error());
+        return;
+    }
+
+    sendBuffer << runtime::IpcMessageTypeToString(ackType) << convert::toString(result.value())
+               << convert::toString(m_mgmtSegmentId);
+}
+
 void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept
 {
+    std::shared_lock<std::shared_timed_mutex> lock(m_processListMutex);
     findProcess(runtimeName)
         .and_then([&](auto& process) { // Try to create a condition variable
             m_portManager.acquireConditionVariableData(runtimeName)
@@ -708,7 +822,6 @@ void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospe
 
 void ProcessManager::run() noexcept
 {
-    monitorProcesses();
     discoveryUpdate();
 }
 
@@ -736,41 +849,47 @@ optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexce
 
 void ProcessManager::monitorProcesses() noexcept
 {
+    std::lock_guard<std::shared_timed_mutex> lock(m_processListMutex);
     static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                   "keep alive timeout too small");
-    auto timeout = runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
+    const auto timeout = std::chrono::milliseconds(runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds());
+    const auto now = std::chrono::steady_clock::now();
     auto heartbeatIterator = m_heartbeatPool->begin();
     while (heartbeatIterator != m_heartbeatPool->end())
     {
         auto currentHeartbeatIterator = heartbeatIterator++;
-        auto elapsedMilliseconds = currentHeartbeatIterator->elapsed_milliseconds_since_last_beat();
-        if (elapsedMilliseconds > timeout)
+        auto& monitoredProcess = m_monitoredProcesses[currentHeartbeatIterator.to_index()];
+        const auto beatCount = currentHeartbeatIterator->beat_count();
+        if (beatCount != monitoredProcess.lastBeatCount)
         {
-            bool removed{false};
-            auto processIterator = m_processList.begin();
-            while (processIterator != m_processList.end())
-            {
-                if (processIterator->getHeartbeatPoolIndex() != currentHeartbeatIterator.to_index())
-                {
-                    ++processIterator;
-                    continue;
-                }
+            monitoredProcess.lastBeatCount = beatCount;
+            monitoredProcess.lastBeatCountChange = now;
+            continue;
+        }
 
-                IOX_LOG(WARN,
-                        "Application " << processIterator->getName() << " not responding (last response "
-                                       << elapsedMilliseconds << " milliseconds ago) --> removing it");
+        const auto elapsedTime = now - monitoredProcess.lastBeatCountChange;
+        if (elapsedTime <= timeout)
+        {
+            continue;
+        }
 
-                removed = removeProcessAndDeleteRespectiveSharedMemoryObjects(
-                    processIterator, TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS);
-                break;
-            }
-            if (!removed)
-            {
-                IOX_LOG(WARN,
-                        "Could not find application for corresponding heartbeat! HeartbeatPoolIndex: "
-                            << currentHeartbeatIterator.to_index());
-                m_heartbeatPool->erase(currentHeartbeatIterator);
-            }
+        if (monitoredProcess.process.has_value())
+        {
+            // the iterator is copied since the removal resets the monitoring state
+            auto processIterator = monitoredProcess.process.value();
+            IOX_LOG(WARN,
+                    "Application " << processIterator->getName() << " not responding (last response "
+                                   << std::chrono::duration_cast<std::chrono::milliseconds>(elapsedTime).count()
+                                   << " milliseconds ago) --> removing it");
+            removeProcessAndDeleteRespectiveSharedMemoryObjects(processIterator,
+                                                                TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS);
+        }
+        else
+        {
+            IOX_LOG(WARN,
+                    "Could not find application for corresponding heartbeat! HeartbeatPoolIndex: "
+                        << currentHeartbeatIterator.to_index());
+            m_heartbeatPool->erase(currentHeartbeatIterator);
         }
     }
 }
@@ -780,5 +899,10 @@ void ProcessManager::discoveryUpdate() noexcept
     m_portManager.doDiscovery();
 }
 
+void ProcessManager::handleDiscoveryRequests() noexcept
+{
+    m_portManager.handleDiscoveryRequests();
+}
+
 } // namespace roudi
 } // namespace iox
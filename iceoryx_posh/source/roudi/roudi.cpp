@@ -22,33 +22,70 @@
 #include "iceoryx_hoofs/posix_wrapper/thread.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
-#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iceoryx_posh/runtime/port_request.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/logging.hpp"
 #include "iox/std_string_support.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace roudi
 {
+namespace
+{
+template <typename Options>
+bool addPortRequest(ProcessManager::PortRequests_t& requests,
+                    const capro::ServiceDescription& service,
+                    const std::string& options,
+                    const std::string& portConfigInfo) noexcept
+{
+    auto optionsDeserializationResult = Options::deserialize(Serialization(options));
+    if (optionsDeserializationResult.has_error())
+    {
+        IOX_LOG(ERROR, "Deserialization of the port options failed when '" << options.c_str() << "' was provided\n");
+        return false;
+    }
+
+    return requests.emplace_back(
+        service, optionsDeserializationResult.value(), runtime::PortConfigInfo(Serialization(portConfigInfo)));
+}
+
+/// @brief FNV-1a hash of the runtime name to assign the runtime to a runtime message worker
+uint64_t runtimeNameHash(const RuntimeName_t& runtimeName) noexcept
+{
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+    uint64_t hash{FNV_OFFSET_BASIS};
+    for (uint64_t i = 0U; i < runtimeName.size(); ++i)
+    {
+        hash ^= static_cast<uint8_t>(runtimeName.c_str()[i]);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+} // namespace
+
 RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
              PortManager& portManager,
              RoudiStartupParameters roudiStartupParameters) noexcept
     : m_killProcessesInDestructor(roudiStartupParameters.m_killProcessesInDestructor)
-    , m_runMonitoringAndDiscoveryThread(true)
+    , m_runDiscoveryThread(true)
+    , m_runMonitoringThread(true)
     , m_runHandleRuntimeMessageThread(true)
     , m_roudiMemoryInterface(&roudiMemoryInterface)
     , m_portManager(&portManager)
-    , m_prcMgr(concurrent::ForwardArgsToCTor,
-               *m_roudiMemoryInterface,
-               portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+    , m_prcMgr(*m_roudiMemoryInterface, portManager, roudiStartupParameters.m_compatibilityCheckLevel)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
+          PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionMempoolService)))
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processTerminationDelay(roudiStartupParameters.m_processTerminationDelay)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
@@ -57,9 +94,19 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     {
         IOX_LOG(WARN, "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!");
     }
+    const auto requestedWorkers = roudiStartupParameters.m_runtimeMessageWorkers;
+    m_numberOfRuntimeMessageWorkers =
+        algorithm::minVal(algorithm::maxVal(requestedWorkers, 1U), MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS);
+    if (m_numberOfRuntimeMessageWorkers != requestedWorkers)
+    {
+        IOX_LOG(WARN,
+                "The number of runtime message workers must be in the range of [1, "
+                    << MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS << "]! Using " << m_numberOfRuntimeMessageWorkers
+                    << " workers.");
+    }
     m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
+        PublisherPortUserType(m_prcMgr.addIntrospectionPublisherPort(IntrospectionProcessService)));
+    m_prcMgr.initIntrospection(&m_processIntrospection);
     m_processIntrospection.run();
     m_mempoolIntrospection.run();
 
@@ -73,9 +120,23 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
         .create(m_discoveryFinishedSemaphore)
         .expect("Valid Semaphore");
 
+    // initialize semaphore to wake up the monitoring thread on shutdown
+    iox::posix::UnnamedSemaphoreBuilder()
+        .initialValue(0U)
+        .isInterProcessCapable(false)
+        .create(m_monitoringWakeUpSemaphore)
+        .expect("Valid Semaphore");
+
     // run the threads
-    m_monitoringAndDiscoveryThread = std::thread(&RouDi::monitorAndDiscoveryUpdate, this);
-    posix::setThreadName(m_monitoringAndDiscoveryThread.native_handle(), "Mon+Discover");
+    m_discoveryThread = std::thread(&RouDi::discoveryUpdate, this);
+    posix::setThreadName(m_discoveryThread.native_handle(), "Discover");
+
+    // without monitoring no process has a heartbeat
+    if (m_monitoringMode == roudi::MonitoringMode::ON)
+    {
+        m_monitoringThread = std::thread(&RouDi::monitorProcesses, this);
+        posix::setThreadName(m_monitoringThread.native_handle(), "Mon");
+    }
 
     if (roudiStartupParameters.m_runtimesMessagesThreadStart == RuntimeMessagesThreadStart::IMMEDIATE)
     {
@@ -90,6 +151,24 @@ RouDi::~RouDi() noexcept
 
 void RouDi::startProcessRuntimeMessagesThread() noexcept
 {
+    // with a single worker the messages are handled by the thread which receives them
+    if (m_numberOfRuntimeMessageWorkers > 1U)
+    {
+        for (uint32_t i = 0U; i < m_numberOfRuntimeMessageWorkers; ++i)
+        {
+            m_runtimeMessageWorkers.emplace_back();
+            auto& worker = m_runtimeMessageWorkers.back();
+            iox::posix::UnnamedSemaphoreBuilder()
+                .initialValue(0U)
+                .isInterProcessCapable(false)
+                .create(worker.wakeUpSemaphore)
+                .expect("Valid Semaphore");
+            worker.thread = std::thread(&RouDi::handleRuntimeMessages, this, std::ref(worker));
+            posix::setThreadName(worker.thread.native_handle(),
+                                 into<lossy<posix::ThreadName_t>>("IPC-msg-work-" + convert::toString(i)));
+        }
+    }
+
     m_handleRuntimeMessageThread = std::thread(&RouDi::processRuntimeMessages, this);
     posix::setThreadName(m_handleRuntimeMessageThread.native_handle(), "IPC-msg-process");
 }
@@ -98,8 +177,14 @@ void RouDi::shutdown() noexcept
 {
     // trigger the shutdown of the monitoring and discovery thread in order to prevent application to register while
     // shutting down
-    m_runMonitoringAndDiscoveryThread = false;
-    m_discoveryLoopTrigger.trigger();
+    m_runDiscoveryThread = false;
+    triggerDiscoveryLoop();
+    m_runMonitoringThread = false;
+    m_monitoringWakeUpSemaphore->post().or_else([](const auto& error) {
+        IOX_LOG(ERROR,
+                "Could not trigger semaphore to wake up the monitoring thread! Error: "
+                    << static_cast<uint32_t>(error));
+    });
 
     // stop the introspection
     m_processIntrospection.stop();
@@ -107,11 +192,17 @@ void RouDi::shutdown() noexcept
     m_portManager->stopPortIntrospection();
 
     // wait for the monitoring and discovery thread to stop
-    if (m_monitoringAndDiscoveryThread.joinable())
+    if (m_monitoringThread.joinable())
     {
-        IOX_LOG(DEBUG, "Joining 'Mon+Discover' thread...");
-        m_monitoringAndDiscoveryThread.join();
-        IOX_LOG(DEBUG, "...'Mon+Discover' thread joined.");
+        IOX_LOG(DEBUG, "Joining 'Mon' thread...");
+        m_monitoringThread.join();
+        IOX_LOG(DEBUG, "...'Mon' thread joined.");
+    }
+    if (m_discoveryThread.joinable())
+    {
+        IOX_LOG(DEBUG, "Joining 'Discover' thread...");
+        m_discoveryThread.join();
+        IOX_LOG(DEBUG, "...'Discover' thread joined.");
     }
 
     if (m_killProcessesInDestructor)
@@ -119,7 +210,7 @@ void RouDi::shutdown() noexcept
         deadline_timer terminationDelayTimer(m_processTerminationDelay);
         using namespace units::duration_literals;
         auto remainingDurationForInfoPrint = m_processTerminationDelay - 1_s;
-        while (!terminationDelayTimer.hasExpired() && m_prcMgr->registeredProcessCount() > 0)
+        while (!terminationDelayTimer.hasExpired() && m_prcMgr.registeredProcessCount() > 0)
         {
             if (remainingDurationForInfoPrint > terminationDelayTimer.remainingTime())
             {
@@ -131,11 +222,11 @@ void RouDi::shutdown() noexcept
             std::this_thread::sleep_for(std::chrono::milliseconds(PROCESS_TERMINATED_CHECK_INTERVAL.toMilliseconds()));
         }
 
-        m_prcMgr->requestShutdownOfAllProcesses();
+        m_prcMgr.requestShutdownOfAllProcesses();
 
         deadline_timer finalKillTimer(m_processKillDelay);
         auto remainingDurationForWarnPrint = m_processKillDelay - 2_s;
-        while (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm() && !finalKillTimer.hasExpired())
+        while (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm() && !finalKillTimer.hasExpired())
         {
             if (remainingDurationForWarnPrint > finalKillTimer.remainingTime())
             {
@@ -149,15 +240,15 @@ void RouDi::shutdown() noexcept
         }
 
         // Is any processes still alive?
-        if (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm() && finalKillTimer.hasExpired())
+        if (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm() && finalKillTimer.hasExpired())
         {
             // Time to kill them
-            m_prcMgr->killAllProcesses();
+            m_prcMgr.killAllProcesses();
         }
 
-        if (m_prcMgr->probeRegisteredProcessesAliveWithSigTerm())
+        if (m_prcMgr.probeRegisteredProcessesAliveWithSigTerm())
         {
-            m_prcMgr->printWarningForRegisteredProcessesAndClearProcessList();
+            m_prcMgr.printWarningForRegisteredProcessesAndClearProcessList();
         }
     }
 
@@ -170,6 +261,24 @@ void RouDi::shutdown() noexcept
         m_handleRuntimeMessageThread.join();
         IOX_LOG(DEBUG, "...'IPC-msg-process' thread joined.");
     }
+
+    if (!m_runtimeMessageWorkers.empty())
+    {
+        IOX_LOG(DEBUG, "Joining " << m_runtimeMessageWorkers.size() << " 'IPC-msg-work' threads...");
+    }
+    for (uint64_t i = 0U; i < m_runtimeMessageWorkers.size(); ++i)
+    {
+        auto& worker = m_runtimeMessageWorkers[i];
+        worker.wakeUpSemaphore->post().or_else([](const auto& error) {
+            IOX_LOG(ERROR,
+                    "Could not trigger semaphore to wake up a runtime message worker! Error: "
+                        << static_cast<uint32_t>(error));
+        });
+        if (worker.thread.joinable())
+        {
+            worker.thread.join();
+        }
+    }
 }
 
 void RouDi::cyclicUpdateHook() noexcept
@@ -192,7 +301,7 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
                             << static_cast<uint32_t>(error));
             });
     }
-    m_discoveryLoopTrigger.trigger();
+    triggerDiscoveryLoop();
     m_discoveryFinishedSemaphore->timedWait(timeout).or_else([](const auto& error) {
         IOX_LOG(ERROR,
                 "A timed wait on the semaphore which signals a finished run of the "
@@ -201,25 +310,28 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
     });
 }
 
-void RouDi::monitorAndDiscoveryUpdate() noexcept
+void RouDi::triggerDiscoveryLoop() noexcept
 {
-    class DiscoveryWaitSet : public popo::WaitSet<1>
-    {
-      public:
-        DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
-            : WaitSet(condVarData)
-        {
-        }
-    };
+    popo::ConditionNotifier(m_portManager->discoveryRequestQueue().m_conditionVariableData,
+                            popo::DiscoveryRequestQueueData::DISCOVERY_TRIGGER_NOTIFICATION_INDEX)
+        .notify();
+}
 
-    popo::ConditionVariableData conditionVariableData;
-    DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+void RouDi::discoveryUpdate() noexcept
+{
+    // the ports request a discovery run via the shared memory condition variable of the discovery request queue
+    // when their state changes, therefore the loop waits only for the cyclic update hook periodically
+    popo::ConditionListener discoveryListener{m_portManager->discoveryRequestQueue().m_conditionVariableData};
+    bool doFullDiscovery{true};
     bool manuallyTriggered{false};
 
-    while (m_runMonitoringAndDiscoveryThread)
+    while (m_runDiscoveryThread)
     {
-        m_prcMgr->run();
+        if (doFullDiscovery)
+        {
+            m_prcMgr.run();
+        }
+        m_prcMgr.handleDiscoveryRequests();
 
         cyclicUpdateHook();
 
@@ -233,14 +345,29 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
         }
 
         manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
+        for (const auto notificationIndex : discoveryListener.timedWait(DISCOVERY_INTERVAL))
         {
-            if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
+            if (notificationIndex == popo::DiscoveryRequestQueueData::DISCOVERY_TRIGGER_NOTIFICATION_INDEX)
             {
                 manuallyTriggered = true;
-                break;
             }
         }
+        doFullDiscovery = manuallyTriggered;
+    }
+}
+
+void RouDi::monitorProcesses() noexcept
+{
+    // the check runs on its own timer in order to be independent of the load of the discovery
+    while (m_runMonitoringThread)
+    {
+        m_prcMgr.monitorProcesses();
+
+        m_monitoringWakeUpSemaphore->timedWait(PROCESS_MONITORING_INTERVAL).or_else([](const auto& error) {
+            IOX_LOG(ERROR,
+                    "A timed wait on the semaphore which wakes up the monitoring thread failed! Error: "
+                        << static_cast<uint32_t>(error));
+        });
     }
 }
 
@@ -254,13 +381,60 @@ void RouDi::processRuntimeMessages() noexcept
     while (m_runHandleRuntimeMessageThread)
     {
         // read RouDi's IPC channel
-        runtime::IpcMessage message;
-        if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
+        RuntimeMessage runtimeMessage;
+        if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, runtimeMessage.message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+            const auto& message = runtimeMessage.message;
+            runtimeMessage.cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
+            runtimeMessage.runtimeName = into<lossy<RuntimeName_t>>(message.getElementAtIndex(1));
 
-            processMessage(message, cmd, runtimeName);
+            if (m_runtimeMessageWorkers.empty())
+            {
+                processMessage(message, runtimeMessage.cmd, runtimeMessage.runtimeName);
+            }
+            else
+            {
+                dispatchRuntimeMessage(std::move(runtimeMessage));
+            }
+        }
+    }
+}
+
+void RouDi::dispatchRuntimeMessage(RuntimeMessage&& runtimeMessage) noexcept
+{
+    // the messages of a runtime are always handled by the same worker in order to preserve their order
+    auto& worker =
+        m_runtimeMessageWorkers[runtimeNameHash(runtimeMessage.runtimeName) % m_runtimeMessageWorkers.size()];
+    while (!worker.queue.tryPush(std::move(runtimeMessage)))
+    {
+        if (!m_runHandleRuntimeMessageThread)
+        {
+            return;
+        }
+        // the worker is busy with the messages of other runtimes
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    worker.wakeUpSemaphore->post().or_else([](const auto& error) {
+        IOX_LOG(ERROR,
+                "Could not trigger semaphore to wake up a runtime message worker! Error: "
+                    << static_cast<uint32_t>(error));
+    });
+}
+
+void RouDi::handleRuntimeMessages(RuntimeMessageWorker& worker) noexcept
+{
+    while (m_runHandleRuntimeMessageThread)
+    {
+        worker.wakeUpSemaphore->timedWait(m_runtimeMessagesThreadTimeout).or_else([](const auto& error) {
+            IOX_LOG(ERROR,
+                    "A timed wait on the semaphore which wakes up a runtime message worker failed! Error: "
+                        << static_cast<uint32_t>(error));
+        });
+
+        for (auto runtimeMessage = worker.queue.pop(); runtimeMessage.has_value(); runtimeMessage = worker.queue.pop())
+        {
+            processMessage(runtimeMessage->message, runtimeMessage->cmd, runtimeMessage->runtimeName);
         }
     }
 }
@@ -277,6 +451,67 @@ version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& mess
     return serializationVersionInfo;
 }
 
+bool RouDi::parseCreatePortsMessage(const runtime::IpcMessage& message,
+                                    ProcessManager::PortRequests_t& requests) noexcept
+{
+    uint64_t position{0U};
+    // the message type and the runtime name are already known
+    IOX_DISCARD_RESULT(message.getNextElement(position));
+    IOX_DISCARD_RESULT(message.getNextElement(position));
+
+    while (true)
+    {
+        const auto type = message.getNextElement(position);
+        if (!type.has_value())
+        {
+            return true;
+        }
+        const auto service = message.getNextElement(position);
+        const auto options = message.getNextElement(position);
+        const auto portConfigInfo = message.getNextElement(position);
+        if (!portConfigInfo.has_value())
+        {
+            return false;
+        }
+
+        auto deserializationResult = capro::ServiceDescription::deserialize(Serialization(service.value()));
+        if (deserializationResult.has_error())
+        {
+            IOX_LOG(ERROR, "Deserialization failed when '" << service.value().c_str() << "' was provided\n");
+            return false;
+        }
+
+        bool isAdded{false};
+        switch (runtime::stringToIpcMessageType(type.value().c_str()))
+        {
+        case runtime::IpcMessageType::CREATE_PUBLISHER:
+            isAdded = addPortRequest<popo::PublisherOptions>(
+                requests, deserializationResult.value(), options.value(), portConfigInfo.value());
+            break;
+        case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+            isAdded = addPortRequest<popo::SubscriberOptions>(
+                requests, deserializationResult.value(), options.value(), portConfigInfo.value());
+            break;
+        case runtime::IpcMessageType::CREATE_CLIENT:
+            isAdded = addPortRequest<popo::ClientOptions>(
+                requests, deserializationResult.value(), options.value(), portConfigInfo.value());
+            break;
+        case runtime::IpcMessageType::CREATE_SERVER:
+            isAdded = addPortRequest<popo::ServerOptions>(
+                requests, deserializationResult.value(), options.value(), portConfigInfo.value());
+            break;
+        default:
+            IOX_LOG(ERROR, "Unknown port type '" << type.value().c_str() << "' in \"IpcMessageType::CREATE_PORTS\"");
+            break;
+        }
+
+        if (!isAdded)
+        {
+            return false;
+        }
+    }
+}
+
 void RouDi::processMessage(const runtime::IpcMessage& message,
                            const iox::runtime::IpcMessageType& cmd,
                            const RuntimeName_t& runtimeName) noexcept
@@ -339,7 +574,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addPublisherForProcess(
+            m_prcMgr.addPublisherForProcess(
                 runtimeName, service, publisherOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -378,7 +613,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             Serialization portConfigInfoSerialization(message.getElementAtIndex(4));
 
-            m_prcMgr->addSubscriberForProcess(
+            m_prcMgr.addSubscriberForProcess(
                 runtimeName, service, subscriberOptions, iox::runtime::PortConfigInfo(portConfigInfoSerialization));
         }
         break;
@@ -417,7 +652,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
+            m_prcMgr.addClientForProcess(runtimeName, service, clientOptions, portConfigInfo);
         }
         break;
     }
@@ -455,7 +690,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
 
             runtime::PortConfigInfo portConfigInfo{Serialization(message.getElementAtIndex(4))};
 
-            m_prcMgr->addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
+            m_prcMgr.addServerForProcess(runtimeName, service, serverOptions, portConfigInfo);
         }
         break;
     }
@@ -469,7 +704,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            m_prcMgr->addConditionVariableForProcess(runtimeName);
+            m_prcMgr.addConditionVariableForProcess(runtimeName);
         }
         break;
     }
@@ -486,7 +721,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             capro::Interfaces interface =
                 StringToCaProInterface(into<lossy<capro::IdString_t>>(message.getElementAtIndex(2)));
 
-            m_prcMgr->addInterfaceForProcess(
+            m_prcMgr.addInterfaceForProcess(
                 runtimeName, interface, into<lossy<NodeName_t>>(message.getElementAtIndex(3)));
         }
         break;
@@ -502,7 +737,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             runtime::NodeProperty nodeProperty(Serialization(message.getElementAtIndex(2)));
-            m_prcMgr->addNodeForProcess(runtimeName, nodeProperty.m_name);
+            m_prcMgr.addNodeForProcess(runtimeName, nodeProperty.m_name);
         }
         break;
     }
@@ -517,7 +752,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         else
         {
             // this is used to unblock a potentially block application by blocking publisher
-            m_prcMgr->handleProcessShutdownPreparationRequest(runtimeName);
+            m_prcMgr.handleProcessShutdownPreparationRequest(runtimeName);
         }
         break;
     }
@@ -531,7 +766,32 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         else
         {
-            IOX_DISCARD_RESULT(m_prcMgr->unregisterProcess(runtimeName));
+            IOX_DISCARD_RESULT(m_prcMgr.unregisterProcess(runtimeName));
+        }
+        break;
+    }
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        constexpr uint32_t NUMBER_OF_HEADER_ELEMENTS{2U};
+        constexpr uint32_t NUMBER_OF_ELEMENTS_PER_PORT{4U};
+        const auto numberOfElements = message.getNumberOfElements();
+        if (numberOfElements <= NUMBER_OF_HEADER_ELEMENTS
+            || (numberOfElements - NUMBER_OF_HEADER_ELEMENTS) % NUMBER_OF_ELEMENTS_PER_PORT != 0U
+            || (numberOfElements - NUMBER_OF_HEADER_ELEMENTS) / NUMBER_OF_ELEMENTS_PER_PORT
+                   > MAX_NUMBER_OF_PORTS_PER_REQUEST)
+        {
+            IOX_LOG(ERROR,
+                    "Wrong number of parameters for \"IpcMessageType::CREATE_PORTS\" from \"" << runtimeName
+                                                                                               << "\"received!");
+        }
+        else
+        {
+            ProcessManager::PortRequests_t requests;
+            if (parseCreatePortsMessage(message, requests))
+            {
+                // all ports of the request are created with a single lock of the PortManager
+                m_prcMgr.addPortsForProcess(runtimeName, requests);
+            }
         }
         break;
     }
@@ -539,7 +799,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
         IOX_LOG(ERROR, "Unknown IPC message command [" << runtime::IpcMessageTypeToString(cmd) << "]");
 
-        m_prcMgr->sendMessageNotSupportedToRuntime(runtimeName);
+        m_prcMgr.sendMessageNotSupportedToRuntime(runtimeName);
         break;
     }
     }
@@ -554,12 +814,13 @@ void RouDi::registerProcess(const RuntimeName_t& name,
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
     IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+        m_prcMgr.registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
+    // the registrations may be handled concurrently by the runtime message workers
+    static std::atomic<uint64_t> sessionId{0U};
     return ++sessionId;
 }
 
@@ -38,10 +38,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"termination-delay", required_argument, nullptr, 't'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"runtime-message-workers", required_argument, nullptr, 'w'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:t:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:t:k:w:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -87,6 +88,16 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "                                  SIGKILL to application which did not respond" << std::endl;
             std::cout << "                                  to the initial SIGTERM signal." << std::endl;
             std::cout << "                                  default = '45'" << std::endl;
+            std::cout << "-w, --runtime-message-workers <UINT>" << std::endl;
+            std::cout << "                                  Sets the number of threads which handle the" << std::endl;
+            std::cout << "                                  messages of the applications, e.g. the" << std::endl;
+            std::cout << "                                  registration and the creation of ports." << std::endl;
+            std::cout << "                                  The messages of one application are always" << std::endl;
+            std::cout << "                                  handled by the same thread." << std::endl;
+            std::cout << "                                  <UINT> [1, " << roudi::MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS
+                      << "]" << std::endl;
+            std::cout << "                                  default = '"
+                      << roudi::DEFAULT_NUMBER_OF_RUNTIME_MESSAGE_WORKERS << "'" << std::endl;
 
             m_cmdLineArgs.run = false;
             break;
@@ -196,6 +207,23 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             }
             break;
         }
+        case 'w':
+        {
+            uint32_t runtimeMessageWorkers{0U};
+            if (!convert::fromString(optarg, runtimeMessageWorkers) || runtimeMessageWorkers == 0U
+                || runtimeMessageWorkers > roudi::MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS)
+            {
+                IOX_LOG(ERROR,
+                        "The number of runtime message workers must be in the range of [1, "
+                            << roudi::MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS << "]");
+                m_cmdLineArgs.run = false;
+            }
+            else
+            {
+                m_cmdLineArgs.runtimeMessageWorkers = runtimeMessageWorkers;
+            }
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
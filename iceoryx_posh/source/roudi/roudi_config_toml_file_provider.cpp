@@ -113,6 +113,10 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
         return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_CONFIG_FILE_VERSION);
     }
 
+    iox::RouDiConfig_t parsedConfig;
+    parsedConfig.m_zeroingOptions.zeroOnCreation = general->get_as<bool>("zero-shm-on-creation").value_or(true);
+    parsedConfig.m_zeroingOptions.numberOfThreads = general->get_as<uint32_t>("shm-zeroing-threads").value_or(1U);
+
     auto segments = parsedFile->get_table_array("segment");
     if (!segments)
     {
@@ -125,7 +129,6 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
     }
 
     auto groupOfCurrentProcess = iox::posix::PosixGroup::getGroupOfCurrentProcess().getName();
-    iox::RouDiConfig_t parsedConfig;
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
@@ -156,10 +159,23 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
             }
             mempoolConfig.addMemPool({*chunkSize, *chunkCount});
         }
+
+        iox::posix::MemoryMapPageOptions pageOptions;
+        pageOptions.transparentHugePages = segment->get_as<bool>("transparent-huge-pages").value_or(false);
+        pageOptions.prefault = segment->get_as<bool>("prefault").value_or(false);
+        pageOptions.lockInMemory = segment->get_as<bool>("lock-memory").value_or(false);
+        auto numaNode = segment->get_as<uint32_t>("numa-node");
+        if (numaNode)
+        {
+            pageOptions.numaNode = *numaNode;
+        }
+
         parsedConfig.m_sharedMemorySegments.push_back(
             {iox::posix::PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              iox::posix::PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
-             mempoolConfig});
+             mempoolConfig,
+             iox::mepoo::MemoryInfo(),
+             pageOptions});
     }
 
     return iox::ok(parsedConfig);
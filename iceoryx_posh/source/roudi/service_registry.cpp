@@ -38,46 +38,62 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         auto& entry = m_serviceDescriptions[index];
         ((*entry).*count)++;
         m_dataChanged = true;
+        ++m_sequenceNumber;
         return ok();
     }
 
-    // entry does not exist, find a free slot if it exists
-
-    // fast path to a free slot (which was occupied by previously removed entry),
-    // prefer to fill entries close to the front
-    if (m_freeIndex != NO_INDEX)
+    // entry does not exist, reuse a slot which was occupied by a previously removed entry
+    if (!m_freeIndices.empty())
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        m_freeIndex = NO_INDEX;
-        return ok();
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
     }
-
-    // search from start
-    for (auto& entry : m_serviceDescriptions)
+    // append new entry at the end (the size only grows up to capacity)
+    else if (m_serviceDescriptions.emplace_back())
     {
-        if (!entry)
-        {
-            entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            m_dataChanged = true;
-            return ok();
-        }
+        index = static_cast<uint32_t>(m_serviceDescriptions.size() - 1U);
     }
-
-    // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    else
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        return ok();
+        return err(Error::SERVICE_REGISTRY_FULL);
     }
 
-    return err(Error::SERVICE_REGISTRY_FULL);
+    auto& entry = m_serviceDescriptions[index];
+    entry.emplace(serviceDescription);
+    (*entry).*count = 1U;
+    updateIndices(index, &Index_t::insert);
+    m_dataChanged = true;
+    ++m_sequenceNumber;
+    return ok();
+}
+
+void ServiceRegistry::updateIndices(const uint32_t index, IndexUpdate_t update) noexcept
+{
+    const auto& serviceDescription = m_serviceDescriptions[index]->serviceDescription;
+    const auto& service = serviceDescription.getServiceIDString();
+    const auto& instance = serviceDescription.getInstanceIDString();
+
+    auto hasServiceDescription = [&](const uint32_t slot) {
+        return m_serviceDescriptions[slot]->serviceDescription == serviceDescription;
+    };
+    auto hasService = [&](const uint32_t slot) {
+        return m_serviceDescriptions[slot]->serviceDescription.getServiceIDString() == service;
+    };
+    auto hasInstance = [&](const uint32_t slot) {
+        return m_serviceDescriptions[slot]->serviceDescription.getInstanceIDString() == instance;
+    };
+
+    (m_serviceDescriptionIndex.*update)(index, Index_t::hash(serviceDescription), hasServiceDescription);
+    (m_serviceIndex.*update)(index, Index_t::hash(service), hasService);
+    (m_instanceIndex.*update)(index, Index_t::hash(instance), hasInstance);
+}
+
+void ServiceRegistry::removeEntry(const uint32_t index) noexcept
+{
+    updateIndices(index, &Index_t::remove);
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndices.push_back(index);
 }
 
 expected<void, ServiceRegistry::Error>
@@ -103,11 +119,11 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                removeEntry(index);
             }
+            // the counters are part of the registry data, hence also a decrement is a change
+            m_dataChanged = true;
+            ++m_sequenceNumber;
         }
     }
 }
@@ -123,11 +139,11 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                removeEntry(index);
             }
+            // the counters are part of the registry data, hence also a decrement is a change
+            m_dataChanged = true;
+            ++m_sequenceNumber;
         }
     }
 }
@@ -137,11 +153,9 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
+        removeEntry(index);
         m_dataChanged = true;
+        ++m_sequenceNumber;
     }
 }
 
@@ -150,33 +164,82 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
+    auto matches = [&](const ServiceDescriptionEntry& entry) {
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+        return match;
+    };
+
+    if (service && instance && event)
     {
-        if (entry)
+        auto index = findIndex(*service, *instance, *event);
+        if (index != NO_INDEX)
         {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
 
-            if (match)
+    if (service)
+    {
+        auto hasService = [&](const uint32_t slot) {
+            return m_serviceDescriptions[slot]->serviceDescription.getServiceIDString() == *service;
+        };
+        for (auto index = m_serviceIndex.find(Index_t::hash(*service), hasService); index != NO_INDEX;
+             index = m_serviceIndex.next(index))
+        {
+            if (matches(*m_serviceDescriptions[index]))
             {
-                callable(*entry);
+                callable(*m_serviceDescriptions[index]);
             }
         }
+        return;
     }
-}
 
-uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
-{
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    if (instance)
+    {
+        auto hasInstance = [&](const uint32_t slot) {
+            return m_serviceDescriptions[slot]->serviceDescription.getInstanceIDString() == *instance;
+        };
+        for (auto index = m_instanceIndex.find(Index_t::hash(*instance), hasInstance); index != NO_INDEX;
+             index = m_instanceIndex.next(index))
+        {
+            if (matches(*m_serviceDescriptions[index]))
+            {
+                callable(*m_serviceDescriptions[index]);
+            }
+        }
+        return;
+    }
+
+    // only the event or nothing is specified
+    for (auto& entry : m_serviceDescriptions)
     {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
+        if (entry && matches(*entry))
         {
-            return i;
+            callable(*entry);
         }
     }
-    return NO_INDEX;
+}
+
+uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
+{
+    return findIndex(serviceDescription.getServiceIDString(),
+                     serviceDescription.getInstanceIDString(),
+                     serviceDescription.getEventIDString());
+}
+
+uint32_t ServiceRegistry::findIndex(const capro::IdString_t& service,
+                                    const capro::IdString_t& instance,
+                                    const capro::IdString_t& event) const noexcept
+{
+    return m_serviceDescriptionIndex.find(Index_t::hash(service, instance, event), [&](const uint32_t slot) {
+        const auto& serviceDescription = m_serviceDescriptions[slot]->serviceDescription;
+        return serviceDescription.getServiceIDString() == service
+               && serviceDescription.getInstanceIDString() == instance
+               && serviceDescription.getEventIDString() == event;
+    });
 }
 
 void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
@@ -190,6 +253,11 @@ void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)>
     }
 }
 
+uint64_t ServiceRegistry::sequenceNumber() const noexcept
+{
+    return m_sequenceNumber;
+}
+
 bool ServiceRegistry::hasDataChangedSinceLastCall() noexcept
 {
     auto dataChanged = m_dataChanged;
@@ -0,0 +1,67 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry_changes.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+constexpr uint32_t ServiceRegistryChanges::CAPACITY;
+constexpr uint64_t ServiceRegistryChanges::SNAPSHOT_INTERVAL;
+constexpr uint64_t ServiceRegistryChanges::HISTORY_CAPACITY;
+constexpr uint64_t ServiceRegistryChanges::QUEUE_CAPACITY;
+
+bool ServiceRegistryChanges::applyTo(ServiceRegistry& registry) const noexcept
+{
+    if (registry.sequenceNumber() >= sequenceNumber)
+    {
+        return true;
+    }
+
+    // every change increases the sequence number of the registry by one
+    const uint64_t sequenceNumberBeforeChanges = sequenceNumber - changes.size();
+    if (registry.sequenceNumber() < sequenceNumberBeforeChanges)
+    {
+        return false;
+    }
+
+    for (uint64_t i = registry.sequenceNumber() - sequenceNumberBeforeChanges; i < changes.size(); ++i)
+    {
+        const auto& change = changes[i];
+        switch (change.type)
+        {
+        case ServiceRegistryChange::Type::ADD_PUBLISHER:
+            // cannot fail since the registry has the same entries as the one of RouDi before the change
+            IOX_DISCARD_RESULT(registry.addPublisher(change.serviceDescription));
+            break;
+        case ServiceRegistryChange::Type::REMOVE_PUBLISHER:
+            registry.removePublisher(change.serviceDescription);
+            break;
+        case ServiceRegistryChange::Type::ADD_SERVER:
+            IOX_DISCARD_RESULT(registry.addServer(change.serviceDescription));
+            break;
+        case ServiceRegistryChange::Type::REMOVE_SERVER:
+            registry.removeServer(change.serviceDescription);
+            break;
+        }
+    }
+
+    return registry.sequenceNumber() == sequenceNumber;
+}
+
+} // namespace roudi
+} // namespace iox
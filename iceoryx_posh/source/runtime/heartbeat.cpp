@@ -16,48 +16,20 @@
 
 #include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 
-#include "iceoryx_hoofs/posix_wrapper/posix_call.hpp"
-#include "iceoryx_platform/time.hpp"
-#include "iox/duration.hpp"
-
 namespace iox
 {
 namespace runtime
 {
-Heartbeat::Heartbeat() noexcept
-{
-    beat();
-}
+Heartbeat::Heartbeat() noexcept = default;
 
-/// @brief Get the elapsed milliseconds since the last heartbeat
-uint64_t Heartbeat::elapsed_milliseconds_since_last_beat() const noexcept
+uint64_t Heartbeat::beat_count() const noexcept
 {
-    auto now = milliseconds_since_epoch();
-    auto timestamp_last_beat = m_timestamp_last_beat.load(std::memory_order_relaxed);
-    if (timestamp_last_beat >= now)
-    {
-        return 0;
-    }
-    return now - timestamp_last_beat;
+    return m_beat_count.load(std::memory_order_relaxed);
 }
 
-/// @brief Update the heartbeat timestamp
 void Heartbeat::beat() noexcept
 {
-    m_timestamp_last_beat.store(milliseconds_since_epoch(), std::memory_order_relaxed);
-}
-
-uint64_t Heartbeat::milliseconds_since_epoch() noexcept
-{
-    struct timespec timepoint
-    {
-    };
-
-    IOX_ENSURES_WITH_MSG(
-        !posix::posixCall(clock_gettime)(CLOCK_MONOTONIC, &timepoint).failureReturnValue(-1).evaluate().has_error(),
-        "An error which should never happen occured during 'clock_gettime'!");
-
-    return units::Duration(timepoint).toMilliseconds();
+    m_beat_count.fetch_add(1U, std::memory_order_relaxed);
 }
 } // namespace runtime
 } // namespace iox
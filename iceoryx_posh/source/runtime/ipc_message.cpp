@@ -45,24 +45,36 @@ uint32_t IpcMessage::getNumberOfElements() const noexcept
 
 std::string IpcMessage::getElementAtIndex(const uint32_t index) const noexcept
 {
-    std::string messageRemainder(m_msg);
     size_t startPos = 0u;
-    size_t endPos = messageRemainder.find_first_of(m_separator, startPos);
+    size_t endPos = m_msg.find_first_of(m_separator, startPos);
 
     for (uint32_t counter = 0u; endPos != std::string::npos; ++counter)
     {
         if (counter == index)
         {
-            return messageRemainder.substr(startPos, endPos - startPos);
+            return m_msg.substr(startPos, endPos - startPos);
         }
 
         startPos = endPos + 1u;
-        endPos = messageRemainder.find_first_of(m_separator, startPos);
+        endPos = m_msg.find_first_of(m_separator, startPos);
     }
 
     return std::string();
 }
 
+optional<std::string> IpcMessage::getNextElement(uint64_t& position) const noexcept
+{
+    const size_t endPos = m_msg.find_first_of(m_separator, position);
+    if (endPos == std::string::npos)
+    {
+        return nullopt;
+    }
+
+    std::string element = m_msg.substr(position, endPos - position);
+    position = endPos + 1u;
+    return element;
+}
+
 bool IpcMessage::isValidEntry(const std::string& entry) const noexcept
 {
     if (entry.find(m_separator) != std::string::npos)
@@ -98,6 +110,19 @@ void IpcMessage::setMessage(const std::string& msg) noexcept
     }
 }
 
+void IpcMessage::addEntries(const IpcMessage& message) noexcept
+{
+    if (!message.isValid())
+    {
+        IOX_LOG(ERROR, "\'" << message.m_msg.c_str() << "\' is an invalid IPC channel message");
+        m_isValid = false;
+        return;
+    }
+
+    m_msg.append(message.m_msg);
+    m_numberOfElements += message.m_numberOfElements;
+}
+
 void IpcMessage::clearMessage() noexcept
 {
     m_msg.clear();
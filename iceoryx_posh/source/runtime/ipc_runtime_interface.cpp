@@ -33,7 +33,8 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
                                          const RuntimeName_t& runtimeName,
                                          const units::Duration roudiWaitingTimeout) noexcept
     : m_runtimeName(runtimeName)
-    , m_RoudiIpcInterface(roudiName)
+    // a CREATE_PORTS request may use the whole message size of the IPC channel
+    , m_RoudiIpcInterface(roudiName, APP_MAX_MESSAGES, IpcInterfaceUser::MAX_MESSAGE_SIZE)
 {
     m_AppIpcInterface.emplace(runtimeName);
     if (!m_AppIpcInterface->isInitialized())
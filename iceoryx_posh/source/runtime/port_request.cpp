@@ -0,0 +1,59 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_request.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+PortRequest::PortRequest(const capro::ServiceDescription& service,
+                         const popo::PublisherOptions& publisherOptions,
+                         const PortConfigInfo& portConfigInfo) noexcept
+    : service(service)
+    , options(in_place_type<popo::PublisherOptions>(), publisherOptions)
+    , portConfigInfo(portConfigInfo)
+{
+}
+
+PortRequest::PortRequest(const capro::ServiceDescription& service,
+                         const popo::SubscriberOptions& subscriberOptions,
+                         const PortConfigInfo& portConfigInfo) noexcept
+    : service(service)
+    , options(in_place_type<popo::SubscriberOptions>(), subscriberOptions)
+    , portConfigInfo(portConfigInfo)
+{
+}
+
+PortRequest::PortRequest(const capro::ServiceDescription& service,
+                         const popo::ClientOptions& clientOptions,
+                         const PortConfigInfo& portConfigInfo) noexcept
+    : service(service)
+    , options(in_place_type<popo::ClientOptions>(), clientOptions)
+    , portConfigInfo(portConfigInfo)
+{
+}
+
+PortRequest::PortRequest(const capro::ServiceDescription& service,
+                         const popo::ServerOptions& serverOptions,
+                         const PortConfigInfo& portConfigInfo) noexcept
+    : service(service)
+    , options(in_place_type<popo::ServerOptions>(), serverOptions)
+    , portConfigInfo(portConfigInfo)
+{
+}
+} // namespace runtime
+} // namespace iox
@@ -31,6 +31,85 @@ namespace iox
 {
 namespace runtime
 {
+namespace
+{
+/// @brief The message types of the single request and the errors for the kind of port of a PortRequest
+struct PortKind
+{
+    IpcMessageType request;
+    IpcMessageType ack;
+    IpcMessageErrorType invalidResponse;
+    IpcMessageErrorType wrongResponse;
+};
+
+// the order corresponds to the alternatives of PortRequest::Options_t
+constexpr PortKind PORT_KINDS[]{
+    {IpcMessageType::CREATE_PUBLISHER,
+     IpcMessageType::CREATE_PUBLISHER_ACK,
+     IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE,
+     IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE},
+    {IpcMessageType::CREATE_SUBSCRIBER,
+     IpcMessageType::CREATE_SUBSCRIBER_ACK,
+     IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE,
+     IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE},
+    {IpcMessageType::CREATE_CLIENT,
+     IpcMessageType::CREATE_CLIENT_ACK,
+     IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE,
+     IpcMessageErrorType::REQUEST_CLIENT_WRONG_IPC_MESSAGE_RESPONSE},
+    {IpcMessageType::CREATE_SERVER,
+     IpcMessageType::CREATE_SERVER_ACK,
+     IpcMessageErrorType::REQUEST_SERVER_INVALID_RESPONSE,
+     IpcMessageErrorType::REQUEST_SERVER_WRONG_IPC_MESSAGE_RESPONSE},
+};
+
+// the response to a port is the message type, the offset and the segment id as decimal numbers plus the separators
+constexpr uint64_t MAX_PORT_RESPONSE_SIZE{11U + 20U + 20U + 3U};
+
+PoshRuntime::PortData_t toPortData(const uint64_t kind, void* const ptr) noexcept
+{
+    switch (kind)
+    {
+    case 0U:
+        return PoshRuntime::PortData_t(in_place_index<0U>(), static_cast<PublisherPortUserType::MemberType_t*>(ptr));
+    case 1U:
+        return PoshRuntime::PortData_t(in_place_index<1U>(), static_cast<SubscriberPortUserType::MemberType_t*>(ptr));
+    case 2U:
+        return PoshRuntime::PortData_t(in_place_index<2U>(), static_cast<popo::ClientPortUser::MemberType_t*>(ptr));
+    default:
+        return PoshRuntime::PortData_t(in_place_index<3U>(), static_cast<popo::ServerPortUser::MemberType_t*>(ptr));
+    }
+}
+
+/// @brief reads the response to one port of a CREATE_PORTS_ACK, which is identical to the response to the single
+/// request for the port
+expected<PoshRuntime::PortData_t, IpcMessageErrorType>
+readPortResponse(const IpcMessage& response, uint64_t& position, const uint64_t kind) noexcept
+{
+    const auto type = response.getNextElement(position);
+    const auto first = response.getNextElement(position);
+    if (type.has_value() && first.has_value())
+    {
+        const auto messageType = stringToIpcMessageType(type.value().c_str());
+        if (messageType == IpcMessageType::ERROR)
+        {
+            return err(stringToIpcMessageErrorType(first.value().c_str()));
+        }
+
+        const auto second = response.getNextElement(position);
+        if (messageType == PORT_KINDS[kind].ack && second.has_value())
+        {
+            UntypedRelativePointer::offset_t offset{0U};
+            convert::fromString(first.value().c_str(), offset);
+            segment_id_underlying_t segmentId{0U};
+            convert::fromString(second.value().c_str(), segmentId);
+            return ok(toPortData(kind, UntypedRelativePointer::getPtr(segment_id_t{segmentId}, offset)));
+        }
+    }
+
+    return err(PORT_KINDS[kind].wrongResponse);
+}
+} // namespace
+
 PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name, const RuntimeLocation location) noexcept
     : PoshRuntime(name)
     , m_ipcChannelInterface(roudi::IPC_CHANNEL_ROUDI_NAME, *name.value(), runtime::PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
@@ -58,7 +137,7 @@ PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name, const Runt
                                                          heartbeatAddressOffset.value());
     }
 
-    static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::DISCOVERY_INTERVAL, "Keep alive interval too small");
+    static_assert(PROCESS_KEEP_ALIVE_INTERVAL > roudi::PROCESS_MONITORING_INTERVAL, "Keep alive interval too small");
     m_keepAliveTask.emplace(concurrent::PeriodicTaskAutoStart,
                             PROCESS_KEEP_ALIVE_INTERVAL,
                             "KeepAlive",
@@ -100,27 +179,11 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
                                         const popo::PublisherOptions& publisherOptions,
                                         const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_HISTORY_CAPACITY =
-        PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
-
-    auto options = publisherOptions;
-    if (options.historyCapacity > MAX_HISTORY_CAPACITY)
-    {
-        IOX_LOG(WARN,
-                "Requested history capacity "
-                    << options.historyCapacity << " exceeds the maximum possible one for this publisher"
-                    << ", limiting from " << publisherOptions.historyCapacity << " to " << MAX_HISTORY_CAPACITY);
-        options.historyCapacity = MAX_HISTORY_CAPACITY;
-    }
-
-    if (options.nodeName.empty())
-    {
-        options.nodeName = m_appName;
-    }
+    auto options = limitPublisherOptions(publisherOptions);
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<Serialization>(service).toString() << publisherOptions.serialize().toString()
+               << static_cast<Serialization>(service).toString() << options.serialize().toString()
                << static_cast<Serialization>(portConfigInfo).toString();
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
@@ -215,37 +278,7 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
                                          const popo::SubscriberOptions& subscriberOptions,
                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
-
-    auto options = subscriberOptions;
-    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN,
-                "Requested queue capacity "
-                    << options.queueCapacity << " exceeds the maximum possible one for this subscriber"
-                    << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY);
-        options.queueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (0U == options.queueCapacity)
-    {
-        IOX_LOG(WARN,
-                "Requested queue capacity of 0 doesn't make sense as no data would be received,"
-                    << " the capacity is set to 1");
-        options.queueCapacity = 1U;
-    }
-
-    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
-    {
-        IOX_LOG(WARN,
-                "Requested historyRequest for "
-                    << service << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!");
-        options.historyRequest = subscriberOptions.queueCapacity;
-    }
-
-    if (options.nodeName.empty())
-    {
-        options.nodeName = m_appName;
-    }
+    auto options = limitSubscriberOptions(service, subscriberOptions);
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
@@ -327,23 +360,7 @@ popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const c
                                                                          const popo::ClientOptions& clientOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
-    auto options = clientOptions;
-    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN,
-                "Requested response queue capacity "
-                    << options.responseQueueCapacity << " exceeds the maximum possible one for this client"
-                    << ", limiting from " << options.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY);
-        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (options.responseQueueCapacity == 0U)
-    {
-        IOX_LOG(WARN,
-                "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
-                    << " the capacity is set to 1");
-        options.responseQueueCapacity = 1U;
-    }
+    auto options = limitClientOptions(clientOptions);
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_CLIENT) << m_appName
@@ -435,23 +452,7 @@ popo::ServerPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareServer(const c
                                                                          const popo::ServerOptions& serverOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
 {
-    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
-    auto options = serverOptions;
-    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
-    {
-        IOX_LOG(WARN,
-                "Requested request queue capacity "
-                    << options.requestQueueCapacity << " exceeds the maximum possible one for this server"
-                    << ", limiting from " << options.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY);
-        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
-    }
-    else if (options.requestQueueCapacity == 0U)
-    {
-        IOX_LOG(WARN,
-                "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
-                    << " the capacity is set to 1");
-        options.requestQueueCapacity = 1U;
-    }
+    auto options = limitServerOptions(serverOptions);
 
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SERVER) << m_appName
@@ -681,6 +682,231 @@ popo::ConditionVariableData* PoshRuntimeImpl::getMiddlewareConditionVariable() n
     return maybeConditionVariable.value();
 }
 
+popo::PublisherOptions
+PoshRuntimeImpl::limitPublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept
+{
+    constexpr uint64_t MAX_HISTORY_CAPACITY =
+        PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
+
+    auto options = publisherOptions;
+    if (options.historyCapacity > MAX_HISTORY_CAPACITY)
+    {
+        IOX_LOG(WARN,
+                "Requested history capacity "
+                    << options.historyCapacity << " exceeds the maximum possible one for this publisher"
+                    << ", limiting from " << publisherOptions.historyCapacity << " to " << MAX_HISTORY_CAPACITY);
+        options.historyCapacity = MAX_HISTORY_CAPACITY;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+    return options;
+}
+
+popo::SubscriberOptions PoshRuntimeImpl::limitSubscriberOptions(const capro::ServiceDescription& service,
+                                                                const popo::SubscriberOptions& subscriberOptions) const
+    noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
+
+    auto options = subscriberOptions;
+    if (options.queueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN,
+                "Requested queue capacity "
+                    << options.queueCapacity << " exceeds the maximum possible one for this subscriber"
+                    << ", limiting from " << subscriberOptions.queueCapacity << " to " << MAX_QUEUE_CAPACITY);
+        options.queueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (0U == options.queueCapacity)
+    {
+        IOX_LOG(WARN,
+                "Requested queue capacity of 0 doesn't make sense as no data would be received,"
+                    << " the capacity is set to 1");
+        options.queueCapacity = 1U;
+    }
+
+    if (subscriberOptions.historyRequest > subscriberOptions.queueCapacity)
+    {
+        IOX_LOG(WARN,
+                "Requested historyRequest for "
+                    << service << " is larger than queueCapacity. Clamping historyRequest to queueCapacity!");
+        options.historyRequest = subscriberOptions.queueCapacity;
+    }
+
+    if (options.nodeName.empty())
+    {
+        options.nodeName = m_appName;
+    }
+    return options;
+}
+
+popo::ClientOptions PoshRuntimeImpl::limitClientOptions(const popo::ClientOptions& clientOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ClientChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    auto options = clientOptions;
+    if (options.responseQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN,
+                "Requested response queue capacity "
+                    << options.responseQueueCapacity << " exceeds the maximum possible one for this client"
+                    << ", limiting from " << options.responseQueueCapacity << " to " << MAX_QUEUE_CAPACITY);
+        options.responseQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (options.responseQueueCapacity == 0U)
+    {
+        IOX_LOG(WARN,
+                "Requested response queue capacity of 0 doesn't make sense as no data would be received,"
+                    << " the capacity is set to 1");
+        options.responseQueueCapacity = 1U;
+    }
+    return options;
+}
+
+popo::ServerOptions PoshRuntimeImpl::limitServerOptions(const popo::ServerOptions& serverOptions) const noexcept
+{
+    constexpr uint64_t MAX_QUEUE_CAPACITY = iox::popo::ServerChunkQueueConfig::MAX_QUEUE_CAPACITY;
+    auto options = serverOptions;
+    if (options.requestQueueCapacity > MAX_QUEUE_CAPACITY)
+    {
+        IOX_LOG(WARN,
+                "Requested request queue capacity "
+                    << options.requestQueueCapacity << " exceeds the maximum possible one for this server"
+                    << ", limiting from " << options.requestQueueCapacity << " to " << MAX_QUEUE_CAPACITY);
+        options.requestQueueCapacity = MAX_QUEUE_CAPACITY;
+    }
+    else if (options.requestQueueCapacity == 0U)
+    {
+        IOX_LOG(WARN,
+                "Requested request queue capacity of 0 doesn't make sense as no data would be received,"
+                    << " the capacity is set to 1");
+        options.requestQueueCapacity = 1U;
+    }
+    return options;
+}
+
+PoshRuntime::PortResponses_t PoshRuntimeImpl::getMiddlewarePorts(const PortRequests_t& requests) noexcept
+{
+    // the requests are packed into as few CREATE_PORTS messages as possible; a message must also leave enough space
+    // for the response to all of its ports
+    constexpr uint64_t MAX_MESSAGE_SIZE{IpcInterfaceBase::MAX_MESSAGE_SIZE};
+
+    PortResponses_t responses;
+    IpcMessage sendBuffer;
+    uint64_t requestSize{0U};
+    uint64_t responseSize{0U};
+    uint64_t first{0U};
+    auto startMessage = [&] {
+        sendBuffer.clearMessage();
+        sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+        requestSize = sendBuffer.getMessage().size();
+        responseSize = IpcMessageTypeToString(IpcMessageType::CREATE_PORTS_ACK).size() + 1U;
+    };
+    auto sendMessage = [&](const uint64_t last) {
+        requestPortsFromRoudi(sendBuffer, &requests[first], last - first, responses);
+        first = last;
+        startMessage();
+    };
+
+    startMessage();
+    for (uint64_t i = 0U; i < requests.size(); ++i)
+    {
+        const auto entries = serializePortRequest(requests[i]);
+        const uint64_t entriesSize{entries.getMessage().size()};
+        const bool fitsIntoMessage = entries.isValid() && (requestSize + entriesSize <= MAX_MESSAGE_SIZE)
+                                     && (responseSize + MAX_PORT_RESPONSE_SIZE <= MAX_MESSAGE_SIZE);
+        if (i != first && !fitsIntoMessage)
+        {
+            sendMessage(i);
+        }
+
+        sendBuffer.addEntries(entries);
+        requestSize += entriesSize;
+        responseSize += MAX_PORT_RESPONSE_SIZE;
+
+        // an invalid request is sent on its own and fails like the corresponding single request
+        if (!entries.isValid())
+        {
+            sendMessage(i + 1U);
+        }
+    }
+
+    if (first < requests.size())
+    {
+        sendMessage(requests.size());
+    }
+
+    return responses;
+}
+
+IpcMessage PoshRuntimeImpl::serializePortRequest(const PortRequest& request) const noexcept
+{
+    const auto& options = request.options;
+
+    IpcMessage entries;
+    entries << IpcMessageTypeToString(PORT_KINDS[options.index()].request)
+            << static_cast<Serialization>(request.service).toString();
+    if (const auto* publisherOptions = options.get<popo::PublisherOptions>())
+    {
+        entries << limitPublisherOptions(*publisherOptions).serialize().toString();
+    }
+    else if (const auto* subscriberOptions = options.get<popo::SubscriberOptions>())
+    {
+        entries << limitSubscriberOptions(request.service, *subscriberOptions).serialize().toString();
+    }
+    else if (const auto* clientOptions = options.get<popo::ClientOptions>())
+    {
+        entries << limitClientOptions(*clientOptions).serialize().toString();
+    }
+    else if (const auto* serverOptions = options.get<popo::ServerOptions>())
+    {
+        entries << limitServerOptions(*serverOptions).serialize().toString();
+    }
+    entries << static_cast<Serialization>(request.portConfigInfo).toString();
+    return entries;
+}
+
+void PoshRuntimeImpl::requestPortsFromRoudi(const IpcMessage& sendBuffer,
+                                            const PortRequest* const requests,
+                                            const uint64_t numberOfRequests,
+                                            PortResponses_t& responses) noexcept
+{
+    IpcMessage receiveBuffer;
+    const bool hasResponse = sendRequestToRouDi(sendBuffer, receiveBuffer);
+    if (!hasResponse)
+    {
+        IOX_LOG(ERROR, "Request ports got invalid response!");
+    }
+
+    uint64_t position{0U};
+    const auto responseType = receiveBuffer.getNextElement(position);
+    const bool isAck = responseType.has_value()
+                       && stringToIpcMessageType(responseType.value().c_str()) == IpcMessageType::CREATE_PORTS_ACK;
+    if (hasResponse && !isAck)
+    {
+        IOX_LOG(ERROR, "Request ports got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'");
+    }
+
+    for (uint64_t i = 0U; i < numberOfRequests; ++i)
+    {
+        const uint64_t kind{requests[i].options.index()};
+        if (!hasResponse)
+        {
+            responses.emplace_back(err(PORT_KINDS[kind].invalidResponse));
+        }
+        else if (!isAck)
+        {
+            responses.emplace_back(err(PORT_KINDS[kind].wrongResponse));
+        }
+        else
+        {
+            responses.emplace_back(readPortResponse(receiveBuffer, position, kind));
+        }
+    }
+}
+
 bool PoshRuntimeImpl::sendRequestToRouDi(const IpcMessage& msg, IpcMessage& answer) noexcept
 {
     // runtime must be thread safe
@@ -29,8 +29,38 @@ void ServiceDiscovery::update()
 {
     // allows us to use update and hence findService concurrently
     std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    if (!m_isServiceRegistryUpToDate)
+    {
+        updateFromSnapshot();
+    }
+
+    bool hasChanges{true};
+    while (hasChanges)
+    {
+        hasChanges =
+            m_serviceRegistryChangesSubscriber.take()
+                .and_then([&](popo::Sample<const roudi::ServiceRegistryChanges>& changesSample) {
+                    m_isServiceRegistryUpToDate = changesSample->applyTo(*m_serviceRegistry);
+                    if (!m_isServiceRegistryUpToDate)
+                    {
+                        // changes are missing, e.g. due to a queue overflow; RouDi published a snapshot before
+                        // these changes from which we can continue
+                        updateFromSnapshot();
+                        m_isServiceRegistryUpToDate = changesSample->applyTo(*m_serviceRegistry);
+                    }
+                })
+                .has_value();
+    }
+}
+
+void ServiceDiscovery::updateFromSnapshot()
+{
     m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
+        if (serviceRegistrySample->sequenceNumber() > m_serviceRegistry->sequenceNumber())
+        {
+            *m_serviceRegistry = *serviceRegistrySample;
+            m_isServiceRegistryUpToDate = true;
+        }
     });
 }
 
@@ -80,7 +110,8 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryChangesSubscriber.enableEvent(std::move(triggerHandle),
+                                                       popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -97,7 +128,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryChangesSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -110,13 +141,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryChangesSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryChangesSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
@@ -78,6 +78,7 @@ void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
             .accessMode(accessMode)
             .openMode(posix::OpenMode::OPEN_EXISTING)
             .permissions(SHM_SEGMENT_PERMISSIONS)
+            .pageOptions(segment.m_pageOptions)
             .create()
             .and_then([this, &segment](auto& sharedMemoryObject) {
                 if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
@@ -0,0 +1,272 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi_env/minimal_roudi_config.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::units::duration_literals;
+using namespace iox::roudi_env;
+
+using iox::capro::IdString_t;
+using iox::capro::ServiceDescription;
+
+constexpr std::chrono::seconds TIMEOUT{5};
+
+/// @brief counts the samples which were forwarded to the external system
+struct CountingExternalTerminal
+{
+    CountingExternalTerminal(IdString_t, IdString_t, IdString_t){};
+
+    std::atomic<uint64_t> numberOfForwardedSamples{0U};
+    std::atomic<uint64_t> numberOfForwardCalls{0U};
+    std::atomic<bool> isStalled{false};
+};
+
+using TestChannel = iox::gw::Channel<iox::popo::UntypedSubscriber, CountingExternalTerminal>;
+
+class ForwardingGateway : public iox::gw::GatewayGeneric<TestChannel>
+{
+  public:
+    ForwardingGateway(const iox::units::Duration forwardingPeriod, const uint32_t numberOfForwardingThreads)
+        : iox::gw::GatewayGeneric<TestChannel>(
+            iox::capro::Interfaces::INTERNAL, 1000_ms, forwardingPeriod, numberOfForwardingThreads)
+    {
+    }
+
+    ~ForwardingGateway() override
+    {
+        shutdown();
+    }
+
+    void loadConfiguration(const iox::config::GatewayConfig&) noexcept override
+    {
+    }
+
+    void discover(const iox::capro::CaproMessage&) noexcept override
+    {
+    }
+
+    void forward(const TestChannel& channel) noexcept override
+    {
+        auto externalTerminal = channel.getExternalTerminal();
+        externalTerminal->numberOfForwardCalls++;
+        if (externalTerminal->isStalled.load())
+        {
+            return;
+        }
+
+        auto subscriber = channel.getIceoryxTerminal();
+        subscriber->take().and_then([&](const void* userPayload) {
+            subscriber->release(userPayload);
+            externalTerminal->numberOfForwardedSamples++;
+        });
+    }
+
+    using iox::gw::GatewayGeneric<TestChannel>::addChannel;
+    using iox::gw::GatewayGeneric<TestChannel>::discardChannel;
+};
+
+class GatewayGenericForwarding_IntegrationTest : public RouDi_GTest
+{
+  public:
+    GatewayGenericForwarding_IntegrationTest()
+        : RouDi_GTest(MinimalRouDiConfigBuilder().payloadChunkCount(64U).create())
+    {
+    }
+
+    void SetUp() override
+    {
+        iox::runtime::PoshRuntime::initRuntime("GatewayGenericForwarding_IntegrationTest");
+    }
+
+    static ServiceDescription serviceFor(const uint64_t index)
+    {
+        return ServiceDescription(
+            "Gateway", "Forwarding", IdString_t(iox::TruncateToCapacity, std::to_string(index).c_str()));
+    }
+
+    static void waitUntilSubscribed(const TestChannel& channel)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        while (channel.getIceoryxTerminal()->getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
+        {
+            ASSERT_THAT(std::chrono::steady_clock::now() - start, Lt(TIMEOUT));
+            std::this_thread::yield();
+        }
+    }
+
+    static void publishSamples(iox::popo::UntypedPublisher& publisher, const uint64_t numberOfSamples)
+    {
+        for (uint64_t i = 0U; i < numberOfSamples; ++i)
+        {
+            ASSERT_FALSE(publisher.loan(sizeof(uint64_t))
+                             .and_then([&](void* userPayload) { publisher.publish(userPayload); })
+                             .has_error());
+        }
+    }
+
+    static bool waitForForwardedSamples(const TestChannel& channel, const uint64_t numberOfSamples)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        while (channel.getExternalTerminal()->numberOfForwardedSamples.load() < numberOfSamples)
+        {
+            if (std::chrono::steady_clock::now() - start > TIMEOUT)
+            {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+};
+
+TEST_F(GatewayGenericForwarding_IntegrationTest, ReceivedSamplesAreForwardedWithoutWaitingForTheForwardingPeriod)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e1f0a3c-58d2-4b97-a4e6-c2d83f9b7105");
+    constexpr uint64_t NUMBER_OF_SAMPLES{3U};
+    ForwardingGateway sut{1000_ms, 1U};
+    sut.runMultithreaded();
+
+    auto channel = sut.addChannel(serviceFor(0U), iox::popo::SubscriberOptions()).expect("channel is created");
+    iox::popo::UntypedPublisher publisher{serviceFor(0U)};
+    waitUntilSubscribed(channel);
+
+    const auto start = std::chrono::steady_clock::now();
+    publishSamples(publisher, NUMBER_OF_SAMPLES);
+
+    ASSERT_TRUE(waitForForwardedSamples(channel, NUMBER_OF_SAMPLES));
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(std::chrono::milliseconds(500)));
+    EXPECT_FALSE(channel.getIceoryxTerminal()->hasData());
+}
+
+TEST_F(GatewayGenericForwarding_IntegrationTest, SamplesReceivedBeforeTheGatewayRunsAreForwarded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3a85d7e-0c64-4f19-9e2b-7d41c6a0f853");
+    constexpr uint64_t NUMBER_OF_SAMPLES{2U};
+    ForwardingGateway sut{1000_ms, 1U};
+
+    auto channel = sut.addChannel(serviceFor(0U), iox::popo::SubscriberOptions()).expect("channel is created");
+    iox::popo::UntypedPublisher publisher{serviceFor(0U)};
+    waitUntilSubscribed(channel);
+    publishSamples(publisher, NUMBER_OF_SAMPLES);
+
+    sut.runMultithreaded();
+
+    EXPECT_TRUE(waitForForwardedSamples(channel, NUMBER_OF_SAMPLES));
+}
+
+TEST_F(GatewayGenericForwarding_IntegrationTest, ChannelsAreForwardedByAPoolOfForwardingThreads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d7c2e94-a1f8-4b53-86c9-e5f02b4d9a17");
+    constexpr uint64_t NUMBER_OF_CHANNELS{8U};
+    constexpr uint64_t NUMBER_OF_SAMPLES{4U};
+    ForwardingGateway sut{1000_ms, 3U};
+    sut.runMultithreaded();
+
+    std::vector<TestChannel> channels;
+    std::vector<std::unique_ptr<iox::popo::UntypedPublisher>> publishers;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHANNELS; ++i)
+    {
+        channels.push_back(sut.addChannel(serviceFor(i), iox::popo::SubscriberOptions()).expect("channel is created"));
+        publishers.emplace_back(new iox::popo::UntypedPublisher(serviceFor(i)));
+    }
+    for (uint64_t i = 0U; i < NUMBER_OF_CHANNELS; ++i)
+    {
+        waitUntilSubscribed(channels[i]);
+        publishSamples(*publishers[i], NUMBER_OF_SAMPLES);
+    }
+
+    for (const auto& channel : channels)
+    {
+        EXPECT_TRUE(waitForForwardedSamples(channel, NUMBER_OF_SAMPLES));
+    }
+}
+
+TEST_F(GatewayGenericForwarding_IntegrationTest, DiscardedChannelsAreNoLongerForwarded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f58b1c06-3e9d-4a72-b7f4-1a6d0e8c2395");
+    ForwardingGateway sut{1000_ms, 1U};
+    sut.runMultithreaded();
+
+    auto channel = sut.addChannel(serviceFor(0U), iox::popo::SubscriberOptions()).expect("channel is created");
+    iox::popo::UntypedPublisher publisher{serviceFor(0U)};
+    waitUntilSubscribed(channel);
+    ASSERT_FALSE(sut.discardChannel(serviceFor(0U)).has_error());
+
+    publishSamples(publisher, 1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_THAT(channel.getExternalTerminal()->numberOfForwardedSamples.load(), Eq(0U));
+    EXPECT_TRUE(channel.getIceoryxTerminal()->hasData());
+}
+
+TEST_F(GatewayGenericForwarding_IntegrationTest, ForwardWhichTakesNoSampleDoesNotBlockTheChannel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "93a01e73-eaa2-4506-a585-a8970f2e3a0c");
+    ForwardingGateway sut{1000_ms, 1U};
+    sut.runMultithreaded();
+
+    auto channel = sut.addChannel(serviceFor(0U), iox::popo::SubscriberOptions()).expect("channel is created");
+    channel.getExternalTerminal()->isStalled.store(true);
+    iox::popo::UntypedPublisher publisher{serviceFor(0U)};
+    waitUntilSubscribed(channel);
+
+    publishSamples(publisher, 1U);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    EXPECT_THAT(channel.getExternalTerminal()->numberOfForwardCalls.load(), Le(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+    EXPECT_FALSE(sut.discardChannel(serviceFor(0U)).has_error());
+    EXPECT_TRUE(channel.getIceoryxTerminal()->hasData());
+}
+
+TEST_F(GatewayGenericForwarding_IntegrationTest, DataLeftByAFailedForwardIsForwardedWithoutANewSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b844bce4-c3ed-4bcb-a20f-78a4023ca4bf");
+    ForwardingGateway sut{50_ms, 1U};
+    sut.runMultithreaded();
+
+    auto channel = sut.addChannel(serviceFor(0U), iox::popo::SubscriberOptions()).expect("channel is created");
+    channel.getExternalTerminal()->isStalled.store(true);
+    iox::popo::UntypedPublisher publisher{serviceFor(0U)};
+    waitUntilSubscribed(channel);
+
+    publishSamples(publisher, 1U);
+    const auto start = std::chrono::steady_clock::now();
+    while (channel.getExternalTerminal()->numberOfForwardCalls.load() == 0U)
+    {
+        ASSERT_THAT(std::chrono::steady_clock::now() - start, Lt(TIMEOUT));
+        std::this_thread::yield();
+    }
+    channel.getExternalTerminal()->isStalled.store(false);
+
+    EXPECT_TRUE(waitForForwardedSamples(channel, 1U));
+    EXPECT_FALSE(channel.getIceoryxTerminal()->hasData());
+}
+
+} // namespace
@@ -210,6 +210,11 @@ class PortUser_IntegrationTest : public Test
         // Subscription done and ready to receive samples
         while (!finished)
         {
+            // The state of the publishers has to be loaded before trying to receive a chunk, otherwise a chunk which
+            // was sent between the receive attempt and the check of the publishers would be missed
+            const bool havePublishersFinished =
+                (m_publisherRunFinished.load(std::memory_order_acquire) == numberOfPublishers);
+
             // Try to receive chunk
             subscriberPortUser.tryGetChunk()
                 .and_then([&](auto& chunkHeader) {
@@ -220,7 +225,7 @@ class PortUser_IntegrationTest : public Test
                     if (result == ChunkReceiveResult::NO_CHUNK_AVAILABLE)
                     {
                         // Nothing received -> check if publisher(s) still running
-                        if (m_publisherRunFinished.load(std::memory_order_relaxed) == numberOfPublishers)
+                        if (havePublishersFinished)
                         {
                             finished = true;
                         }
@@ -322,7 +327,7 @@ class PortUser_IntegrationTest : public Test
         }
 
         // Signal the subscriber thread we're done
-        m_publisherRunFinished++;
+        m_publisherRunFinished.fetch_add(1U, std::memory_order_release);
     }
 };
 
@@ -0,0 +1,202 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/posix_wrapper/posix_access_rights.hpp"
+#include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/roudi/iceoryx_roudi_components.hpp"
+#include "iceoryx_posh/roudi_env/minimal_roudi_config.hpp"
+#include "iceoryx_posh/version/version_info.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/std_string_support.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "test.hpp"
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+using namespace iox::roudi_env;
+using namespace iox::runtime;
+using namespace iox::units::duration_literals;
+
+/// @brief Registers many runtimes at once, like after a system boot, and measures how long RouDi needs to handle all
+/// registrations with the given number of runtime message workers
+class RouDiRuntimeMessageWorkers_test : public Test
+{
+  public:
+    static constexpr uint32_t NUMBER_OF_RUNTIMES{200U};
+
+    void startRouDi(const uint32_t numberOfWorkers)
+    {
+        roudiComponents.reset(new IceOryxRouDiComponents(MinimalRouDiConfigBuilder().create()));
+        roudi.reset(new RouDi(roudiComponents->rouDiMemoryManager,
+                              roudiComponents->portManager,
+                              RouDi::RoudiStartupParameters{MonitoringMode::OFF,
+                                                            false,
+                                                            RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                            version::CompatibilityCheckLevel::PATCH,
+                                                            PROCESS_DEFAULT_KILL_DELAY,
+                                                            PROCESS_DEFAULT_TERMINATION_DELAY,
+                                                            numberOfWorkers}));
+    }
+
+    void TearDown() override
+    {
+        roudi.reset();
+        roudiComponents.reset();
+    }
+
+    static RuntimeName_t runtimeName(const uint32_t numberOfWorkers, const uint32_t index)
+    {
+        return into<lossy<RuntimeName_t>>("app_" + std::to_string(numberOfWorkers) + "_" + std::to_string(index));
+    }
+
+    void registerRuntimesConcurrently(const uint32_t numberOfWorkers)
+    {
+        startRouDi(numberOfWorkers);
+
+        std::atomic<uint32_t> errorCount{0U};
+        auto errorHandlerGuard = ErrorHandlerMock::setTemporaryErrorHandler<PoshError>(
+            [&errorCount](const PoshError, const ErrorLevel) { ++errorCount; });
+
+        std::atomic<uint32_t> registeredRuntimes{0U};
+        std::atomic_bool start{false};
+        std::vector<std::thread> runtimes;
+        for (uint32_t i = 0U; i < NUMBER_OF_RUNTIMES; ++i)
+        {
+            runtimes.emplace_back([&, i] {
+                const auto name = runtimeName(numberOfWorkers, i);
+                while (!start.load())
+                {
+                    std::this_thread::yield();
+                }
+                IpcRuntimeInterface sut(IPC_CHANNEL_ROUDI_NAME, name, 30_s);
+                if (sut.getShmTopicSize() > 0U)
+                {
+                    ++registeredRuntimes;
+                }
+            });
+        }
+
+        const auto begin = std::chrono::steady_clock::now();
+        start.store(true);
+        for (auto& runtime : runtimes)
+        {
+            runtime.join();
+        }
+        const auto duration =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+
+        EXPECT_THAT(registeredRuntimes.load(), Eq(NUMBER_OF_RUNTIMES));
+        EXPECT_THAT(errorCount.load(), Eq(0U));
+
+        ::testing::Test::RecordProperty("REGISTRATION_DURATION_MS", static_cast<int>(duration.count()));
+    }
+
+    /// @brief sends the registration and a request without waiting for the REG_ACK in between, like a runtime whose
+    /// messages are queued in the IPC channel of RouDi; the request can only be handled after the registration
+    static void sendRegistrationFollowedByRequest(const RuntimeName_t& name,
+                                                  const IpcInterfaceUser& roudiChannel,
+                                                  const IpcInterfaceCreator& appChannel,
+                                                  std::vector<std::string>& responses)
+    {
+        const auto transmissionTimestamp =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch())
+                .count();
+        IpcMessage registration;
+        registration << IpcMessageTypeToString(IpcMessageType::REG) << name << convert::toString(getpid())
+                     << convert::toString(posix::PosixUser::getUserOfCurrentProcess().getID())
+                     << convert::toString(transmissionTimestamp)
+                     << static_cast<Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+        IpcMessage request;
+        request << IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE) << name;
+
+        ASSERT_TRUE(roudiChannel.send(registration));
+        ASSERT_TRUE(roudiChannel.send(request));
+
+        for (uint32_t i = 0U; i < 2U; ++i)
+        {
+            IpcMessage response;
+            if (!appChannel.timedReceive(5_s, response))
+            {
+                return;
+            }
+            responses.push_back(response.getElementAtIndex(0U));
+        }
+    }
+
+    std::unique_ptr<IceOryxRouDiComponents> roudiComponents;
+    std::unique_ptr<RouDi> roudi;
+};
+
+constexpr uint32_t RouDiRuntimeMessageWorkers_test::NUMBER_OF_RUNTIMES;
+
+TEST_F(RouDiRuntimeMessageWorkers_test, ConcurrentRegistrationsWithOneWorkerSucceed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "86e46231-3fbb-45d5-b578-7c4aebef6d98");
+    registerRuntimesConcurrently(1U);
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, ConcurrentRegistrationsWithMultipleWorkersSucceed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f78bb19d-053e-46c8-861d-251fc6fcc672");
+    registerRuntimesConcurrently(4U);
+}
+
+TEST_F(RouDiRuntimeMessageWorkers_test, MessagesOfOneRuntimeAreHandledInOrderWithMultipleWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e13ee53-77ac-4c03-8174-447086a56486");
+    constexpr uint32_t NUMBER_OF_WORKERS{4U};
+    constexpr uint32_t NUMBER_OF_ORDERED_RUNTIMES{16U};
+    startRouDi(NUMBER_OF_WORKERS);
+
+    std::vector<std::vector<std::string>> responses(NUMBER_OF_ORDERED_RUNTIMES);
+    std::vector<std::thread> runtimes;
+    for (uint32_t i = 0U; i < NUMBER_OF_ORDERED_RUNTIMES; ++i)
+    {
+        runtimes.emplace_back([&, i] {
+            const auto name = runtimeName(NUMBER_OF_WORKERS, i);
+            IpcInterfaceCreator appChannel(name);
+            IpcInterfaceUser roudiChannel(IPC_CHANNEL_ROUDI_NAME);
+            ASSERT_TRUE(appChannel.isInitialized());
+            ASSERT_TRUE(roudiChannel.isInitialized());
+            sendRegistrationFollowedByRequest(name, roudiChannel, appChannel, responses[i]);
+        });
+    }
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+
+    for (const auto& responsesOfRuntime : responses)
+    {
+        EXPECT_THAT(responsesOfRuntime,
+                    ElementsAre(IpcMessageTypeToString(IpcMessageType::REG_ACK),
+                                IpcMessageTypeToString(IpcMessageType::CREATE_CONDITION_VARIABLE_ACK)));
+    }
+}
+
+} // namespace
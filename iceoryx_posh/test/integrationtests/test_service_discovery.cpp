@@ -29,6 +29,7 @@
 #include "iceoryx_posh/testing/roudi_gtest.hpp"
 #include "test.hpp"
 
+#include <memory>
 #include <random>
 #include <set>
 #include <type_traits>
@@ -174,7 +175,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 7U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -245,6 +246,81 @@ TYPED_TEST(ServiceDiscovery_test, ServiceOfferedMultipleTimesCanBeFound)
     EXPECT_THAT(serviceContainer[0], Eq(SERVICE_DESCRIPTION));
 }
 
+TYPED_TEST(ServiceDiscovery_test, ServicesCanBeFoundAfterMoreChangesThanTheQueueCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c5e0d2b-48a1-4f63-b9e7-1a3c6f8d02e5");
+    using Producer = typename TestFixture::CommunicationKind::Producer;
+    constexpr uint64_t NUMBER_OF_SERVICES{2U * iox::roudi::ServiceRegistryChanges::QUEUE_CAPACITY + 1U};
+
+    this->findService(IdString_t("service"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_TRUE(serviceContainer.empty());
+
+    // every discovery loop publishes the changes separately, hence the oldest changes are discarded from the queue
+    std::vector<std::unique_ptr<Producer>> producers;
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        const IdString_t instance(TruncateToCapacity, std::to_string(i).c_str());
+        producers.emplace_back(new Producer(ServiceDescription("service", instance, "event")));
+        this->triggerDiscoveryLoopAndWaitToFinish();
+    }
+
+    this->findService(IdString_t("service"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_THAT(serviceContainer.size(), Eq(NUMBER_OF_SERVICES));
+
+    producers.erase(producers.begin() + 1, producers.end());
+    this->triggerDiscoveryLoopAndWaitToFinish();
+
+    this->findService(IdString_t("service"), iox::capro::Wildcard, iox::capro::Wildcard);
+    ASSERT_THAT(serviceContainer.size(), Eq(1U));
+    EXPECT_THAT(serviceContainer[0], Eq(ServiceDescription("service", "0", "event")));
+}
+
+TYPED_TEST(ServiceDiscovery_test, ServicesCanBeFoundAfterMoreChangesThanFitIntoOnePublication)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1b94a36-0c7f-4d28-a5e3-6f2d9b8c1a07");
+    using Producer = typename TestFixture::CommunicationKind::Producer;
+    constexpr uint64_t NUMBER_OF_SERVICES{iox::roudi::ServiceRegistryChanges::CAPACITY + 1U};
+
+    std::vector<std::unique_ptr<Producer>> producers;
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        const IdString_t instance(TruncateToCapacity, std::to_string(i).c_str());
+        producers.emplace_back(new Producer(ServiceDescription("service", instance, "event")));
+    }
+    this->triggerDiscoveryLoopAndWaitToFinish();
+
+    this->findService(IdString_t("service"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_THAT(serviceContainer.size(), Eq(NUMBER_OF_SERVICES));
+}
+
+TYPED_TEST(ServiceDiscovery_test, ServiceDiscoveryCreatedAfterManyChangesFindsAllServices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f8a7c1e-d602-4b95-8e4a-b7c0d3e5f219");
+    using Producer = typename TestFixture::CommunicationKind::Producer;
+    constexpr uint64_t NUMBER_OF_SERVICES{iox::roudi::ServiceRegistryChanges::SNAPSHOT_INTERVAL + 3U};
+
+    std::vector<std::unique_ptr<Producer>> producers;
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        const IdString_t instance(TruncateToCapacity, std::to_string(i).c_str());
+        producers.emplace_back(new Producer(ServiceDescription("service", instance, "event")));
+        this->triggerDiscoveryLoopAndWaitToFinish();
+    }
+
+    // the late joiner obtains the last snapshot and the newer changes from the history
+    ServiceDiscovery lateSut;
+    this->triggerDiscoveryLoopAndWaitToFinish();
+
+    ServiceContainer services;
+    lateSut.findService(
+        IdString_t("service"),
+        iox::capro::Wildcard,
+        iox::capro::Wildcard,
+        [&](const ServiceDescription& s) { services.push_back(s); },
+        TestFixture::CommunicationKind::PATTERN);
+    EXPECT_THAT(services.size(), Eq(NUMBER_OF_SERVICES));
+}
+
 //
 // Notification Tests
 // Check whether attaching, notification and detaching of waitset and listener works
@@ -451,6 +527,9 @@ class ReferenceDiscovery
             services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
                              iox::SERVICE_DISCOVERY_EVENT_NAME);
+            services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                             iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                             iox::SERVICE_DISCOVERY_CHANGES_EVENT_NAME);
         }
     }
 
@@ -56,8 +56,15 @@ class MockPublisherPortUser
     MOCK_METHOD4(tryAllocateChunk,
                  iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError>(
                      const uint32_t, const uint32_t, const uint32_t, const uint32_t));
+    MOCK_METHOD5(tryAllocateChunkBatch,
+                 iox::expected<void, iox::popo::AllocationError>(const uint32_t,
+                                                                 const uint32_t,
+                                                                 const uint32_t,
+                                                                 const uint32_t,
+                                                                 const iox::span<iox::mepoo::ChunkHeader*>));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD1(sendChunkBatch, void(const iox::span<iox::mepoo::ChunkHeader* const>));
     MOCK_METHOD0(tryGetPreviousChunk, iox::optional<iox::mepoo::ChunkHeader*>());
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
@@ -52,7 +52,13 @@ class MockSubscriberPortUser
     MOCK_METHOD0(unsubscribe, void());
     MOCK_CONST_METHOD0(getSubscriptionState, iox::SubscribeState());
     MOCK_METHOD0(tryGetChunk, iox::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
+    MOCK_METHOD2(tryGetChunkBatch,
+                 iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(const iox::span<const iox::mepoo::ChunkHeader*>,
+                                                                        const iox::span<uint32_t>));
     MOCK_METHOD1(releaseChunk, void(const void* const));
+    MOCK_METHOD2(releaseChunk, void(const void* const, const uint32_t));
+    MOCK_METHOD2(releaseChunkBatch,
+                 void(const iox::span<const iox::mepoo::ChunkHeader* const>, const iox::span<const uint32_t>));
     MOCK_METHOD0(releaseQueuedChunks, void());
     MOCK_CONST_METHOD0(hasNewChunks, bool());
     MOCK_METHOD0(hasLostChunksSinceLastCall, bool());
@@ -79,6 +85,10 @@ class MockBaseSubscriber
     MOCK_CONST_METHOD0(hasData, bool());
     MOCK_METHOD0(hasMissedData, bool());
     MOCK_METHOD0(takeChunk, iox::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>());
+    MOCK_METHOD1(takeChunk, iox::expected<const iox::mepoo::ChunkHeader*, iox::popo::ChunkReceiveResult>(uint32_t&));
+    MOCK_METHOD2(takeChunkBatch,
+                 iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(const iox::span<const iox::mepoo::ChunkHeader*>,
+                                                                        const iox::span<uint32_t>));
     MOCK_METHOD0(releaseQueuedData, void());
     MOCK_METHOD1(invalidateTrigger, bool(const uint64_t));
     MOCK_METHOD1(disableEvent, void(const iox::popo::SubscriberEvent));
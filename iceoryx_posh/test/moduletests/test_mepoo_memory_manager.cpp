@@ -18,11 +18,14 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "iceoryx_hoofs/testing/mocks/logger_mock.hpp"
+#include "iceoryx_hoofs/testing/testing_logger.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+
 namespace
 {
 using namespace ::testing;
@@ -413,6 +416,94 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, emptyMemPoolWithNextLargerMemPoolFallbackPolicyAcquiresChunksFromNextLargerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12534bdf-b796-4d44-96c0-67cfc6c1f15d");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.setFallbackPolicy(iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT + 1U, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(1U));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
+
+    iox::testing::TestingLogger::checkLogMessageIfLogLevelIsSupported(
+        iox::log::LogLevel::WARN, [&](const auto& logMessages) {
+            EXPECT_THAT(logMessages, Not(Contains(HasSubstr("has no more space left"))));
+        });
+}
+
+TEST_F(MemoryManager_test, getChunkWithNextLargerMemPoolFallbackPolicyFailsWhenAllLargerMemPoolsAreEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0111d956-63b9-4a7c-a588-9e00c0ed0fcf");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.setFallbackPolicy(iox::mepoo::MemPoolFallbackPolicy::NEXT_LARGER_MEMPOOL);
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(3U * CHUNK_COUNT, chunkSettings_64);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_64)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(CHUNK_COUNT));
+
+    iox::testing::TestingLogger::checkLogMessageIfLogLevelIsSupported(
+        iox::log::LogLevel::WARN, [&](const auto& logMessages) {
+            const auto numberOfWarnings =
+                std::count_if(logMessages.begin(), logMessages.end(), [](const std::string& message) {
+                    return message.find("has no more space left") != std::string::npos;
+                });
+            EXPECT_THAT(numberOfWarnings, Eq(3));
+        });
+}
+
+TEST_F(MemoryManager_test, getChunkAcquiresChunkFromSmallestFittingMemPoolWithinTheSameSizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fdd58447-b501-41cb-b34c-b7be3adb9653");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    constexpr uint32_t NUMBER_OF_MEMPOOLS{8U};
+    constexpr uint32_t USER_PAYLOAD_SIZE_BASE{1024U};
+    constexpr uint32_t USER_PAYLOAD_SIZE_STEP{64U};
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        mempoolconf.addMemPool({USER_PAYLOAD_SIZE_BASE + i * USER_PAYLOAD_SIZE_STEP, CHUNK_COUNT});
+    }
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    for (uint32_t i = 0U; i < NUMBER_OF_MEMPOOLS; ++i)
+    {
+        auto chunkSettingsResult = ChunkSettings::create(USER_PAYLOAD_SIZE_BASE + i * USER_PAYLOAD_SIZE_STEP,
+                                                         iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT);
+        ASSERT_FALSE(chunkSettingsResult.has_error());
+        auto chunkStore = getChunksFromSut(1U, chunkSettingsResult.value());
+
+        for (uint32_t j = 0U; j < NUMBER_OF_MEMPOOLS; ++j)
+        {
+            EXPECT_THAT(sut->getMemPoolInfo(j).m_usedChunks, Eq(i == j ? 1U : 0U));
+        }
+    }
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0eddc5b5-e28f-43df-9da7-2c12014284a5");
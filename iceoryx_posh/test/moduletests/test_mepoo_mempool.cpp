@@ -22,6 +22,9 @@
 #include "iox/bump_allocator.hpp"
 #include "test.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -219,6 +222,58 @@ TEST_F(MemPool_test, GetMinFreeMethodReturnsTheNumberOfFreeChunks)
     }
 }
 
+TEST_F(MemPool_test, GetChunkViaCacheDoesNotCountCachedChunksAsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b6434d14-386c-4391-8411-86d5ceda27cd");
+    MemPoolCache cache;
+
+    EXPECT_THAT(sut.getChunk(cache), Ne(nullptr));
+
+    EXPECT_THAT(sut.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(sut.getInfo().m_usedChunks, Eq(1U));
+    EXPECT_THAT(cache.m_size, Eq(MemPoolCache::CAPACITY - 1U));
+    EXPECT_THAT(sut.getMinFree(), Eq(NUMBER_OF_CHUNKS - MemPoolCache::CAPACITY));
+}
+
+TEST_F(MemPool_test, GetChunkViaCacheAcquiresAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "75bc4909-c87e-43da-811f-8b6580824ef2");
+    MemPoolCache cache;
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk(cache));
+        EXPECT_THAT(chunks.back(), Ne(nullptr));
+        EXPECT_THAT(sut.getUsedChunks(), Eq(i + 1U));
+    }
+
+    EXPECT_THAT(sut.getChunk(cache), Eq(nullptr));
+
+    std::sort(chunks.begin(), chunks.end());
+    EXPECT_THAT(std::unique(chunks.begin(), chunks.end()), Eq(chunks.end()));
+}
+
+TEST_F(MemPool_test, ReleaseCacheReturnsCachedChunksToTheMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f18ae5af-ab6b-4757-9531-11361303d852");
+    MemPoolCache cache;
+    auto chunk = sut.getChunk(cache);
+
+    MemPool::releaseCache(cache);
+
+    EXPECT_THAT(cache.m_size, Eq(0U));
+    EXPECT_THAT(sut.getUsedChunks(), Eq(1U));
+
+    sut.freeChunk(chunk);
+    std::vector<void*> chunks;
+    for (uint32_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.push_back(sut.getChunk());
+        EXPECT_THAT(chunks.back(), Ne(nullptr));
+    }
+    EXPECT_THAT(sut.getUsedChunks(), Eq(NUMBER_OF_CHUNKS));
+}
+
 TEST_F(MemPool_test, dieWhenMempoolChunkSizeIsSmallerThan32Bytes)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7704246e-42b5-46fd-8827-ebac200390e1");
@@ -108,6 +108,12 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(iox::posix::MemoryMapPageOptions, pageOptions, iox::posix::MemoryMapPageOptions())
+
+        IOX_BUILDER_PARAMETER(iox::posix::SharedMemoryZeroingOptions,
+                              zeroingOptions,
+                              iox::posix::SharedMemoryZeroingOptions())
+
       public:
         iox::expected<SharedMemoryObject_MOCK, SharedMemoryObjectError> create() noexcept
         {
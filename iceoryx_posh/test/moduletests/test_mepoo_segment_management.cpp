@@ -40,7 +40,9 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator IOX_MAYBE_UNUSED,
                      const PosixGroup& readerGroup IOX_MAYBE_UNUSED,
                      const PosixGroup& writerGroup IOX_MAYBE_UNUSED,
-                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED) noexcept
+                     const MemoryInfo& memoryInfo IOX_MAYBE_UNUSED,
+                     const MemoryMapPageOptions& pageOptions IOX_MAYBE_UNUSED,
+                     const SharedMemoryZeroingOptions& zeroingOptions IOX_MAYBE_UNUSED) noexcept
     {
     }
 };
@@ -125,6 +127,25 @@ TEST_F(SegmentManager_test, getSegmentMappingsForWriteUser)
     EXPECT_THAT(mapping[0].m_isWritable == mapping[1].m_isWritable, Eq(false));
 }
 
+TEST_F(SegmentManager_test, getSegmentMappingsContainsThePageOptionsOfTheSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e6b2d4a8-93c1-4f7e-85d0-2a9c7f1e3b64");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    MemoryMapPageOptions pageOptions;
+    pageOptions.prefault = true;
+    segmentConfig.m_sharedMemorySegments.clear();
+    segmentConfig.m_sharedMemorySegments.push_back(
+        {"iox_roudi_test1", "iox_roudi_test2", mepooConfig, MemoryInfo(), pageOptions});
+
+    auto sut = createSut();
+    auto mapping = sut->getSegmentMappings(PosixUser{"iox_roudi_test2"});
+    ASSERT_THAT(mapping.size(), Eq(1u));
+    EXPECT_TRUE(mapping[0].m_pageOptions.prefault);
+    EXPECT_FALSE(mapping[0].m_pageOptions.transparentHugePages);
+    EXPECT_FALSE(mapping[0].m_pageOptions.lockInMemory);
+}
+
 TEST_F(SegmentManager_test, getSegmentMappingsEmptyForNonRegisteredUser)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7cf9a658-bb2d-444f-af67-0355e8f45ea2");
@@ -53,7 +53,8 @@ class SharedChunk_Test : public Test
         return v;
     }
 
-    static constexpr uint32_t CHUNK_SIZE{64U};
+    // large enough for the ChunkManagement with the timestamps of the latency instrumentation
+    static constexpr uint32_t CHUNK_SIZE{128U};
     static constexpr uint32_t NUMBER_OF_CHUNKS{10U};
     static constexpr uint32_t USER_PAYLOAD_SIZE{64U};
 
@@ -322,4 +323,58 @@ TEST_F(SharedChunk_Test, ReleaseMethodReturnsChunkManagementPointerOfSharedChunk
     EXPECT_EQ(sut.getChunkHeader(), nullptr);
 }
 
+TEST_F(SharedChunk_Test, AcquiredReferencesAreTakenOverByAdoptedSharedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8a64286-0fe2-4653-8bb8-e672b712d236");
+    constexpr uint64_t NUMBER_OF_REFERENCES{3U};
+    sut.acquireReferences(NUMBER_OF_REFERENCES);
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U + NUMBER_OF_REFERENCES));
+
+    {
+        SharedChunk adopted1 = sut.adoptAcquiredReference();
+        SharedChunk adopted2 = sut.adoptAcquiredReference();
+        SharedChunk adopted3 = sut.adoptAcquiredReference();
+        EXPECT_TRUE(adopted1 == sut);
+        EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U + NUMBER_OF_REFERENCES));
+    }
+
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U));
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(1U));
+}
+
+TEST_F(SharedChunk_Test, ReleasingUnusedAcquiredReferencesDoesNotFreeTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ca16996-4b53-484a-b19f-9f34ef1e7c3d");
+    sut.acquireReferences(3U);
+    {
+        SharedChunk adopted = sut.adoptAcquiredReference();
+        sut.releaseAcquiredReferences(2U);
+        EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(2U));
+    }
+
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U));
+    EXPECT_THAT(mempool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(chunkMgmtPool.getUsedChunks(), Eq(1U));
+}
+
+TEST_F(SharedChunk_Test, AcquiringZeroReferencesDoesNotChangeTheReferenceCounter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d89592f-de86-41fa-9ea7-bb2dc7e91091");
+    sut.acquireReferences(0U);
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U));
+    sut.releaseAcquiredReferences(0U);
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U));
+}
+
+TEST_F(SharedChunk_Test, AcquiringReferencesOnEmptySharedChunkAdoptsEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a44210e7-4e06-416a-8b07-492784761470");
+    SharedChunk emptySut;
+    emptySut.acquireReferences(2U);
+    EXPECT_FALSE(emptySut.adoptAcquiredReference());
+    emptySut.releaseAcquiredReferences(2U);
+    EXPECT_THAT(chunkManagement->m_referenceCounter.load(), Eq(1U));
+}
+
 } // namespace
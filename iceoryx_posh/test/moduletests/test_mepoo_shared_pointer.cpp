@@ -141,7 +141,8 @@ class SharedPointer_Test : public Test
     char memory[4096U];
     iox::BumpAllocator allocator{memory, 4096U};
     MemPool mempool{sizeof(ChunkHeader) + USER_PAYLOAD_SIZE, 10U, allocator, allocator};
-    MemPool chunkMgmtPool{64U, 10U, allocator, allocator};
+    // large enough for the ChunkManagement with the timestamps of the latency instrumentation
+    MemPool chunkMgmtPool{128U, 10U, allocator, allocator};
 
     void* memoryChunk{mempool.getChunk()};
     ChunkManagement* chunkManagement = GetChunkManagement(memoryChunk);
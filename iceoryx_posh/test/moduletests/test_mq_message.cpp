@@ -452,5 +452,54 @@ TEST_F(IpcMessage_test, setMessage)
     EXPECT_THAT(message1.isValid(), Eq(false));
 }
 
+TEST_F(IpcMessage_test, getNextElementReturnsAllElementsInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0dffc5cb-f3c0-4a72-85a3-15b1d0b5f3db");
+    IpcMessage message({"fuu", "", "bla"});
+
+    uint64_t position{0U};
+    auto element = message.getNextElement(position);
+    ASSERT_TRUE(element.has_value());
+    EXPECT_THAT(element.value(), Eq("fuu"));
+    element = message.getNextElement(position);
+    ASSERT_TRUE(element.has_value());
+    EXPECT_THAT(element.value(), Eq(""));
+    element = message.getNextElement(position);
+    ASSERT_TRUE(element.has_value());
+    EXPECT_THAT(element.value(), Eq("bla"));
+    EXPECT_FALSE(message.getNextElement(position).has_value());
+}
+
+TEST_F(IpcMessage_test, getNextElementOfEmptyMessageReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15f7bee8-616f-45bb-a40f-04faaf7c0ba7");
+    IpcMessage message;
+
+    uint64_t position{0U};
+    EXPECT_FALSE(message.getNextElement(position).has_value());
+}
+
+TEST_F(IpcMessage_test, addEntriesAppendsAllEntriesOfValidMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b3a62513-4664-4231-8e55-99f8ee79f83a");
+    IpcMessage message({"fuu", "bar"});
+
+    message.addEntries(IpcMessage({"bla", "blubb"}));
+
+    EXPECT_THAT(message.isValid(), Eq(true));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(4u));
+    EXPECT_THAT(message.getMessage(), Eq("fuu,bar,bla,blubb,"));
+}
+
+TEST_F(IpcMessage_test, addEntriesOfInvalidMessageInvalidatesMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0389dce2-3985-4d7e-b1a9-ca2e6b37e82d");
+    IpcMessage message({"fuu", "bar"});
+
+    message.addEntries(IpcMessage({"b,la"}));
+
+    EXPECT_THAT(message.isValid(), Eq(false));
+}
+
 } // namespace
 #endif
@@ -119,6 +119,12 @@ class ChunkDistributor_test : public Test
         return std::make_shared<ChunkDistributorData_t>(policy, HISTORY_SIZE);
     }
 
+    std::shared_ptr<ChunkDistributorData_t> getChunkDistributorDataWithoutHistory(
+        const ConsumerTooSlowPolicy policy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+    {
+        return std::make_shared<ChunkDistributorData_t>(policy, 0U);
+    }
+
     static constexpr std::chrono::milliseconds BLOCKING_DURATION{100};
 
     static constexpr iox::units::Duration DEADLOCK_TIMEOUT{2_s};
@@ -823,4 +829,202 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, RemovingBlockingQueueDuringDeliveryUnblocksDeliveryToRemainingQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "07fe1be4-0792-495b-8db6-d4910eed690e");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto blockingQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> blockingQueue(blockingQueueData.get());
+    blockingQueue.setCapacity(1U);
+    auto remainingQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> remainingQueue(remainingQueueData.get());
+    remainingQueue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(blockingQueueData.get(), 0U).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(remainingQueueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(73U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic<uint64_t> numberOfQueuesTheChunkWasDeliveredTo{0U};
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        numberOfQueuesTheChunkWasDeliveredTo = sut.deliverToAllStoredQueues(this->allocateChunk(37U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    ASSERT_FALSE(sut.tryRemoveQueue(blockingQueueData.get()).has_error());
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    auto maybeSharedChunk = remainingQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(73U));
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(numberOfQueuesTheChunkWasDeliveredTo.load(), Eq(1U));
+
+    maybeSharedChunk = remainingQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(37U));
+
+    maybeSharedChunk = blockingQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(73U));
+    EXPECT_THAT(blockingQueue.tryPop().has_value(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingQueueDeliversAllChunksInOrderWhenSpaceBecomesAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4bfecbde-7dc6-4bbf-9781-264722ef8a89");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(2U);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{5U};
+    std::vector<SharedChunk> chunks;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks)), Eq(1U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        while (!maybeSharedChunk.has_value())
+        {
+            std::this_thread::yield();
+            maybeSharedChunk = queue.tryPop();
+        }
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(queue.tryPop().has_value(), Eq(false));
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToNonBlockingQueuesDeliversTheNewestChunksToAllQueues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "45dc370b-e7de-4706-8a75-34e66230b304");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue1(queueData1.get());
+    queue1.setCapacity(2U);
+    auto queueData2 = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get(), 0U).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get(), 0U).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    std::vector<SharedChunk> chunks;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i));
+    }
+
+    EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks)), Eq(2U));
+
+    EXPECT_THAT(queue1.hasLostChunks(), Eq(true));
+    for (uint64_t i = 1U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue1.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_THAT(queue1.tryPop().has_value(), Eq(false));
+
+    EXPECT_THAT(queue2.hasLostChunks(), Eq(false));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue2.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+    EXPECT_THAT(queue2.tryPop().has_value(), Eq(false));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToBlockingAndNonBlockingQueuesReleasesAllChunksAfterwards)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c9ff35dd-45e4-42b8-8c33-d656d8dbd910");
+    auto sutData = this->getChunkDistributorDataWithoutHistory(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto blockingQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> blockingQueue(blockingQueueData.get());
+    blockingQueue.setCapacity(1U);
+    auto nonBlockingQueueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> nonBlockingQueue(nonBlockingQueueData.get());
+    nonBlockingQueue.setCapacity(1U);
+    ASSERT_FALSE(sut.tryAddQueue(blockingQueueData.get(), 0U).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(nonBlockingQueueData.get(), 0U).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    {
+        std::vector<SharedChunk> chunks;
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            chunks.emplace_back(this->allocateChunk(i));
+        }
+
+        std::thread t1(
+            [&] { EXPECT_THAT(sut.deliverBatchToAllStoredQueues(iox::span<const SharedChunk>(chunks)), Eq(2U)); });
+
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            auto maybeSharedChunk = blockingQueue.tryPop();
+            while (!maybeSharedChunk.has_value())
+            {
+                std::this_thread::yield();
+                maybeSharedChunk = blockingQueue.tryPop();
+            }
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+        }
+        t1.join();
+    }
+
+    // only the newest chunk is still held by the non-blocking queue
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+    EXPECT_THAT(nonBlockingQueue.hasLostChunks(), Eq(true));
+    auto maybeSharedChunk = nonBlockingQueue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(NUMBER_OF_CHUNKS - 1U));
+
+    maybeSharedChunk.reset();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+    EXPECT_THAT(this->chunkMgmtPool.getUsedChunks(), Eq(0U));
+}
+
 } // namespace
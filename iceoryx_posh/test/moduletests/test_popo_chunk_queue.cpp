@@ -28,6 +28,10 @@
 
 #include "test.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -264,6 +268,60 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, PushAfterUnsetConditionVariableDoesNotNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f60f4e54-fb6f-4131-b58a-d57572e66292");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+
+    this->m_popper.setConditionVariable(condVar, 0U);
+    this->m_popper.unsetConditionVariable();
+
+    auto chunk = this->allocateChunk();
+    this->m_pusher.push(chunk);
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ms).empty(), Eq(true));
+}
+
+TYPED_TEST(ChunkQueue_test, UnsetConditionVariableWaitsUntilThePushersInFlightFinishedNotifying)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23d7464a-8f2b-4a38-a9a2-48a71bf6e767");
+    ConditionVariableData condVar("Horscht");
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    // a pusher which read the published condition variable and did not yet notify it
+    this->m_chunkData.m_notifiersInFlight.fetch_add(1U);
+
+    std::atomic_bool hasUnset{false};
+    std::thread unsetter([&] {
+        this->m_popper.unsetConditionVariable();
+        hasUnset.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_THAT(hasUnset.load(), Eq(false));
+
+    this->m_chunkData.m_notifiersInFlight.fetch_sub(1U);
+    unsetter.join();
+
+    EXPECT_THAT(hasUnset.load(), Eq(true));
+    EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, UnsetConditionVariableDoesNotBlockForeverOnAPusherWhichTerminatedWhileNotifying)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "022a25b1-c2b1-4d05-ba24-b6785ca7ce8f");
+    ConditionVariableData condVar("Horscht");
+    this->m_popper.setConditionVariable(condVar, 0U);
+
+    // a pusher which terminated after it read the published condition variable
+    this->m_chunkData.m_notifiersInFlight.fetch_add(1U);
+
+    this->m_popper.unsetConditionVariable();
+
+    EXPECT_THAT(this->m_popper.isConditionVariableSet(), Eq(false));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -157,6 +157,59 @@ TEST_F(ChunkReceiver_test, getAndReleaseMultipleChunks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, getAndReleaseMultipleChunksWithTheirSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dacd213e-60aa-4520-86a4-1cd44cf7dc0c");
+    std::vector<std::pair<const iox::mepoo::ChunkHeader*, uint32_t>> chunks;
+
+    for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+        uint32_t slotIndex{0U};
+        auto maybeChunkHeader = m_chunkReceiver.tryGet(slotIndex);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.emplace_back(*maybeChunkHeader, slotIndex);
+    }
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY));
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+
+    for (const auto& chunk : chunks)
+    {
+        m_chunkReceiver.release(chunk.first, chunk.second);
+    }
+
+    EXPECT_FALSE(errorHandlerCalled);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, releaseChunkWithSlotOfOtherChunkCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a382b46-fbeb-411b-ad59-cdde5de6a9f2");
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    uint32_t firstSlotIndex{0U};
+    auto firstChunkHeader = m_chunkReceiver.tryGet(firstSlotIndex);
+    ASSERT_FALSE(firstChunkHeader.has_error());
+    uint32_t secondSlotIndex{0U};
+    auto secondChunkHeader = m_chunkReceiver.tryGet(secondSlotIndex);
+    ASSERT_FALSE(secondChunkHeader.has_error());
+
+    auto errorHandlerCalled{false};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&errorHandlerCalled](const iox::PoshError, const iox::ErrorLevel) { errorHandlerCalled = true; });
+
+    m_chunkReceiver.release(*firstChunkHeader, secondSlotIndex);
+
+    EXPECT_TRUE(errorHandlerCalled);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(2U));
+}
+
 TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
 {
     ::testing::Test::RecordProperty("TEST_ID", "58ff9db1-7ab9-471d-9492-4bd8fab47fcf");
@@ -184,6 +237,69 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getBatchFromEmptyQueueReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "721eddaf-846e-4bea-bb1d-2380120be345");
+    const iox::mepoo::ChunkHeader* chunkHeaders[4U]{};
+    uint32_t slotIndices[4U]{};
+    auto result = m_chunkReceiver.tryGetBatch(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders),
+                                              iox::span<uint32_t>(slotIndices));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+}
+
+TEST_F(ChunkReceiver_test, getBatchAndReleaseBatchOfMultipleChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e14c09e2-b126-41dd-a861-fd222f4b41ca");
+    constexpr uint64_t NUMBER_OF_QUEUED_CHUNKS{5U};
+    for (uint64_t i = 0; i < NUMBER_OF_QUEUED_CHUNKS; i++)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        new (sharedChunk.getUserPayload()) DummySample();
+        static_cast<DummySample*>(sharedChunk.getUserPayload())->dummy = i;
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_QUEUED_CHUNKS + 2U]{};
+    uint32_t slotIndices[NUMBER_OF_QUEUED_CHUNKS + 2U]{};
+    auto result = m_chunkReceiver.tryGetBatch(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders),
+                                              iox::span<uint32_t>(slotIndices));
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(*result, Eq(NUMBER_OF_QUEUED_CHUNKS));
+    EXPECT_TRUE(m_chunkReceiver.empty());
+
+    for (uint64_t i = 0; i < NUMBER_OF_QUEUED_CHUNKS; i++)
+    {
+        auto dummySample = *reinterpret_cast<const DummySample*>(chunkHeaders[i]->userPayload());
+        EXPECT_THAT(dummySample.dummy, Eq(i));
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_QUEUED_CHUNKS));
+
+    m_chunkReceiver.releaseBatch(iox::span<const iox::mepoo::ChunkHeader* const>(chunkHeaders, *result),
+                                 iox::span<const uint32_t>(slotIndices, *result));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkReceiver_test, getBatchDoesNotDropChunksWhenTooManyChunksAreHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "828a311e-e4a4-487e-921c-7f77b912b224");
+    for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+    }
+
+    m_chunkQueuePusher.push(getChunkFromMemoryManager());
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[2U]{};
+    uint32_t slotIndices[2U]{};
+    auto result = m_chunkReceiver.tryGetBatch(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders),
+                                              iox::span<uint32_t>(slotIndices));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_FALSE(m_chunkReceiver.empty());
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a47fd0e-a217-4565-98af-05779c938340");
@@ -35,6 +35,7 @@
 #include "test.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -110,9 +111,15 @@ class ChunkSender_test : public Test
         &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0}; // must be 0 for test
     ChunkSenderData_t m_chunkSenderDataWithHistory{
         &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, HISTORY_CAPACITY};
+    ChunkSenderData_t m_chunkSenderDataWithChunkCache{&m_memoryManager,
+                                                      iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                      0,
+                                                      iox::mepoo::MemoryInfo(),
+                                                      true};
 
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithHistory{&m_chunkSenderDataWithHistory};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithChunkCache{&m_chunkSenderDataWithChunkCache};
 };
 
 TEST_F(ChunkSender_test, allocate_OneChunkWithoutUserHeaderAndSmallUserPayloadAlignmentResultsInSmallChunk)
@@ -205,6 +212,51 @@ TEST_F(ChunkSender_test, allocate_Overflow)
                 Eq(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY));
 }
 
+TEST_F(ChunkSender_test, allocateBatch_AllocatesAllRequestedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d98b2e1-65a8-4362-abfe-5d6a065a2a71");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS]{};
+
+    auto result = m_chunkSender.tryAllocateBatch(UniquePortId(),
+                                                 sizeof(DummySample),
+                                                 alignof(DummySample),
+                                                 USER_HEADER_SIZE,
+                                                 USER_HEADER_ALIGNMENT,
+                                                 iox::span<iox::mepoo::ChunkHeader*>(chunkHeaders));
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(chunkHeaders[0], Ne(nullptr));
+    EXPECT_THAT(chunkHeaders[0], Ne(chunkHeaders[1]));
+    EXPECT_THAT(chunkHeaders[1], Ne(chunkHeaders[2]));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+    // the chunk cache is only used during the batch allocation since it is not enabled for this ChunkSender
+    EXPECT_THAT(m_chunkSenderData.m_chunkCache.m_chunkMemoryCache.m_size, Eq(0U));
+    EXPECT_THAT(m_chunkSenderData.m_chunkCache.m_chunkManagementCache.m_size, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, allocateBatch_OverflowAllocatesNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aad76300-c32f-4ef0-8779-5e38c4a6cfea");
+    constexpr uint64_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS]{};
+
+    auto result = m_chunkSender.tryAllocateBatch(UniquePortId(),
+                                                 sizeof(DummySample),
+                                                 alignof(DummySample),
+                                                 USER_HEADER_SIZE,
+                                                 USER_HEADER_ALIGNMENT,
+                                                 iox::span<iox::mepoo::ChunkHeader*>(chunkHeaders));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    for (auto chunkHeader : chunkHeaders)
+    {
+        EXPECT_THAT(chunkHeader, Eq(nullptr));
+    }
+}
+
 TEST_F(ChunkSender_test, freeChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b4a6eb09-a431-4f38-bd0c-38baf896a639");
@@ -394,6 +446,46 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendBatchWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b192610-3871-4851-a9eb-78a198559f9c");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS]{};
+
+    ASSERT_FALSE(m_chunkSender
+                     .tryAllocateBatch(UniquePortId(),
+                                       sizeof(DummySample),
+                                       alignof(DummySample),
+                                       USER_HEADER_SIZE,
+                                       USER_HEADER_ALIGNMENT,
+                                       iox::span<iox::mepoo::ChunkHeader*>(chunkHeaders))
+                     .has_error());
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        new (chunkHeaders[i]->userPayload()) DummySample();
+        static_cast<DummySample*>(chunkHeaders[i]->userPayload())->dummy = i;
+    }
+
+    auto numberOfDeliveries = m_chunkSender.sendBatch(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        auto dummySample = *reinterpret_cast<DummySample*>(popRet->getUserPayload());
+        EXPECT_THAT(dummySample.dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+
+    auto lastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(lastChunk.has_value());
+    EXPECT_THAT(*lastChunk, Eq(chunkHeaders[NUMBER_OF_CHUNKS - 1U]));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -725,6 +817,46 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, allocateWithChunkCacheCountsOnlyAllocatedChunksAsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5fbd25f1-072f-44c5-8e7e-395024dc9729");
+    auto maybeChunkHeader = m_chunkSenderWithChunkCache.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_minFreeChunks,
+                Eq(NUM_CHUNKS_IN_POOL - iox::mepoo::MemPoolCache::CAPACITY));
+
+    m_chunkSenderWithChunkCache.release(*maybeChunkHeader);
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, releaseAllReturnsTheChunksOfTheChunkCacheToTheMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cdcc196b-2cf0-463d-8948-686fe648f6ad");
+    auto maybeChunkHeader = m_chunkSenderWithChunkCache.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    m_chunkSenderWithChunkCache.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_chunkSenderDataWithChunkCache.m_chunkCache.m_chunkMemoryCache.m_size, Eq(0U));
+    EXPECT_THAT(m_chunkSenderDataWithChunkCache.m_chunkCache.m_chunkManagementCache.m_size, Eq(0U));
+
+    auto chunkSettings = iox::mepoo::ChunkSettings::create(sizeof(DummySample), alignof(DummySample)).value();
+    std::vector<iox::mepoo::SharedChunk> chunks;
+    for (uint32_t i = 0U; i < NUM_CHUNKS_IN_POOL; ++i)
+    {
+        auto chunk = m_memoryManager.getChunk(chunkSettings);
+        ASSERT_FALSE(chunk.has_error());
+        chunks.emplace_back(chunk.value());
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUM_CHUNKS_IN_POOL));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
@@ -135,9 +135,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(sut.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -150,9 +150,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -166,15 +166,70 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
 
+TEST_F(ConditionVariable_test, NotifyPostsTheSemaphoreWhenAnInterruptedNotifierActivatedTheNotificationBefore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c037b1f1-1662-4efc-9a53-951ae06e50d6");
+    // a notifier with the same index which activated the notification but did not post the semaphore
+    m_condVarData.m_activeNotifications[0U].fetch_or(1U);
+
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_condVarData.m_semaphore->tryWait().value());
+}
+
+TEST_F(ConditionVariable_test, NotifyWakesUpABlockedWaiterWhenAnInterruptedNotifierActivatedTheNotificationBefore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "20b1f66a-4952-41aa-9f62-a5413e123dd3");
+    Barrier isThreadStarted(1U);
+    NotificationVector_t activeNotifications;
+    std::thread waiter([&] {
+        isThreadStarted.notify();
+        activeNotifications = m_waiter.wait();
+    });
+    isThreadStarted.wait();
+
+    m_condVarData.m_activeNotifications[0U].fetch_or(1U);
+    m_signaler.notify();
+    waiter.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, NotificationsStoredInDifferentWordsAreReturnedInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d3b2e8a4-71c6-4f0e-8b59-a6c4e2f1d780");
+    constexpr uint64_t WORD_BITS = ConditionVariableData::NOTIFICATION_WORD_BITS;
+    static_assert(iox::MAX_NUMBER_OF_NOTIFIERS > WORD_BITS, "test requires more than one notification word");
+    ConditionListener sut(m_condVarData);
+
+    m_notifiers[iox::MAX_NUMBER_OF_NOTIFIERS - 1U].notify();
+    m_notifiers[WORD_BITS].notify();
+    m_notifiers[WORD_BITS - 1U].notify();
+    m_notifiers[0U].notify();
+
+    auto activeNotifications = sut.wait();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(4U));
+    EXPECT_THAT(activeNotifications[0U], Eq(0U));
+    EXPECT_THAT(activeNotifications[1U], Eq(WORD_BITS - 1U));
+    EXPECT_THAT(activeNotifications[2U], Eq(WORD_BITS));
+    EXPECT_THAT(activeNotifications[3U], Eq(iox::MAX_NUMBER_OF_NOTIFIERS - 1U));
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
+    {
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
+    }
+}
+
 TEST_F(ConditionVariable_test, TimedWaitWithZeroTimeoutWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "582f0b1c-c717-410e-8143-61459db672ad");
@@ -420,9 +475,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     });
 
@@ -465,6 +520,118 @@ TEST_F(ConditionVariable_test, TimedWaitReturnsSortedListWhenTriggeredInOrder)
         *this, [this] { return m_waiter.timedWait(iox::units::Duration::fromSeconds(1)); });
 }
 
+TEST_F(ConditionVariable_test, NotifyDoesNotPostTheSemaphoreWhileTheListenerIsSpinning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4753dcc-dbac-45fb-9469-67ad06af93dc");
+    m_condVarData.m_isListenerSpinning.store(true);
+    m_notifiers[3U].notify();
+    m_condVarData.m_isListenerSpinning.store(false);
+
+    EXPECT_FALSE(m_condVarData.m_semaphore->tryWait().value());
+    const auto activeNotifications = m_waiter.timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(3U));
+}
+
+TEST_F(ConditionVariable_test, SpinThenBlockWaitReturnsNotificationWhichArrivesWhileSpinning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "edb1d98d-71f1-442e-afb8-da19f3eb7468");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::SPIN_THEN_BLOCK, m_timeToWait});
+    Barrier isThreadStarted(1U);
+    std::thread notifier([&] {
+        isThreadStarted.wait();
+        m_notifiers[5U].notify();
+    });
+
+    isThreadStarted.notify();
+    const auto activeNotifications = sut.wait();
+    notifier.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(5U));
+    EXPECT_FALSE(m_condVarData.m_isListenerSpinning.load());
+}
+
+TEST_F(ConditionVariable_test, SpinThenBlockWaitIsWokenUpByNotificationWhichArrivesAfterSpinning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8127b841-0cab-4668-97bd-ccae7ae66ac0");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::SPIN_THEN_BLOCK, 1_us});
+    std::atomic_bool hasWaited{false};
+    std::thread waiter([&] {
+        const auto activeNotifications = sut.wait();
+        hasWaited = true;
+        ASSERT_THAT(activeNotifications.size(), Eq(1U));
+        EXPECT_THAT(activeNotifications[0U], Eq(9U));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds()));
+    EXPECT_FALSE(hasWaited.load());
+    EXPECT_FALSE(m_condVarData.m_isListenerSpinning.load());
+    m_notifiers[9U].notify();
+    waiter.join();
+    EXPECT_TRUE(hasWaited.load());
+}
+
+TEST_F(ConditionVariable_test, BusyPollWaitReturnsNotificationOfOtherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3609195-c5cb-4fd1-a275-c97154338f08");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::BUSY_POLL, iox::units::Duration::zero()});
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds()));
+        m_notifiers[11U].notify();
+    });
+
+    const auto activeNotifications = sut.wait();
+    notifier.join();
+
+    ASSERT_THAT(activeNotifications.size(), Eq(1U));
+    EXPECT_THAT(activeNotifications[0U], Eq(11U));
+}
+
+TEST_F(ConditionVariable_test, BusyPollTimedWaitWithoutNotificationReturnsEmptyVectorAfterTheTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a67791f9-7561-4f81-87a2-7b828be0c6c8");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::BUSY_POLL, iox::units::Duration::zero()});
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto activeNotifications = sut.timedWait(m_timingTestTime);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(activeNotifications.size(), Eq(0U));
+    EXPECT_THAT(elapsed, Ge(std::chrono::milliseconds(m_timingTestTime.toMilliseconds())));
+    EXPECT_FALSE(m_condVarData.m_isListenerSpinning.load());
+}
+
+TEST_F(ConditionVariable_test, SpinThenBlockTimedWaitWithSpinDurationLongerThanTimeoutReturnsAfterTheTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9af22bc7-b930-4253-9f09-125b677d7100");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::SPIN_THEN_BLOCK, 10_s});
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto activeNotifications = sut.timedWait(m_timingTestTime);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_THAT(activeNotifications.size(), Eq(0U));
+    EXPECT_THAT(elapsed, Ge(std::chrono::milliseconds(m_timingTestTime.toMilliseconds())));
+    EXPECT_THAT(elapsed, Lt(std::chrono::milliseconds(m_timeToWait.toMilliseconds())));
+}
+
+TEST_F(ConditionVariable_test, DestroyWakesUpBusyPollWaitWhichReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce8b225d-432f-47cc-9d17-9721993eccc7");
+    ConditionListener sut(m_condVarData, WaitStrategy{WaitStrategyType::BUSY_POLL, iox::units::Duration::zero()});
+
+    std::thread waiter([&] {
+        const auto activeNotifications = sut.wait();
+        EXPECT_THAT(activeNotifications.size(), Eq(0U));
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(m_timingTestTime.toMilliseconds() / 4));
+    sut.destroy();
+    waiter.join();
+    EXPECT_FALSE(m_condVarData.m_isListenerSpinning.load());
+}
+
 void waitReturnsSortedListWhenTriggeredInReverseOrder(
     ConditionVariable_test& test, const iox::function_ref<ConditionListener::NotificationVector_t()>& wait)
 {
@@ -0,0 +1,118 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_request_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/discovery_requester.hpp"
+#include "test.hpp"
+
+#include <memory>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class DiscoveryRequester_test : public Test
+{
+  public:
+    // the queue is too large for the stack
+    std::unique_ptr<DiscoveryRequestQueueData> m_queueData{new DiscoveryRequestQueueData()};
+    DiscoveryRequester m_sut;
+    const DiscoveryRequest m_request{DiscoveryRequestSource::SUBSCRIBER_PORT, 42U};
+};
+
+TEST_F(DiscoveryRequester_test, RequestingDiscoveryWithoutInitDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a4d0a5c-6a3b-4c61-9d0c-5a8a1c3d4e71");
+    m_sut.requestDiscovery();
+
+    EXPECT_TRUE(m_queueData->m_requests.empty());
+    EXPECT_FALSE(m_queueData->m_conditionVariableData.m_wasNotified.load());
+}
+
+TEST_F(DiscoveryRequester_test, RequestingDiscoveryEnqueuesTheRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f3e5c77-2f61-4b71-a0bb-3f0a1d54c2d8");
+    m_sut.init(*m_queueData, m_request);
+
+    m_sut.requestDiscovery();
+
+    auto request = m_queueData->m_requests.pop();
+    ASSERT_TRUE(request.has_value());
+    EXPECT_THAT(request->source, Eq(m_request.source));
+    EXPECT_THAT(request->index, Eq(m_request.index));
+    EXPECT_TRUE(m_queueData->m_requests.empty());
+}
+
+TEST_F(DiscoveryRequester_test, RequestingDiscoveryNotifiesTheDiscoveryLoop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9b6c1e2-77d4-4a3f-8f2e-6d0c95b1e3a4");
+    m_sut.init(*m_queueData, m_request);
+
+    m_sut.requestDiscovery();
+
+    EXPECT_TRUE(m_queueData->m_conditionVariableData.m_wasNotified.load());
+    EXPECT_TRUE(m_queueData->m_conditionVariableData.isNotificationActive(
+        DiscoveryRequestQueueData::DISCOVERY_REQUEST_NOTIFICATION_INDEX));
+    EXPECT_FALSE(m_queueData->m_conditionVariableData.isNotificationActive(
+        DiscoveryRequestQueueData::DISCOVERY_TRIGGER_NOTIFICATION_INDEX));
+}
+
+TEST_F(DiscoveryRequester_test, RequestingDiscoveryMultipleTimesEnqueuesTheRequestOnlyOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c2f7a18-93e6-4db5-b1a0-8e3f6c7d2b95");
+    m_sut.init(*m_queueData, m_request);
+
+    m_sut.requestDiscovery();
+    m_sut.requestDiscovery();
+    m_sut.requestDiscovery();
+
+    EXPECT_THAT(m_queueData->m_requests.size(), Eq(1U));
+}
+
+TEST_F(DiscoveryRequester_test, RequestingDiscoveryAfterAcknowledgeEnqueuesTheRequestAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e1d8b3f0-5a27-4c9e-9b64-2f7a0c8d1e36");
+    m_sut.init(*m_queueData, m_request);
+
+    m_sut.requestDiscovery();
+    ASSERT_TRUE(m_queueData->m_requests.pop().has_value());
+    m_sut.acknowledge();
+    m_sut.requestDiscovery();
+
+    auto request = m_queueData->m_requests.pop();
+    ASSERT_TRUE(request.has_value());
+    EXPECT_THAT(request->index, Eq(m_request.index));
+}
+
+TEST_F(DiscoveryRequester_test, ReinitializingResetsAPendingRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7b0c4d92-1e5f-4a68-a3c7-d9e2f1b08a54");
+    m_sut.init(*m_queueData, m_request);
+    m_sut.requestDiscovery();
+    ASSERT_TRUE(m_queueData->m_requests.pop().has_value());
+
+    const DiscoveryRequest newRequest{DiscoveryRequestSource::NODE, 13U};
+    m_sut.init(*m_queueData, newRequest);
+    m_sut.requestDiscovery();
+
+    auto request = m_queueData->m_requests.pop();
+    ASSERT_TRUE(request.has_value());
+    EXPECT_THAT(request->source, Eq(DiscoveryRequestSource::NODE));
+    EXPECT_THAT(request->index, Eq(newRequest.index));
+}
+
+} // namespace
@@ -0,0 +1,191 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/latency_histogram.hpp"
+
+#include "test.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+
+class LatencyHistogram_test : public Test
+{
+  public:
+    // the histogram is too large for the stack of some platforms
+    std::unique_ptr<LatencyHistogram> sut{new LatencyHistogram()};
+};
+
+TEST_F(LatencyHistogram_test, SmallValuesHaveTheirOwnBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f6c2a17-94e8-4b0d-a5c1-7e2d8b9f4a06");
+    for (uint64_t value = 0U; value < LatencyHistogram::SUB_BUCKET_COUNT; ++value)
+    {
+        const auto index = LatencyHistogram::bucketIndex(value);
+        EXPECT_THAT(LatencyHistogram::lowerBound(index), Eq(value));
+        EXPECT_THAT(LatencyHistogram::upperBound(index), Eq(value));
+    }
+}
+
+TEST_F(LatencyHistogram_test, BucketsAreContiguousAndContainTheirValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c81d5b3e-2f07-4a96-8e4b-d05a7c1f3e92");
+    for (uint32_t index = 0U; index + 1U < LatencyHistogram::NUMBER_OF_BUCKETS; ++index)
+    {
+        const auto lowerBound = LatencyHistogram::lowerBound(index);
+        const auto upperBound = LatencyHistogram::upperBound(index);
+        ASSERT_THAT(LatencyHistogram::lowerBound(index + 1U), Eq(upperBound + 1U));
+        ASSERT_THAT(LatencyHistogram::bucketIndex(lowerBound), Eq(index));
+        ASSERT_THAT(LatencyHistogram::bucketIndex(upperBound), Eq(index));
+    }
+}
+
+TEST_F(LatencyHistogram_test, BucketWidthIsBoundedRelativeToTheValue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a0e9c64-b1d3-4f28-9736-e4c8a2d15b7f");
+    for (uint32_t index = LatencyHistogram::SUB_BUCKET_COUNT; index < LatencyHistogram::NUMBER_OF_BUCKETS; ++index)
+    {
+        const auto lowerBound = LatencyHistogram::lowerBound(index);
+        const auto width = LatencyHistogram::upperBound(index) - lowerBound + 1U;
+        ASSERT_THAT(width * LatencyHistogram::SUB_BUCKET_COUNT, Le(lowerBound));
+    }
+}
+
+TEST_F(LatencyHistogram_test, ValuesBeyondTheResolvedRangeAreRecordedInTheLastBucket)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e27b4f90-6c1a-4d53-b8e5-93f0d6a2c418");
+    constexpr uint64_t LARGEST_RESOLVED_VALUE{(static_cast<uint64_t>(1U) << LatencyHistogram::MAX_EXPONENT) - 1U};
+
+    EXPECT_THAT(LatencyHistogram::bucketIndex(LARGEST_RESOLVED_VALUE), Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(LARGEST_RESOLVED_VALUE + 1U),
+                Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+    EXPECT_THAT(LatencyHistogram::bucketIndex(std::numeric_limits<uint64_t>::max()),
+                Eq(LatencyHistogram::NUMBER_OF_BUCKETS - 1U));
+}
+
+TEST_F(LatencyHistogram_test, EmptyHistogramHasNoSamples)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b4d1e7a-3c58-4f02-a6d9-1e7b5c0f8a23");
+    EXPECT_THAT(sut->sampleCount(), Eq(0U));
+    EXPECT_THAT(sut->maximum(), Eq(0U));
+    EXPECT_THAT(sut->valueAtPercentile(50.0), Eq(0U));
+}
+
+TEST_F(LatencyHistogram_test, PercentilesAreTheUpperBoundsOfTheBucketsContainingThem)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c7f3a95-d2e4-4b68-8f1a-6b9e0c4d7253");
+    constexpr uint64_t NUMBER_OF_SAMPLES{1000U};
+    for (uint64_t i = 1U; i <= NUMBER_OF_SAMPLES; ++i)
+    {
+        sut->record(i * 1000U);
+    }
+
+    EXPECT_THAT(sut->sampleCount(), Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(sut->maximum(), Eq(NUMBER_OF_SAMPLES * 1000U));
+    for (const double percentile : {1.0, 50.0, 90.0, 99.0})
+    {
+        const auto exactValue = static_cast<uint64_t>(percentile * 10.0) * 1000U;
+        const auto upperBound = LatencyHistogram::upperBound(LatencyHistogram::bucketIndex(exactValue));
+        EXPECT_THAT(sut->valueAtPercentile(percentile), Eq(std::min(upperBound, sut->maximum())));
+    }
+}
+
+TEST_F(LatencyHistogram_test, PercentilesDoNotExceedTheMaximum)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7e2a9d03-51b6-4c8f-b0e7-2d4f6a8c1b95");
+    constexpr uint64_t VALUE{1000U};
+    sut->record(VALUE);
+
+    EXPECT_THAT(sut->valueAtPercentile(0.0), Eq(VALUE));
+    EXPECT_THAT(sut->valueAtPercentile(50.0), Eq(VALUE));
+    EXPECT_THAT(sut->valueAtPercentile(100.0), Eq(VALUE));
+    EXPECT_THAT(sut->valueAtPercentile(200.0), Eq(VALUE));
+}
+
+TEST_F(LatencyHistogram_test, ConcurrentlyRecordedSamplesAreNotLost)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5f80c2d-7a19-4e36-9d4b-c3e1f7a06d28");
+    constexpr uint64_t NUMBER_OF_THREADS{4U};
+    constexpr uint64_t SAMPLES_PER_THREAD{10000U};
+
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0U; t < NUMBER_OF_THREADS; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (uint64_t i = 0U; i < SAMPLES_PER_THREAD; ++i)
+            {
+                sut->record(t * SAMPLES_PER_THREAD + i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_THAT(sut->sampleCount(), Eq(NUMBER_OF_THREADS * SAMPLES_PER_THREAD));
+    EXPECT_THAT(sut->maximum(), Eq(NUMBER_OF_THREADS * SAMPLES_PER_THREAD - 1U));
+    EXPECT_THAT(sut->valueAtPercentile(100.0), Eq(sut->maximum()));
+}
+
+TEST_F(LatencyHistogram_test, RecordingTheStagesOfAChunkFillsTheHistogramsOfTheStages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4d9a6e1b-c8f3-4072-a5e9-0b7d2c3f6e81");
+    iox::mepoo::ChunkTimestamps timestamps;
+    std::unique_ptr<ChunkSenderLatencyHistograms> senderHistograms{new ChunkSenderLatencyHistograms()};
+    std::unique_ptr<ChunkReceiverLatencyHistograms> receiverHistograms{new ChunkReceiverLatencyHistograms()};
+
+    const auto timeBeforeLoan = latencyTimestamp();
+    recordLoan(timestamps);
+    recordPublish(timestamps, *senderHistograms);
+    recordDelivery(timestamps, *senderHistograms);
+    recordTake(timestamps, *receiverHistograms);
+    const auto timeAfterTake = latencyTimestamp();
+
+    EXPECT_THAT(timestamps.loan, Ge(timeBeforeLoan));
+    EXPECT_THAT(timestamps.publish, Ge(timestamps.loan));
+    EXPECT_THAT(timestamps.publish, Le(timeAfterTake));
+    EXPECT_THAT(senderHistograms->loanToPublish.sampleCount(), Eq(1U));
+    EXPECT_THAT(senderHistograms->publishToDelivery.sampleCount(), Eq(1U));
+    EXPECT_THAT(receiverHistograms->publishToTake.sampleCount(), Eq(1U));
+    EXPECT_THAT(receiverHistograms->publishToTake.maximum(), Le(timeAfterTake - timeBeforeLoan));
+}
+
+TEST_F(LatencyHistogram_test, DisabledInstrumentationDoesNotIncreaseTheChunkManagement)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8c3e5f7-0d2b-4196-8e4a-f6b1d9c27e30");
+    if (iox::build::IOX_LATENCY_INSTRUMENTATION)
+    {
+        GTEST_SKIP() << "This test requires the latency instrumentation to be disabled";
+    }
+
+    struct ChunkManagementWithoutTimestamps
+    {
+        iox::RelativePointer<iox::mepoo::ChunkHeader> chunkHeader;
+        iox::mepoo::ChunkManagement::referenceCounter_t referenceCounter;
+        iox::RelativePointer<iox::mepoo::MemPool> mempool;
+        iox::RelativePointer<iox::mepoo::MemPool> chunkManagementPool;
+    };
+    EXPECT_THAT(sizeof(iox::mepoo::ChunkManagement), Eq(sizeof(ChunkManagementWithoutTimestamps)));
+}
+
+} // namespace
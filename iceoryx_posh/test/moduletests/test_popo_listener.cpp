@@ -134,8 +134,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const WaitStrategy& waitStrategy = WaitStrategy()) noexcept
+        : Listener(data, waitStrategy)
     {
     }
 };
@@ -669,6 +669,23 @@ TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotify, Repeat(5), [&] {
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
 })
 
+TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotifyWithSpinThenBlockWaitStrategy, Repeat(5), [&] {
+    ::testing::Test::RecordProperty("TEST_ID", "c1905771-8c83-4b9e-b932-244dee7505ab");
+    m_sut.emplace(m_condVarData, WaitStrategy{WaitStrategyType::SPIN_THEN_BLOCK, 1_ms});
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    fuu.triggerStoepsel();
+    std::this_thread::sleep_for(std::chrono::milliseconds(CALLBACK_WAIT_IN_MS));
+
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &fuu);
+    TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
+})
+
 TIMING_TEST_F(Listener_test, CallbackWithEventAndUserTypeIsCalledAfterNotify, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "6df97139-8c2e-42b1-bd9a-8770c295bf2e");
     m_sut.emplace(m_condVarData);
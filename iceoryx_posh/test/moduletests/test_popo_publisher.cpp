@@ -42,6 +42,7 @@ struct DummyData
 };
 
 using TestPublisher = iox::popo::PublisherImpl<DummyData, iox::mepoo::NoUserHeader, MockBasePublisher<DummyData>>;
+using AllocationResult = iox::expected<void, iox::popo::AllocationError>;
 
 class PublisherTest : public Test
 {
@@ -274,6 +275,83 @@ TEST_F(PublisherTest, PublishingSendsUnderlyingMemoryChunkOnPublisherPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(PublisherTest, LoanBatchConstructsAllSamplesWithProvidedArguments)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "14eb116b-9ec6-4771-ab5a-f668faab7b7f");
+    ChunkMock<DummyData> secondChunkMock;
+    constexpr uint64_t CUSTOM_VALUE{73U};
+    EXPECT_CALL(portMock, tryAllocateChunkBatch(sizeof(DummyData), _, _, _, _))
+        .WillOnce(Invoke([&](auto, auto, auto, auto, auto chunkHeaders) -> AllocationResult {
+            EXPECT_EQ(chunkHeaders.size(), 2U);
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::ok();
+        }));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U, CUSTOM_VALUE);
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    ASSERT_EQ(result.value().size(), 2U);
+    EXPECT_EQ(chunkMock.chunkHeader(), result.value()[0].getChunkHeader());
+    EXPECT_EQ(secondChunkMock.chunkHeader(), result.value()[1].getChunkHeader());
+    EXPECT_EQ(result.value()[0]->val, CUSTOM_VALUE);
+    EXPECT_EQ(result.value()[1]->val, CUSTOM_VALUE);
+    // ===== Cleanup ===== //
+    EXPECT_CALL(portMock, releaseChunk(chunkMock.chunkHeader()));
+    EXPECT_CALL(portMock, releaseChunk(secondChunkMock.chunkHeader()));
+}
+
+TEST_F(PublisherTest, LoanBatchFailsAndForwardsAllocationErrorsToCaller)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c1e4c16-ce79-4edc-9de3-05784b9c5f26");
+    EXPECT_CALL(portMock, tryAllocateChunkBatch(sizeof(DummyData), _, _, _, _))
+        .WillOnce(Return(ByMove(iox::err(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS))));
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::RUNNING_OUT_OF_CHUNKS, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, LoanBatchWithMoreSamplesThanAllocatableInParallelFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4984e66-e801-4851-bead-9ce9e13e7b05");
+    EXPECT_CALL(portMock, tryAllocateChunkBatch(_, _, _, _, _)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY + 1U);
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL, result.error());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(PublisherTest, PublishBatchSendsAllUnderlyingMemoryChunksWithOneCallOnPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "164b8c2e-17e5-4810-8d18-58bb00812db4");
+    ChunkMock<DummyData> secondChunkMock;
+    EXPECT_CALL(portMock, tryAllocateChunkBatch(sizeof(DummyData), _, _, _, _))
+        .WillOnce(Invoke([&](auto, auto, auto, auto, auto chunkHeaders) -> AllocationResult {
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = secondChunkMock.chunkHeader();
+            return iox::ok();
+        }));
+    EXPECT_CALL(portMock, sendChunkBatch(_)).WillOnce(Invoke([&](auto chunkHeaders) {
+        ASSERT_EQ(chunkHeaders.size(), 2U);
+        EXPECT_EQ(chunkHeaders[0], chunkMock.chunkHeader());
+        EXPECT_EQ(chunkHeaders[1], secondChunkMock.chunkHeader());
+    }));
+    EXPECT_CALL(portMock, releaseChunk(_)).Times(0);
+    // ===== Test ===== //
+    auto result = sut.loanBatch(2U);
+    ASSERT_FALSE(result.has_error());
+    sut.publishBatch(iox::span<iox::popo::Sample<DummyData>>(result.value()));
+    // ===== Verify ===== //
+    EXPECT_FALSE(result.value()[0]);
+    EXPECT_FALSE(result.value()[1]);
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(PublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
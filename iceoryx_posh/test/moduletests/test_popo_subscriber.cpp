@@ -149,10 +149,10 @@ TEST_F(SubscriberTest, TakeReturnsAllocatedMemoryChunksWrappedInSample)
 {
     ::testing::Test::RecordProperty("TEST_ID", "57507fcd-c7db-4b78-9e75-17c28c6ae5d7");
     // ===== Setup ===== //
-    EXPECT_CALL(sut, takeChunk)
+    EXPECT_CALL(sut, takeChunk(_))
         .Times(1)
         .WillOnce(Return(ByMove(iox::ok(const_cast<const iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader())))));
-    EXPECT_CALL(sut.port(), releaseChunk).Times(AtLeast(1));
+    EXPECT_CALL(sut.port(), releaseChunk(_, _)).Times(AtLeast(1));
     // ===== Test ===== //
     auto maybeSample = sut.take();
     // ===== Verify ===== //
@@ -165,10 +165,10 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f32c401d-0620-4a4b-800f-eda94a493efd");
     // ===== Setup ===== //
-    EXPECT_CALL(sut, takeChunk)
+    EXPECT_CALL(sut, takeChunk(_))
         .Times(1)
         .WillOnce(Return(ByMove(iox::ok(const_cast<const iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader())))));
-    EXPECT_CALL(sut.port(), releaseChunk).Times(AtLeast(1));
+    EXPECT_CALL(sut.port(), releaseChunk(_, _)).Times(AtLeast(1));
     // ===== Test ===== //
     {
         EXPECT_FALSE(sut.take().has_error());
@@ -177,6 +177,61 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeBatchCallsCallableForEachSampleAndReleasesAllSamplesAtOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65dafd9a-3b19-430e-b74e-378904e35332");
+    // ===== Setup ===== //
+    ChunkMock<DummyData> secondChunkMock;
+    chunkMock.sample()->val = 37U;
+    secondChunkMock.sample()->val = 73U;
+    EXPECT_CALL(sut, takeChunkBatch)
+        .Times(1)
+        .WillOnce(
+            Invoke([&](auto chunkHeaders, auto slotIndices) -> iox::expected<uint64_t, iox::popo::ChunkReceiveResult> {
+                EXPECT_THAT(chunkHeaders.size(), Eq(3U));
+                EXPECT_THAT(slotIndices.size(), Eq(3U));
+                chunkHeaders[0] = chunkMock.chunkHeader();
+                chunkHeaders[1] = secondChunkMock.chunkHeader();
+                slotIndices[0] = 7U;
+                slotIndices[1] = 3U;
+                return iox::ok<uint64_t>(2U);
+            }));
+    EXPECT_CALL(sut.port(), releaseChunkBatch).WillOnce(Invoke([&](auto chunkHeaders, auto slotIndices) {
+        ASSERT_THAT(chunkHeaders.size(), Eq(2U));
+        ASSERT_THAT(slotIndices.size(), Eq(2U));
+        EXPECT_EQ(chunkHeaders[0], chunkMock.chunkHeader());
+        EXPECT_EQ(chunkHeaders[1], secondChunkMock.chunkHeader());
+        EXPECT_THAT(slotIndices[0], Eq(7U));
+        EXPECT_THAT(slotIndices[1], Eq(3U));
+    }));
+    EXPECT_CALL(sut.port(), releaseChunk(_)).Times(0);
+    EXPECT_CALL(sut.port(), releaseChunk(_, _)).Times(0);
+    // ===== Test ===== //
+    std::vector<uint64_t> values;
+    auto result = sut.takeBatch(3U, [&](const DummyData& data) { values.push_back(data.val); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(2U));
+    EXPECT_THAT(values, ElementsAre(37U, 73U));
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBatchForwardsErrorsToCaller)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4af4caec-1816-4d67-9b0c-614623b04cc9");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunkBatch)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::err(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE))));
+    EXPECT_CALL(sut.port(), releaseChunkBatch).Times(0);
+    // ===== Test ===== //
+    auto result = sut.takeBatch(3U, [](const DummyData&) { GTEST_FAIL() << "No sample expected"; });
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f30fe1ae-046c-48b3-b5cd-b9adbf9b864f");
@@ -146,10 +146,10 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "e80e82f8-d573-407d-9640-b148d8679ed4");
     // ===== Setup ===== //
-    EXPECT_CALL(sut, takeChunk)
+    EXPECT_CALL(sut, takeChunk())
         .Times(1)
         .WillOnce(Return(ByMove(iox::ok(const_cast<const iox::mepoo::ChunkHeader*>(chunkMock.chunkHeader())))));
-    EXPECT_CALL(sut.port(), releaseChunk).Times(AtLeast(1));
+    EXPECT_CALL(sut.port(), releaseChunk(_)).Times(AtLeast(1));
     // ===== Test ===== //
     auto maybeChunk = sut.take();
     // ===== Verify ===== //
@@ -22,6 +22,8 @@
 
 #include "test.hpp"
 
+#include <algorithm>
+
 namespace
 {
 using namespace ::testing;
@@ -123,6 +125,38 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, MultipleChunksCanBeAddedAtOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30c6489f-d18e-4160-929a-0b5aae3deb6f");
+    std::vector<SharedChunk> chunks;
+    createMultipleChunks(3U, [&](SharedChunk&& chunk) { chunks.emplace_back(chunk); });
+
+    std::vector<uint32_t> slots(chunks.size());
+    EXPECT_TRUE(sut.insert(iox::span<const SharedChunk>(chunks.data(), chunks.size()),
+                           iox::span<uint32_t>(slots.data(), slots.size())));
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY - 3U));
+
+    for (uint64_t i = 0U; i < chunks.size(); ++i)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(slots[i], chunks[i].getChunkHeader(), removedChunk));
+    }
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY));
+}
+
+TEST_F(UsedChunkList_test, AddMoreChunksAtOnceThanFreeSlotsAddsNoChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "42eea3ec-1a60-447d-905b-70c714f07ec1");
+    EXPECT_TRUE(sut.insert(getChunkFromMemoryManager()));
+    std::vector<SharedChunk> chunks;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) { chunks.emplace_back(chunk); });
+
+    std::vector<uint32_t> slots(chunks.size());
+    EXPECT_FALSE(sut.insert(iox::span<const SharedChunk>(chunks.data(), chunks.size()),
+                            iox::span<uint32_t>(slots.data(), slots.size())));
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY - 1U));
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
@@ -318,4 +352,167 @@ TEST_F(UsedChunkList_test, CallingCleanupReleasesAllChunks)
     EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
     checkIfEmpty();
 }
+
+TEST_F(UsedChunkList_test, InsertReturnsDifferentSlotsForEachChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c29a4576-4b13-46e6-b04c-024979759389");
+    std::vector<uint32_t> slots;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+        auto slot = sut.insert(chunk);
+        ASSERT_TRUE(slot.has_value());
+        EXPECT_THAT(slot.value(), Lt(USED_CHUNK_LIST_CAPACITY));
+        slots.push_back(slot.value());
+    });
+
+    std::sort(slots.begin(), slots.end());
+    EXPECT_THAT(std::unique(slots.begin(), slots.end()), Eq(slots.end()));
+}
+
+TEST_F(UsedChunkList_test, MultipleChunksCanBeRemovedInArbitraryOrderWithTheirSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a76d729-9c04-46cf-bfc2-19e93a5443cf");
+    std::vector<std::pair<ChunkHeader*, uint32_t>> chunksInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+        auto slot = sut.insert(chunk);
+        ASSERT_TRUE(slot.has_value());
+        chunksInUse.emplace_back(chunk.getChunkHeader(), slot.value());
+    });
+
+    for (auto index : {0U, 5U, 3U, 9U, 1U, 8U, 7U, 2U, 4U, 6U})
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sut.remove(chunksInUse[index].second, chunksInUse[index].first, removedChunk));
+        EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunksInUse[index].first));
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    checkIfEmpty();
+}
+
+TEST_F(UsedChunkList_test, RemovedSlotIsReusedByTheNextInsert)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8818a5d-f3ca-40cc-a6b6-138aec18cbc2");
+    createMultipleChunks(3U, [&](SharedChunk&& chunk) { ASSERT_TRUE(sut.insert(chunk).has_value()); });
+    auto chunk = getChunkFromMemoryManager();
+    auto slot = sut.insert(chunk);
+    ASSERT_TRUE(slot.has_value());
+
+    SharedChunk removedChunk;
+    ASSERT_TRUE(sut.remove(slot.value(), chunk.getChunkHeader(), removedChunk));
+
+    auto newSlot = sut.insert(getChunkFromMemoryManager());
+    ASSERT_TRUE(newSlot.has_value());
+    EXPECT_THAT(newSlot.value(), Eq(slot.value()));
+}
+
+TEST_F(UsedChunkList_test, RemoveWithSlotOfOtherChunkFailsAndDoesNotRemoveAnyChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e761f707-3fba-4ab5-8b75-42017fa2a9f7");
+    auto chunk = getChunkFromMemoryManager();
+    auto otherChunk = getChunkFromMemoryManager();
+    ASSERT_TRUE(sut.insert(chunk).has_value());
+    auto otherSlot = sut.insert(otherChunk);
+    ASSERT_TRUE(otherSlot.has_value());
+
+    SharedChunk removedChunk;
+    EXPECT_FALSE(sut.remove(otherSlot.value(), chunk.getChunkHeader(), removedChunk));
+    EXPECT_FALSE(removedChunk);
+
+    EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+    EXPECT_TRUE(sut.remove(otherSlot.value(), otherChunk.getChunkHeader(), removedChunk));
+}
+
+TEST_F(UsedChunkList_test, RemoveSameChunkTwiceWithItsSlotFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8cef41f8-8462-486b-8ef9-3e400faf77e9");
+    auto chunk = getChunkFromMemoryManager();
+    auto slot = sut.insert(chunk);
+    ASSERT_TRUE(slot.has_value());
+
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(slot.value(), chunk.getChunkHeader(), removedChunk));
+    EXPECT_FALSE(sut.remove(slot.value(), chunk.getChunkHeader(), removedChunk));
+}
+
+TEST_F(UsedChunkList_test, RemoveWithSlotOutOfRangeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8da71af6-2f51-4e9c-ad98-24508239ad75");
+    auto chunk = getChunkFromMemoryManager();
+    ASSERT_TRUE(sut.insert(chunk).has_value());
+
+    SharedChunk removedChunk;
+    EXPECT_FALSE(sut.remove(USED_CHUNK_LIST_CAPACITY, chunk.getChunkHeader(), removedChunk));
+    EXPECT_TRUE(sut.remove(chunk.getChunkHeader(), removedChunk));
+}
+
+TEST_F(UsedChunkList_test, MultipleChunksCanBeRemovedAtOnceWithTheirSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d4668bf-8028-456d-8388-c8f0b594117d");
+    std::vector<SharedChunk> chunks;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) { chunks.emplace_back(chunk); });
+    std::vector<uint32_t> slots(chunks.size());
+    ASSERT_TRUE(sut.insert(iox::span<const SharedChunk>(chunks.data(), chunks.size()),
+                           iox::span<uint32_t>(slots.data(), slots.size())));
+    std::vector<const ChunkHeader*> chunkHeaders;
+    for (auto& chunk : chunks)
+    {
+        chunkHeaders.push_back(chunk.getChunkHeader());
+    }
+    chunks.clear();
+
+    EXPECT_TRUE(sut.remove(iox::span<const uint32_t>(slots.data(), slots.size()),
+                           iox::span<const ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size())));
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    checkIfEmpty();
+}
+
+TEST_F(UsedChunkList_test, RemoveAtOnceWithSlotOfOtherChunkFailsButRemovesTheRemainingChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "418ddc67-fdf3-4d2c-b453-4d75314e5365");
+    auto chunk = getChunkFromMemoryManager();
+    auto otherChunk = getChunkFromMemoryManager();
+    auto slot = sut.insert(chunk);
+    ASSERT_TRUE(slot.has_value());
+    auto otherSlot = sut.insert(otherChunk);
+    ASSERT_TRUE(otherSlot.has_value());
+
+    const uint32_t slots[]{otherSlot.value(), otherSlot.value()};
+    const ChunkHeader* const chunkHeaders[]{chunk.getChunkHeader(), otherChunk.getChunkHeader()};
+    EXPECT_FALSE(sut.remove(iox::span<const uint32_t>(slots), iox::span<const ChunkHeader* const>(chunkHeaders)));
+
+    EXPECT_THAT(sut.freeSlots(), Eq(USED_CHUNK_LIST_CAPACITY - 1U));
+    SharedChunk removedChunk;
+    EXPECT_TRUE(sut.remove(slot.value(), chunk.getChunkHeader(), removedChunk));
+}
+
+TEST_F(UsedChunkList_test, ChunksCanBeRemovedAlternatelyWithTheirSlotsAndByTheirChunkHeaders)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "77db90ec-1349-4b86-9de9-2a09c2edd367");
+    std::vector<std::pair<ChunkHeader*, uint32_t>> chunksInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+        auto slot = sut.insert(chunk);
+        ASSERT_TRUE(slot.has_value());
+        chunksInUse.emplace_back(chunk.getChunkHeader(), slot.value());
+    });
+
+    bool isRemovedWithSlot{true};
+    for (auto index : {4U, 9U, 0U, 5U, 3U, 8U, 1U, 6U, 2U, 7U})
+    {
+        SharedChunk removedChunk;
+        if (isRemovedWithSlot)
+        {
+            EXPECT_TRUE(sut.remove(chunksInUse[index].second, chunksInUse[index].first, removedChunk));
+        }
+        else
+        {
+            EXPECT_TRUE(sut.remove(chunksInUse[index].first, removedChunk));
+        }
+        EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunksInUse[index].first));
+        isRemovedWithSlot = !isRemovedWithSlot;
+    }
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    checkIfEmpty();
+}
 } // namespace
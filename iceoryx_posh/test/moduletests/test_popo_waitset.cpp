@@ -266,8 +266,9 @@ TEST_F(WaitSetHelper_test, MergeWithOverlappingOneElementNotificationVector)
 class WaitSetTest : public iox::popo::WaitSet<>
 {
   public:
-    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
-        : WaitSet(condVarData)
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData,
+                const iox::popo::WaitStrategy& waitStrategy = iox::popo::WaitStrategy()) noexcept
+        : WaitSet(condVarData, waitStrategy)
     {
     }
 };
@@ -1161,6 +1162,28 @@ TEST_F(WaitSet_test, WaitBlocksWhenNothingTriggered)
     t.join();
 }
 
+TEST_F(WaitSet_test, SpinningWaitReturnsEventWhichIsTriggeredByAnotherThread)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "34d0c34b-82ff-4924-9498-3e624f09f59b");
+    for (const auto waitStrategyType : {WaitStrategyType::SPIN_THEN_BLOCK, WaitStrategyType::BUSY_POLL})
+    {
+        ConditionVariableData condVarData{"Spinnhorscht"};
+        WaitSetTest sut(condVarData, WaitStrategy{waitStrategyType, 1_ms});
+        ASSERT_FALSE(sut.attachEvent(m_simpleEvents[0], 42U).has_error());
+
+        std::thread t([&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            m_simpleEvents[0].trigger();
+        });
+
+        auto triggerVector = sut.wait();
+        t.join();
+        ASSERT_THAT(triggerVector.size(), Eq(1U));
+        EXPECT_THAT(triggerVector[0U]->getNotificationId(), Eq(42U));
+        sut.detachEvent(m_simpleEvents[0]);
+    }
+}
+
 TEST_F(WaitSet_test, TimedWaitReturnsNothingWhenNothingTriggered)
 {
     ::testing::Test::RecordProperty("TEST_ID", "bf1a8c00-e9c9-43e1-813e-64fd12d4e055");
@@ -379,9 +379,13 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     iox::vector<iox::capro::ServiceDescription, iox::NUMBER_OF_INTERNAL_PUBLISHERS> internalServices;
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
+    const iox::capro::ServiceDescription serviceRegistryChanges{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                                iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                                iox::SERVICE_DISCOVERY_CHANGES_EVENT_NAME};
 
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryChanges);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -891,6 +895,125 @@ TEST_F(PoshRuntime_test, GetMiddlewareConditionVariableListOverflow)
     EXPECT_TRUE(conditionVariableListOverflowDetected);
 }
 
+TEST_F(PoshRuntime_test, GetMiddlewarePortsCreatesAllKindsOfPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "25c97b74-70c8-4921-9800-c45c26fa6556");
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 7U;
+    publisherOptions.nodeName = m_nodeName;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 13U;
+    iox::popo::ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = 4U;
+    clientOptions.nodeName = m_nodeName;
+    iox::popo::ServerOptions serverOptions;
+    serverOptions.requestQueueCapacity = 5U;
+    serverOptions.nodeName = m_nodeName;
+
+    PoshRuntime::PortRequests_t requests;
+    requests.emplace_back(ServiceDescription("Batch", "Publisher", "Event"), publisherOptions);
+    requests.emplace_back(ServiceDescription("Batch", "Subscriber", "Event"), subscriberOptions);
+    requests.emplace_back(ServiceDescription("Batch", "Client", "Event"), clientOptions, PortConfigInfo(11U, 22U, 33U));
+    requests.emplace_back(ServiceDescription("Batch", "Server", "Event"), serverOptions, PortConfigInfo(11U, 22U, 33U));
+
+    auto responses = m_runtime->getMiddlewarePorts(requests);
+
+    ASSERT_THAT(responses.size(), Eq(4U));
+    for (uint64_t i = 0U; i < responses.size(); ++i)
+    {
+        ASSERT_FALSE(responses[i].has_error());
+        EXPECT_THAT(responses[i].value().index(), Eq(i));
+    }
+
+    const auto publisherPort = *responses[0].value().get<PublisherPortUserType::MemberType_t*>();
+    ASSERT_THAT(publisherPort, Ne(nullptr));
+    EXPECT_EQ(publisherPort->m_serviceDescription, ServiceDescription("Batch", "Publisher", "Event"));
+    EXPECT_EQ(publisherPort->m_chunkSenderData.m_historyCapacity, publisherOptions.historyCapacity);
+
+    const auto subscriberPort = *responses[1].value().get<SubscriberPortUserType::MemberType_t*>();
+    ASSERT_THAT(subscriberPort, Ne(nullptr));
+    EXPECT_EQ(subscriberPort->m_serviceDescription, ServiceDescription("Batch", "Subscriber", "Event"));
+    EXPECT_EQ(subscriberPort->m_chunkReceiverData.m_queue.capacity(), subscriberOptions.queueCapacity);
+
+    checkClientInitialization(*responses[2].value().get<ClientPortUser::MemberType_t*>(),
+                              ServiceDescription("Batch", "Client", "Event"),
+                              clientOptions,
+                              PortConfigInfo(11U, 22U, 33U).memoryInfo);
+    checkServerInitialization(*responses[3].value().get<ServerPortUser::MemberType_t*>(),
+                              ServiceDescription("Batch", "Server", "Event"),
+                              serverOptions,
+                              PortConfigInfo(11U, 22U, 33U).memoryInfo);
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsLimitsOptionsLikeTheSingleRequests)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bdd32746-6fdd-4382-99af-0813f0cea9b5");
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = iox::MAX_PUBLISHER_HISTORY + 1U;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 0U;
+
+    PoshRuntime::PortRequests_t requests;
+    requests.emplace_back(ServiceDescription("Batch", "Publisher", "Event"), publisherOptions);
+    requests.emplace_back(ServiceDescription("Batch", "Subscriber", "Event"), subscriberOptions);
+
+    auto responses = m_runtime->getMiddlewarePorts(requests);
+
+    ASSERT_THAT(responses.size(), Eq(2U));
+    ASSERT_FALSE(responses[0].has_error());
+    ASSERT_FALSE(responses[1].has_error());
+    EXPECT_EQ((*responses[0].value().get<PublisherPortUserType::MemberType_t*>())->m_chunkSenderData.m_historyCapacity,
+              iox::MAX_PUBLISHER_HISTORY);
+    EXPECT_EQ(
+        (*responses[1].value().get<SubscriberPortUserType::MemberType_t*>())->m_chunkReceiverData.m_queue.capacity(),
+        1U);
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsWithMorePortsThanFitIntoOneMessageCreatesAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d676179-1da7-4a83-a71b-b168ac56df29");
+    // long service descriptions ensure that the request needs several IPC messages
+    const std::string longName(iox::capro::IdString_t::capacity() - 3U, 'x');
+
+    PoshRuntime::PortRequests_t requests;
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_PORTS_PER_REQUEST; ++i)
+    {
+        const auto instance = into<lossy<iox::capro::IdString_t>>(longName + convert::toString(i));
+        requests.emplace_back(ServiceDescription("Batch", instance, "Event"), iox::popo::PublisherOptions());
+    }
+
+    auto responses = m_runtime->getMiddlewarePorts(requests);
+
+    ASSERT_THAT(responses.size(), Eq(requests.size()));
+    for (uint64_t i = 0U; i < responses.size(); ++i)
+    {
+        ASSERT_FALSE(responses[i].has_error());
+        const auto publisherPort = *responses[i].value().get<PublisherPortUserType::MemberType_t*>();
+        ASSERT_THAT(publisherPort, Ne(nullptr));
+        EXPECT_EQ(publisherPort->m_serviceDescription, requests[i].service);
+    }
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsWithInvalidRequestFailsOnlyForThisPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f2dc238-78f1-44b7-b0d3-0003243d508c");
+    iox::popo::ClientOptions clientOptions;
+    clientOptions.nodeName = m_invalidNodeName;
+
+    PoshRuntime::PortRequests_t requests;
+    requests.emplace_back(ServiceDescription("Batch", "Publisher", "Event"), iox::popo::PublisherOptions());
+    requests.emplace_back(ServiceDescription("Batch", "Client", "Event"), clientOptions);
+    requests.emplace_back(ServiceDescription("Batch", "Server", "Event"), iox::popo::ServerOptions());
+
+    auto responses = m_runtime->getMiddlewarePorts(requests);
+
+    ASSERT_THAT(responses.size(), Eq(3U));
+    EXPECT_FALSE(responses[0].has_error());
+    ASSERT_TRUE(responses[1].has_error());
+    EXPECT_THAT(responses[1].error(), Eq(IpcMessageErrorType::REQUEST_CLIENT_INVALID_RESPONSE));
+    EXPECT_FALSE(responses[2].has_error());
+}
+
 TEST_F(PoshRuntime_test, CreateNodeReturnValue)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9f56126d-6920-491f-ba6b-d8e543a15c6a");
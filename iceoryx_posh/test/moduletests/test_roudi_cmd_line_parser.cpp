@@ -406,6 +406,84 @@ TEST_F(CmdLineParser_test, TerminationDelayOptionOutOfBoundsLeadsToProgrammNotRu
     EXPECT_FALSE(result.value().run);
 }
 
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersLongOptionLeadsToCorrectNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a6c30652-a723-4078-9e95-6805697ad0af");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char value[] = "4";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().runtimeMessageWorkers, 4U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersShortOptionLeadsToCorrectNumberOfWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7afc19ef-039f-4107-bbbf-b077e25aee95");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-w";
+    char value[] = "2";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value().runtimeMessageWorkers, 2U);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, ZeroRuntimeMessageWorkersLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f9bb4deb-f7e2-4d95-b60b-cf41291b7ee3");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char value[] = "0";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, RuntimeMessageWorkersOptionOutOfBoundsLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e54c4049-b9b6-4584-956d-0b4671572348");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--runtime-message-workers";
+    char value[] = "17"; // MAX_NUMBER_OF_RUNTIME_MESSAGE_WORKERS + 1
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().run);
+}
+
 TEST_F(CmdLineParser_test, CompatibilityLevelOptionsLeadToCorrectCompatibilityLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "62b7d5c9-0638-4314-b4f7-c622ef101045");
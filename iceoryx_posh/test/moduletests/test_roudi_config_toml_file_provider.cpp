@@ -103,6 +103,68 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
 #endif
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, PageOptionsOfSegmentsAreParsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4b9e2f7-1a3d-4e58-b6c0-9d2f7e8a5b13");
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        transparent-huge-pages = true
+        prefault = true
+        lock-memory = true
+        numa-node = 1
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result->m_sharedMemorySegments.size(), Eq(2U));
+    const auto& configuredPageOptions = result->m_sharedMemorySegments[0].m_pageOptions;
+    EXPECT_TRUE(configuredPageOptions.transparentHugePages);
+    EXPECT_TRUE(configuredPageOptions.prefault);
+    EXPECT_TRUE(configuredPageOptions.lockInMemory);
+    ASSERT_TRUE(configuredPageOptions.numaNode.has_value());
+    EXPECT_THAT(configuredPageOptions.numaNode.value(), Eq(1U));
+    const auto& defaultPageOptions = result->m_sharedMemorySegments[1].m_pageOptions;
+    EXPECT_FALSE(defaultPageOptions.transparentHugePages);
+    EXPECT_FALSE(defaultPageOptions.prefault);
+    EXPECT_FALSE(defaultPageOptions.lockInMemory);
+    EXPECT_FALSE(defaultPageOptions.numaNode.has_value());
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ZeroingOptionsOfTheSharedMemoryAreParsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f3d7a52-8c1e-4b96-a2d4-6e9b5c8f1a37");
+    std::istringstream stream(R"([general]
+        version = 1
+        zero-shm-on-creation = false
+        shm-zeroing-threads = 4
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result->m_zeroingOptions.zeroOnCreation);
+    EXPECT_THAT(result->m_zeroingOptions.numberOfThreads, Eq(4U));
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -35,6 +35,7 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
 {
   public:
     using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendPortData;
+    using iox::roudi::PortIntrospection<PublisherPort, SubscriberPort>::sendLatencyData;
 
     void sendThroughputData()
     {
@@ -48,6 +49,10 @@ class PortIntrospectionAccess : public iox::roudi::PortIntrospection<PublisherPo
     {
         return this->m_publisherPortThroughput;
     }
+    iox::optional<PublisherPort>& getPublisherPortLatency()
+    {
+        return this->m_publisherPortLatency;
+    }
 };
 
 class PortIntrospection_test : public Test
@@ -155,6 +160,41 @@ TEST_F(PortIntrospection_test, registerPublisherPort)
                 Eq(false));
 }
 
+TEST_F(PortIntrospection_test, registerLatencyPublisherPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b3e0d92-4f7a-4c15-a8d6-e9c2b1f05a74");
+    auto introspection = std::unique_ptr<iox::roudi::PortIntrospection<MockPublisherPortUser, MockSubscriberPortUser>>(
+        new iox::roudi::PortIntrospection<MockPublisherPortUser, MockSubscriberPortUser>);
+
+    EXPECT_THAT(introspection->registerLatencyPublisherPort(std::move(m_mockPublisherPortUserIntrospection)), Eq(true));
+    EXPECT_THAT(introspection->registerLatencyPublisherPort(std::move(m_mockPublisherPortUserIntrospection2)),
+                Eq(false));
+}
+
+TEST_F(PortIntrospection_test, sendLatencyData_EmptyList)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d04f7b1c-95e2-4a83-b6f0-3c8e2a7d519b");
+    using Topic = iox::roudi::PortLatencyIntrospectionFieldTopic;
+
+    ASSERT_THAT(m_introspectionAccess.registerLatencyPublisherPort(std::move(m_mockPublisherPortUserIntrospection2)),
+                Eq(true));
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+    bool chunkWasSent = false;
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortLatency().value(), tryAllocateChunk(_, _, _, _))
+        .WillOnce(Return(ByMove(iox::ok(chunk.get()->chunkHeader()))));
+
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortLatency().value(), sendChunk(_))
+        .WillOnce(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendLatencyData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+
+    EXPECT_THAT(chunk->sample()->m_publisherLatencyList.size(), Eq(0U));
+    EXPECT_THAT(chunk->sample()->m_subscriberLatencyList.size(), Eq(0U));
+}
 
 TEST_F(PortIntrospection_test, sendPortData_EmptyList)
 {
@@ -150,6 +150,69 @@ TEST_F(PortManager_test, DoDiscoveryWithSubscribersCreatedBeforeAndAfterCreation
     EXPECT_THAT(subscriber2.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
 }
 
+TEST_F(PortManager_test, HandleDiscoveryRequestsConnectsSubscriberWithOfferedPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f0d6b2a-3c1e-4e57-9a64-b7c2d5e1f3a9");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(createPublisher(publisherOptions));
+    ASSERT_TRUE(publisher);
+    SubscriberPortUser subscriber(createSubscriber(subscriberOptions));
+    ASSERT_TRUE(subscriber);
+
+    publisher.offer();
+    subscriber.subscribe();
+    m_portManager->handleDiscoveryRequests();
+
+    EXPECT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
+TEST_F(PortManager_test, HandleDiscoveryRequestsDisconnectsSubscriberFromStoppedPublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e7a9c34-5b28-4f0d-8c63-a2d4f9e0b751");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    PublisherPortUser publisher(createPublisher(publisherOptions));
+    ASSERT_TRUE(publisher);
+    SubscriberPortUser subscriber(createSubscriber(subscriberOptions));
+    ASSERT_TRUE(subscriber);
+    publisher.offer();
+    subscriber.subscribe();
+    m_portManager->handleDiscoveryRequests();
+    ASSERT_TRUE(publisher.hasSubscribers());
+
+    publisher.stopOffer();
+    m_portManager->handleDiscoveryRequests();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+}
+
+TEST_F(PortManager_test, HandleDiscoveryRequestsDestroysPublishersWhichRequestedDestruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b4f2d8e6-0a93-4c1b-9e75-3d6c8a1f0e24");
+    iox::RuntimeName_t runtimeName = "test1";
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("run1")};
+
+    auto acquireMaxNumberOfPublishers = [&](auto f) {
+        for (unsigned int i = 0; i < iox::MAX_PUBLISHERS; i++)
+        {
+            auto publisherPortDataResult = m_portManager->acquirePublisherPortData(
+                getUniqueSD(), publisherOptions, runtimeName, m_payloadDataSegmentMemoryManager, PortConfigInfo());
+            ASSERT_FALSE(publisherPortDataResult.has_error());
+            f(publisherPortDataResult.value());
+        }
+    };
+
+    acquireMaxNumberOfPublishers([](auto publisherPortData) { PublisherPortUser(publisherPortData).destroy(); });
+    m_portManager->handleDiscoveryRequests();
+
+    // all publishers are removed, so we should be able to get some more now
+    acquireMaxNumberOfPublishers([](auto) {});
+}
+
 TEST_F(PortManager_test, SubscribeOnCreateSubscribesWithoutDiscoveryLoopWhenPublisherAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5a94cf82-d1f6-4129-88ca-34344d94e04e");
@@ -232,6 +295,32 @@ TEST_F(PortManager_test, OfferOnCreateAndSubscribeOnCreateNeedsNoMoreDiscoveryLo
 }
 
 
+TEST_F(PortManager_test, PortsAcquiredInOneBatchAreConnectedWithOfferAndSubscribeOnCreate)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "15a6271c-9b7d-403a-b266-8719f28c3692");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), true};
+
+    PublisherPortUser::MemberType_t* publisherPortData{nullptr};
+    SubscriberPortUser::MemberType_t* subscriberPortData{nullptr};
+    m_portManager->acquirePortDataBatch([&](PortManager::PortDataBatch& portDataBatch) {
+        publisherPortData =
+            portDataBatch
+                .acquirePublisherPortData(
+                    {"1", "1", "1"}, publisherOptions, "guiseppe", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+                .value();
+        subscriberPortData =
+            portDataBatch.acquireSubscriberPortData({"1", "1", "1"}, subscriberOptions, "guiseppe", PortConfigInfo())
+                .value();
+    });
+
+    PublisherPortUser publisher(publisherPortData);
+    SubscriberPortUser subscriber(subscriberPortData);
+
+    ASSERT_TRUE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriber.getSubscriptionState(), Eq(iox::SubscribeState::SUBSCRIBED));
+}
+
 TEST_F(PortManager_test, AcquiringOneMoreThanMaximumNumberOfPublishersFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "617abda0-36f7-4f98-9eb9-572622e0ffa1");
@@ -684,6 +773,25 @@ TEST_F(PortManager_test, AcquireConditionVariablesDataAfterDestroyingPreviouslyA
     acquireMaxNumberOfConditionVariables(runtimeName);
 }
 
+TEST_F(PortManager_test, HandleDiscoveryRequestsRemovesConditionVariablesWhichRequestedDestruction)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2a3e0b4-4d6f-4f1a-8e57-93b1d0f6a2c8");
+    std::vector<iox::popo::ConditionVariableData*> condVarContainer;
+
+    std::string runtimeName = "HypnoToadForEver";
+
+    acquireMaxNumberOfConditionVariables(runtimeName, [&](auto condVar) { condVarContainer.push_back(condVar); });
+
+    for (auto condVar : condVarContainer)
+    {
+        condVar->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        condVar->m_discoveryRequester.requestDiscovery();
+    }
+    m_portManager->handleDiscoveryRequests();
+
+    acquireMaxNumberOfConditionVariables(runtimeName);
+}
+
 TEST_F(PortManager_test, AcquiringMaximumNumberOfNodesWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7c4e697e-c379-44f5-a081-5903d9b287f5");
@@ -25,6 +25,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -316,6 +318,49 @@ TEST_F(PortPool_test, RemovePublisherPortIsSuccessful)
     EXPECT_EQ(sut.getPublisherPortDataList().size(), 0U);
 }
 
+TEST_F(PortPool_test, ForEachPublisherPortVisitsOnlyPortsWithMatchingServiceDescription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e8b2f1c-9a37-4d65-b0e2-7c1d5f3a9e86");
+    ServiceDescription otherServiceDescription{"service1", "instance1", "event2"};
+    auto publisherPort1 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto otherPublisherPort =
+        sut.addPublisherPort(otherServiceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto publisherPort2 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort1.has_error());
+    ASSERT_FALSE(otherPublisherPort.has_error());
+    ASSERT_FALSE(publisherPort2.has_error());
+
+    std::vector<const iox::popo::PublisherPortData*> visitedPorts;
+    sut.forEachPublisherPort(m_serviceDescription,
+                             [&](iox::popo::PublisherPortData& port) { visitedPorts.push_back(&port); });
+
+    ASSERT_THAT(visitedPorts.size(), Eq(2U));
+    EXPECT_THAT(visitedPorts[0], Eq(publisherPort1.value()));
+    EXPECT_THAT(visitedPorts[1], Eq(publisherPort2.value()));
+}
+
+TEST_F(PortPool_test, ForEachPublisherPortDoesNotVisitRemovedPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b17d3e9a-6c24-4f08-8a5b-e2f9c0d4a731");
+    auto publisherPort1 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    auto publisherPort2 =
+        sut.addPublisherPort(m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions);
+    ASSERT_FALSE(publisherPort1.has_error());
+    ASSERT_FALSE(publisherPort2.has_error());
+
+    sut.removePublisherPort(publisherPort1.value());
+
+    std::vector<const iox::popo::PublisherPortData*> visitedPorts;
+    sut.forEachPublisherPort(m_serviceDescription,
+                             [&](iox::popo::PublisherPortData& port) { visitedPorts.push_back(&port); });
+
+    ASSERT_THAT(visitedPorts.size(), Eq(1U));
+    EXPECT_THAT(visitedPorts[0], Eq(publisherPort2.value()));
+}
+
 // END PublisherPort tests
 
 // BEGIN SubscriberPort tests
@@ -438,6 +483,23 @@ TEST_F(PortPool_test, RemoveSubscriberPortIsSuccessful)
     EXPECT_EQ(sut.getSubscriberPortDataList().size(), 0U);
 }
 
+TEST_F(PortPool_test, ForEachSubscriberPortVisitsOnlyPortsWithMatchingServiceDescription)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e62a0c8f-3d17-4b94-a5c1-9f8e2b7d0364");
+    ServiceDescription otherServiceDescription{"service2", "instance1", "event1"};
+    auto subscriberPort = sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions);
+    auto otherSubscriberPort = sut.addSubscriberPort(otherServiceDescription, m_applicationName, m_subscriberOptions);
+    ASSERT_FALSE(subscriberPort.has_error());
+    ASSERT_FALSE(otherSubscriberPort.has_error());
+
+    std::vector<const iox::popo::SubscriberPortData*> visitedPorts;
+    sut.forEachSubscriberPort(otherServiceDescription,
+                              [&](iox::popo::SubscriberPortData& port) { visitedPorts.push_back(&port); });
+
+    ASSERT_THAT(visitedPorts.size(), Eq(1U));
+    EXPECT_THAT(visitedPorts[0], Eq(otherSubscriberPort.value()));
+}
+
 // END SubscriberPort tests
 
 // BEGIN ClientPort tests
@@ -28,6 +28,9 @@
 #include "iox/string.hpp"
 #include "test.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -136,6 +139,44 @@ TEST_F(ProcessManager_test, RegisterAndUnregisterWorks)
     EXPECT_THAT(m_sut->registeredProcessCount(), Eq(0));
 }
 
+TEST_F(ProcessManager_test, MonitoredProcessWithoutBeatsIsRemovedAfterKeepAliveTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4f7d2b19-8c3e-4a65-b0d1-93e6a5c2f874");
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+
+    m_sut->monitorProcesses();
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(
+        (PROCESS_KEEP_ALIVE_TIMEOUT + iox::roudi::PROCESS_MONITORING_INTERVAL).toMilliseconds()));
+    m_sut->monitorProcesses();
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(0));
+    EXPECT_THAT(m_roudiMemoryManager->heartbeatPool().value()->size(), Eq(0U));
+}
+
+TEST_F(ProcessManager_test, MonitoredProcessWithBeatsIsNotRemoved)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2c85e03-6d1f-4b97-8e4a-07b3f9d1c6e2");
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    auto* heartbeatPool = m_roudiMemoryManager->heartbeatPool().value();
+
+    const auto keepAliveInterval = std::chrono::milliseconds(PROCESS_KEEP_ALIVE_INTERVAL.toMilliseconds());
+    const auto numberOfBeats =
+        2U * PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds() / PROCESS_KEEP_ALIVE_INTERVAL.toMilliseconds();
+    for (uint64_t i = 0U; i < numberOfBeats; ++i)
+    {
+        std::this_thread::sleep_for(keepAliveInterval);
+        for (auto& heartbeat : *heartbeatPool)
+        {
+            heartbeat.beat();
+        }
+        m_sut->monitorProcesses();
+    }
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1));
+}
+
 TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "741669ec-111b-494b-b243-d28510b07782");
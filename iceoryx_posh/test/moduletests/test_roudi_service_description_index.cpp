@@ -0,0 +1,220 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_description_index.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+class ServiceDescriptionIndex_test : public Test
+{
+  public:
+    static constexpr uint32_t CAPACITY{8U};
+    using Sut_t = ServiceDescriptionIndex<CAPACITY>;
+    using Key_t = uint64_t;
+
+    static constexpr Key_t NO_KEY{0U};
+
+    /// @brief the hash is deliberately not unique to enforce collisions in the index
+    static Sut_t::Hash_t hashOf(const Key_t key)
+    {
+        return key % 2U;
+    }
+
+    void insert(const uint32_t slot, const Key_t key)
+    {
+        keys[slot] = key;
+        sut.insert(slot, hashOf(key), [&](const uint32_t s) { return keys[s] == key; });
+    }
+
+    void remove(const uint32_t slot)
+    {
+        const auto key = keys[slot];
+        sut.remove(slot, hashOf(key), [&](const uint32_t s) { return keys[s] == key; });
+        keys[slot] = NO_KEY;
+    }
+
+    std::vector<uint32_t> find(const Key_t key)
+    {
+        std::vector<uint32_t> slots;
+        for (auto slot = sut.find(hashOf(key), [&](const uint32_t s) { return keys[s] == key; });
+             slot != Sut_t::NO_SLOT;
+             slot = sut.next(slot))
+        {
+            slots.push_back(slot);
+        }
+        return slots;
+    }
+
+    std::vector<Key_t> keys = std::vector<Key_t>(CAPACITY, NO_KEY);
+    Sut_t sut;
+};
+
+constexpr uint32_t ServiceDescriptionIndex_test::CAPACITY;
+constexpr ServiceDescriptionIndex_test::Key_t ServiceDescriptionIndex_test::NO_KEY;
+
+TEST_F(ServiceDescriptionIndex_test, FindInEmptyIndexReturnsNoSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d3f6e1a-8b47-4c92-a0d5-2e7b9c1f4a63");
+    EXPECT_THAT(find(1U), IsEmpty());
+}
+
+TEST_F(ServiceDescriptionIndex_test, InsertedSlotCanBeFound)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b8e2a4c7-1f3d-4e69-9a05-6c4d8f2e1b70");
+    insert(3U, 42U);
+
+    EXPECT_THAT(find(42U), ElementsAre(3U));
+    EXPECT_THAT(find(43U), IsEmpty());
+}
+
+TEST_F(ServiceDescriptionIndex_test, SlotsWithSameKeyAreFoundInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a9c7e4f-6b13-4d58-8e0a-f1c3b5d7e926");
+    insert(5U, 7U);
+    insert(1U, 7U);
+    insert(6U, 7U);
+    insert(3U, 7U);
+
+    EXPECT_THAT(find(7U), ElementsAre(1U, 3U, 5U, 6U));
+}
+
+TEST_F(ServiceDescriptionIndex_test, KeysWithCollidingHashesAreDistinguished)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4c1b7a2-9d05-4f3e-b6a8-7c2d0e5f1a94");
+    insert(0U, 2U);
+    insert(1U, 4U);
+    insert(2U, 6U);
+    insert(3U, 4U);
+
+    EXPECT_THAT(find(2U), ElementsAre(0U));
+    EXPECT_THAT(find(4U), ElementsAre(1U, 3U));
+    EXPECT_THAT(find(6U), ElementsAre(2U));
+}
+
+TEST_F(ServiceDescriptionIndex_test, RemovingTheFirstSlotOfAKeyKeepsTheOthers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7f0b3d9e-2c64-4a81-95e7-d3a6c8b1f052");
+    insert(1U, 7U);
+    insert(4U, 7U);
+    insert(6U, 7U);
+
+    remove(1U);
+
+    EXPECT_THAT(find(7U), ElementsAre(4U, 6U));
+}
+
+TEST_F(ServiceDescriptionIndex_test, RemovingAMiddleSlotOfAKeyKeepsTheOthers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3a58e1d-7b92-4f06-a4c9-1e8d2b6f7035");
+    insert(1U, 7U);
+    insert(4U, 7U);
+    insert(6U, 7U);
+
+    remove(4U);
+
+    EXPECT_THAT(find(7U), ElementsAre(1U, 6U));
+}
+
+TEST_F(ServiceDescriptionIndex_test, RemovingTheLastSlotOfAKeyRemovesTheKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "91d6f2b4-3e0a-4c75-8b1f-a5e7c9d3042b");
+    insert(2U, 7U);
+
+    remove(2U);
+
+    EXPECT_THAT(find(7U), IsEmpty());
+}
+
+TEST_F(ServiceDescriptionIndex_test, RemovingACollidingKeyKeepsTheOtherKeysAccessible)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e7a4c2f-5b19-4d83-9f6e-b2c8a1d5e347");
+    for (uint32_t slot = 0U; slot < CAPACITY; ++slot)
+    {
+        // all keys have the same hash and are therefore stored in consecutive buckets
+        insert(slot, 2U * (slot + 1U));
+    }
+
+    remove(0U);
+    remove(5U);
+
+    EXPECT_THAT(find(2U), IsEmpty());
+    EXPECT_THAT(find(12U), IsEmpty());
+    for (uint32_t slot : {1U, 2U, 3U, 4U, 6U, 7U})
+    {
+        EXPECT_THAT(find(2U * (slot + 1U)), ElementsAre(slot));
+    }
+}
+
+TEST_F(ServiceDescriptionIndex_test, RemovedSlotCanBeInsertedAgainWithAnotherKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5b9e3a1-4f28-4c6d-a70e-8c1f3b2d9e64");
+    insert(2U, 7U);
+    remove(2U);
+
+    insert(2U, 9U);
+
+    EXPECT_THAT(find(7U), IsEmpty());
+    EXPECT_THAT(find(9U), ElementsAre(2U));
+}
+
+TEST_F(ServiceDescriptionIndex_test, RemovingASlotWhichIsNotContainedDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a2f8d0c-9e37-4b15-8c4a-e0d7b3f1c586");
+    insert(2U, 7U);
+    keys[3U] = 7U;
+
+    remove(3U);
+
+    EXPECT_THAT(find(7U), ElementsAre(2U));
+}
+
+TEST_F(ServiceDescriptionIndex_test, CopiedIndexFindsTheSameSlots)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f2c7a9e4-0b58-4d16-93a2-5e8b1c4d7f30");
+    insert(1U, 7U);
+    insert(5U, 7U);
+    insert(2U, 4U);
+
+    const Sut_t copy{sut};
+    sut = Sut_t();
+
+    EXPECT_THAT(copy.find(hashOf(7U), [&](const uint32_t s) { return keys[s] == 7U; }), Eq(1U));
+    EXPECT_THAT(copy.next(1U), Eq(5U));
+    EXPECT_THAT(copy.find(hashOf(4U), [&](const uint32_t s) { return keys[s] == 4U; }), Eq(2U));
+    EXPECT_THAT(find(7U), IsEmpty());
+}
+
+TEST_F(ServiceDescriptionIndex_test, EqualServiceDescriptionsHaveEqualHashes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b4e1f7a-c2d9-4053-a6e1-3f9c7b5d2a08");
+    const iox::capro::ServiceDescription sd1{"Service", "Instance", "Event"};
+    const iox::capro::ServiceDescription sd2{
+        "Service", "Instance", "Event", {1U, 2U, 3U, 4U}, iox::capro::Interfaces::DDS};
+    const iox::capro::ServiceDescription sd3{"Service", "Event", "Instance"};
+
+    EXPECT_THAT(Sut_t::hash(sd1), Eq(Sut_t::hash(sd2)));
+    EXPECT_THAT(Sut_t::hash(sd1), Ne(Sut_t::hash(sd3)));
+    EXPECT_THAT(Sut_t::hash(sd1), Eq(Sut_t::hash("Service", "Instance", "Event")));
+}
+
+} // namespace
@@ -23,6 +23,7 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -746,4 +747,121 @@ TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueAfterRemo
     EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
 }
 
+TYPED_TEST(ServiceRegistry_test, FindWithFullyRemovedAndReaddedServicesReturnsEntriesInSlotOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c9e1a7f-5d42-4b08-a6e3-9f2d7c1b0e85");
+    constexpr uint64_t NUMBER_OF_SERVICES{10U};
+    auto instanceOf = [](const uint64_t i) {
+        return iox::into<iox::lossy<IdString_t>>(iox::convert::toString(i % 2U));
+    };
+    auto eventOf = [](const uint64_t i) { return iox::into<iox::lossy<IdString_t>>(iox::convert::toString(i)); };
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        ASSERT_FALSE(this->sut.add(ServiceDescription("Foo", instanceOf(i), eventOf(i))).has_error());
+    }
+    // frees the slots 2 and 7 which are reused in reverse order
+    this->sut.remove(ServiceDescription("Foo", instanceOf(2U), eventOf(2U)));
+    this->sut.remove(ServiceDescription("Foo", instanceOf(7U), eventOf(7U)));
+    ASSERT_FALSE(this->sut.add(ServiceDescription("Foo", instanceOf(12U), eventOf(12U))).has_error());
+    ASSERT_FALSE(this->sut.add(ServiceDescription("Foo", instanceOf(14U), eventOf(14U))).has_error());
+
+    this->find(IdString_t("Foo"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(NUMBER_OF_SERVICES));
+
+    this->find(iox::capro::Wildcard, instanceOf(0U), iox::capro::Wildcard);
+    ASSERT_THAT(this->searchResult.size(), Eq(NUMBER_OF_SERVICES / 2U + 1U));
+    for (uint64_t i = 1U; i < this->searchResult.size(); ++i)
+    {
+        EXPECT_THAT(this->searchResult[i - 1U].serviceDescription, Ne(this->searchResult[i].serviceDescription));
+    }
+
+    this->find(IdString_t("Foo"), instanceOf(2U), eventOf(2U));
+    EXPECT_THAT(this->searchResult.size(), Eq(0U));
+    this->find(IdString_t("Foo"), instanceOf(14U), eventOf(14U));
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(ServiceDescription("Foo", instanceOf(14U), eventOf(14U))));
+}
+
+TYPED_TEST(ServiceRegistry_test, FindOnCopiedRegistryReturnsTheSameEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f4a2d6c-1b73-4e95-b0c8-e7d3a9f15264");
+    ServiceDescription service1("a", "b", "c");
+    ServiceDescription service2("a", "d", "c");
+    ServiceDescription service3("e", "b", "f");
+    ASSERT_FALSE(this->sut.add(service1).has_error());
+    ASSERT_FALSE(this->sut.add(service2).has_error());
+    ASSERT_FALSE(this->sut.add(service3).has_error());
+
+    // the registry is too large for the stack
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry(this->sut.registry)};
+    this->sut.remove(service1);
+    this->sut.remove(service2);
+    this->sut.remove(service3);
+
+    SearchResult_t result;
+    auto findHandler = [&](const ServiceRegistry::ServiceDescriptionEntry& entry) { result.push_back(entry); };
+
+    copy->find(IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard, findHandler);
+    ASSERT_THAT(result.size(), Eq(2U));
+    EXPECT_THAT(result[0].serviceDescription, Eq(service1));
+    EXPECT_THAT(result[1].serviceDescription, Eq(service2));
+
+    result.clear();
+    copy->find(iox::capro::Wildcard, IdString_t("b"), iox::capro::Wildcard, findHandler);
+    ASSERT_THAT(result.size(), Eq(2U));
+    EXPECT_THAT(result[0].serviceDescription, Eq(service1));
+    EXPECT_THAT(result[1].serviceDescription, Eq(service3));
+
+    result.clear();
+    copy->find(IdString_t("e"), IdString_t("b"), IdString_t("f"), findHandler);
+    ASSERT_THAT(result.size(), Eq(1U));
+    EXPECT_THAT(result[0].serviceDescription, Eq(service3));
+}
+
+TYPED_TEST(ServiceRegistry_test, SequenceNumberIsIncreasedWithEveryChange)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d7b9e05-c3a8-4f16-8e42-a0f6c1d5b938");
+    ServiceDescription service("a", "b", "c");
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(0U));
+
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(1U));
+
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(2U));
+
+    this->sut.remove(service);
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(3U));
+
+    this->sut.remove(service);
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(4U));
+}
+
+TYPED_TEST(ServiceRegistry_test, SequenceNumberIsNotIncreasedWhenRemovingNonExistingService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b58e1c47-0d93-4a2f-b6c7-e9d3f2a8051c");
+    ServiceDescription service("a", "b", "c");
+    ASSERT_FALSE(this->sut.otherAdd(service).has_error());
+    const auto sequenceNumber = this->sut.registry.sequenceNumber();
+
+    this->sut.remove(service);
+    this->sut.remove(ServiceDescription("x", "y", "z"));
+
+    EXPECT_THAT(this->sut.registry.sequenceNumber(), Eq(sequenceNumber));
+}
+
+TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueAfterDecrementingTheCount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6e0a3f92-d7b1-4c58-a4e6-1f8c2b9d7e03");
+    ServiceDescription service("a", "a", "a");
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    this->sut.registry.hasDataChangedSinceLastCall();
+
+    this->sut.remove(service);
+
+    EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
+}
+
 } // namespace
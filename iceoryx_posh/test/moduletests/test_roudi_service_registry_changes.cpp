@@ -0,0 +1,167 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry_changes.hpp"
+
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+using iox::capro::ServiceDescription;
+
+class ServiceRegistryChanges_test : public Test
+{
+  public:
+    using Type = ServiceRegistryChange::Type;
+
+    /// @brief applies the change to the source registry like RouDi and records it if the registry was modified
+    void change(const Type type, const ServiceDescription& serviceDescription)
+    {
+        const auto previousSequenceNumber = source->sequenceNumber();
+        switch (type)
+        {
+        case Type::ADD_PUBLISHER:
+            ASSERT_FALSE(source->addPublisher(serviceDescription).has_error());
+            break;
+        case Type::REMOVE_PUBLISHER:
+            source->removePublisher(serviceDescription);
+            break;
+        case Type::ADD_SERVER:
+            ASSERT_FALSE(source->addServer(serviceDescription).has_error());
+            break;
+        case Type::REMOVE_SERVER:
+            source->removeServer(serviceDescription);
+            break;
+        }
+
+        if (source->sequenceNumber() != previousSequenceNumber)
+        {
+            ASSERT_TRUE(sut.changes.emplace_back(ServiceRegistryChange{type, serviceDescription}));
+        }
+        sut.sequenceNumber = source->sequenceNumber();
+    }
+
+    std::vector<ServiceRegistry::ServiceDescriptionEntry> entriesOf(const ServiceRegistry& registry)
+    {
+        std::vector<ServiceRegistry::ServiceDescriptionEntry> entries;
+        registry.forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) { entries.push_back(entry); });
+        return entries;
+    }
+
+    void expectSameEntries(const ServiceRegistry& lhs, const ServiceRegistry& rhs)
+    {
+        const auto lhsEntries = entriesOf(lhs);
+        const auto rhsEntries = entriesOf(rhs);
+        ASSERT_THAT(lhsEntries.size(), Eq(rhsEntries.size()));
+        for (uint64_t i = 0U; i < lhsEntries.size(); ++i)
+        {
+            EXPECT_THAT(lhsEntries[i].serviceDescription, Eq(rhsEntries[i].serviceDescription));
+            EXPECT_THAT(lhsEntries[i].publisherCount, Eq(rhsEntries[i].publisherCount));
+            EXPECT_THAT(lhsEntries[i].serverCount, Eq(rhsEntries[i].serverCount));
+        }
+    }
+
+    // the registries are too large for the stack
+    std::unique_ptr<ServiceRegistry> source{new ServiceRegistry()};
+    std::unique_ptr<ServiceRegistry> copy{new ServiceRegistry()};
+    ServiceRegistryChanges sut;
+
+    const ServiceDescription sd1{"Foo", "Bar", "Baz"};
+    const ServiceDescription sd2{"Foo", "Bar", "Bam"};
+};
+
+TEST_F(ServiceRegistryChanges_test, ApplyingAllChangesToACopyResultsInTheSameEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a3d85f14-7c26-4e09-b1f8-5e2c9a0d7b63");
+    change(Type::ADD_PUBLISHER, sd1);
+    change(Type::ADD_PUBLISHER, sd1);
+    change(Type::ADD_SERVER, sd2);
+    change(Type::ADD_PUBLISHER, sd2);
+    change(Type::REMOVE_PUBLISHER, sd1);
+    change(Type::REMOVE_SERVER, sd2);
+
+    EXPECT_TRUE(sut.applyTo(*copy));
+
+    EXPECT_THAT(copy->sequenceNumber(), Eq(source->sequenceNumber()));
+    expectSameEntries(*copy, *source);
+}
+
+TEST_F(ServiceRegistryChanges_test, ChangesWhichDoNotModifyTheRegistryAreNotRecorded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5be0c7a9-3f41-4d86-92e5-c8a1f6d02b47");
+    change(Type::REMOVE_PUBLISHER, sd1);
+    change(Type::REMOVE_SERVER, sd1);
+
+    EXPECT_TRUE(sut.changes.empty());
+    EXPECT_TRUE(sut.applyTo(*copy));
+    EXPECT_THAT(copy->sequenceNumber(), Eq(0U));
+}
+
+TEST_F(ServiceRegistryChanges_test, ChangesWhichTheCopyAlreadyContainsAreSkipped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c9f2e86-b4d7-4a13-a6e0-7d5b3c8f1e92");
+    change(Type::ADD_PUBLISHER, sd1);
+    *copy = *source;
+    change(Type::ADD_PUBLISHER, sd1);
+    change(Type::ADD_SERVER, sd2);
+
+    EXPECT_TRUE(sut.applyTo(*copy));
+
+    EXPECT_THAT(copy->sequenceNumber(), Eq(source->sequenceNumber()));
+    expectSameEntries(*copy, *source);
+}
+
+TEST_F(ServiceRegistryChanges_test, ApplyingChangesToAnUpToDateCopyDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d61a4b3f-8e0c-4572-9f1d-2b7e6c5a0d38");
+    change(Type::ADD_PUBLISHER, sd1);
+    change(Type::ADD_SERVER, sd2);
+    *copy = *source;
+
+    EXPECT_TRUE(sut.applyTo(*copy));
+
+    EXPECT_THAT(copy->sequenceNumber(), Eq(source->sequenceNumber()));
+    expectSameEntries(*copy, *source);
+}
+
+TEST_F(ServiceRegistryChanges_test, ApplyingChangesToACopyWhichMissesEarlierChangesFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e27d0b5-1a9c-4f64-b3e8-c0f5a7d2e419");
+    change(Type::ADD_PUBLISHER, sd1);
+    sut.changes.clear();
+    change(Type::ADD_SERVER, sd2);
+
+    EXPECT_FALSE(sut.applyTo(*copy));
+
+    EXPECT_THAT(copy->sequenceNumber(), Eq(0U));
+    EXPECT_TRUE(entriesOf(*copy).empty());
+}
+
+TEST_F(ServiceRegistryChanges_test, ApplyingChangesWithoutRecordedChangesToAnOutdatedCopyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4b71c2d-6e38-4a05-8d9b-3a2e0f7c6b51");
+    change(Type::ADD_PUBLISHER, sd1);
+    sut.changes.clear();
+
+    EXPECT_FALSE(sut.applyTo(*copy));
+}
+
+} // namespace
@@ -0,0 +1,105 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t NUMBER_OF_ITERATIONS{200U};
+constexpr std::chrono::seconds CONNECT_TIMEOUT{5};
+
+using Latency_t = std::chrono::microseconds;
+
+/// @brief Measures the time from the offer and subscribe calls of the user until RouDi connected both ports
+Latency_t measureConnectLatency(const uint64_t iteration)
+{
+    const iox::capro::IdString_t instance{iox::TruncateToCapacity, std::to_string(iteration).c_str()};
+    const iox::capro::ServiceDescription serviceDescription{"Benchmark", instance, "ConnectLatency"};
+
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.offerOnCreate = false;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.subscribeOnCreate = false;
+
+    iox::popo::UntypedPublisher publisher{serviceDescription, publisherOptions};
+    iox::popo::UntypedSubscriber subscriber{serviceDescription, subscriberOptions};
+
+    const auto start = std::chrono::steady_clock::now();
+    publisher.offer();
+    subscriber.subscribe();
+
+    auto now = start;
+    while (subscriber.getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
+    {
+        now = std::chrono::steady_clock::now();
+        if (now - start > CONNECT_TIMEOUT)
+        {
+            std::cerr << "Subscriber did not get connected within the timeout!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        std::this_thread::yield();
+    }
+    now = std::chrono::steady_clock::now();
+
+    return std::chrono::duration_cast<Latency_t>(now - start);
+}
+} // namespace
+
+int main()
+{
+    iox::roudi_env::RouDiEnv roudiEnv;
+    iox::runtime::PoshRuntime::initRuntime("iox-bm-discovery-connect-latency");
+
+    std::vector<Latency_t> latencies;
+    latencies.reserve(NUMBER_OF_ITERATIONS);
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        latencies.push_back(measureConnectLatency(i));
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    Latency_t sum{0};
+    for (const auto& latency : latencies)
+    {
+        sum += latency;
+    }
+
+    auto percentile = [&latencies](const uint64_t p) {
+        return latencies[std::min<uint64_t>(latencies.size() - 1U, latencies.size() * p / 100U)].count();
+    };
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "Connect latency of " << NUMBER_OF_ITERATIONS << " publisher/subscriber pairs in us" << std::endl;
+    std::cout << std::setw(10) << "min" << std::setw(10) << "avg" << std::setw(10) << "p50" << std::setw(10) << "p99"
+              << std::setw(10) << "max" << std::endl;
+    std::cout << std::setw(10) << latencies.front().count() << std::setw(10)
+              << sum.count() / static_cast<int64_t>(latencies.size()) << std::setw(10) << percentile(50U)
+              << std::setw(10) << percentile(99U) << std::setw(10) << latencies.back().count() << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,231 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/gateway/channel.hpp"
+#include "iceoryx_posh/gateway/gateway_generic.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace iox::units::duration_literals;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{200U};
+constexpr uint64_t NUMBER_OF_CHANNELS{4U};
+constexpr std::chrono::seconds RECEIVE_TIMEOUT{5};
+constexpr const char LOOPBACK_EVENT[]{"Loopback"};
+
+using Latency_t = std::chrono::microseconds;
+
+/// @brief The stand-in for the external system; it publishes the forwarded samples on the loopback event of the
+/// service of the channel
+class LoopbackTerminal
+{
+  public:
+    LoopbackTerminal(const iox::capro::IdString_t& service,
+                     const iox::capro::IdString_t& instance,
+                     const iox::capro::IdString_t&) noexcept
+        : m_publisher({service, instance, LOOPBACK_EVENT})
+    {
+    }
+
+    void send(const void* const userPayload, const uint32_t size) noexcept
+    {
+        m_publisher.loan(size)
+            .and_then([&](void* loopbackPayload) {
+                std::memcpy(loopbackPayload, userPayload, size);
+                m_publisher.publish(loopbackPayload);
+            })
+            .or_else([](auto) {
+                std::cerr << "Unable to loan a sample for the loopback!" << std::endl;
+                std::exit(EXIT_FAILURE);
+            });
+    }
+
+  private:
+    iox::popo::UntypedPublisher m_publisher;
+};
+
+/// @brief A subscriber which does not provide hasData and is therefore polled by the gateway like before the
+/// forwarding was event-driven
+class PolledSubscriber : public iox::popo::UntypedSubscriber
+{
+  public:
+    using iox::popo::UntypedSubscriber::UntypedSubscriber;
+
+  private:
+    using iox::popo::UntypedSubscriber::hasData;
+};
+
+template <typename Subscriber>
+using LoopbackChannel = iox::gw::Channel<Subscriber, LoopbackTerminal>;
+
+template <typename Subscriber>
+class LoopbackGateway : public iox::gw::GatewayGeneric<LoopbackChannel<Subscriber>>
+{
+    using Parent = iox::gw::GatewayGeneric<LoopbackChannel<Subscriber>>;
+
+  public:
+    LoopbackGateway(const uint32_t numberOfForwardingThreads) noexcept
+        : Parent(iox::capro::Interfaces::INTERNAL, 1000_ms, 50_ms, numberOfForwardingThreads)
+    {
+    }
+
+    ~LoopbackGateway() noexcept override
+    {
+        this->shutdown();
+    }
+
+    void loadConfiguration(const iox::config::GatewayConfig&) noexcept override
+    {
+    }
+
+    void discover(const iox::capro::CaproMessage&) noexcept override
+    {
+    }
+
+    void forward(const LoopbackChannel<Subscriber>& channel) noexcept override
+    {
+        auto subscriber = channel.getIceoryxTerminal();
+        subscriber->take().and_then([&](const void* userPayload) {
+            channel.getExternalTerminal()->send(userPayload, sizeof(std::chrono::steady_clock::time_point));
+            subscriber->release(userPayload);
+        });
+    }
+
+    using Parent::addChannel;
+};
+
+void waitUntilSubscribed(const iox::popo::UntypedSubscriber& subscriber)
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (subscriber.getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
+    {
+        if (std::chrono::steady_clock::now() - start > RECEIVE_TIMEOUT)
+        {
+            std::cerr << "Subscriber did not get connected within the timeout!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        std::this_thread::yield();
+    }
+}
+
+/// @brief Measures the time from publishing a sample until it was forwarded by the gateway and received via the
+/// loopback; the channels are used in turn
+template <typename Subscriber>
+void benchmark(const char* name, const uint32_t numberOfForwardingThreads)
+{
+    LoopbackGateway<Subscriber> gateway{numberOfForwardingThreads};
+
+    std::vector<std::unique_ptr<iox::popo::UntypedPublisher>> publishers;
+    std::vector<std::unique_ptr<iox::popo::UntypedSubscriber>> loopbackSubscribers;
+    std::vector<LoopbackChannel<Subscriber>> channels;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHANNELS; ++i)
+    {
+        const iox::capro::IdString_t instance{iox::TruncateToCapacity, std::to_string(i).c_str()};
+        const iox::capro::ServiceDescription service{"Benchmark", instance, "Forwarding"};
+        channels.push_back(
+            gateway.addChannel(service, iox::popo::SubscriberOptions()).expect("Unable to create a channel"));
+        publishers.emplace_back(new iox::popo::UntypedPublisher(service));
+        loopbackSubscribers.emplace_back(new iox::popo::UntypedSubscriber({"Benchmark", instance, LOOPBACK_EVENT}));
+    }
+    for (uint64_t i = 0U; i < NUMBER_OF_CHANNELS; ++i)
+    {
+        waitUntilSubscribed(*channels[i].getIceoryxTerminal());
+        waitUntilSubscribed(*loopbackSubscribers[i]);
+    }
+    gateway.runMultithreaded();
+
+    std::vector<Latency_t> latencies;
+    latencies.reserve(NUMBER_OF_ITERATIONS);
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        auto& publisher = *publishers[i % NUMBER_OF_CHANNELS];
+        auto& loopbackSubscriber = *loopbackSubscribers[i % NUMBER_OF_CHANNELS];
+
+        const auto start = std::chrono::steady_clock::now();
+        publisher.loan(sizeof(start)).and_then([&](void* userPayload) {
+            std::memcpy(userPayload, &start, sizeof(start));
+            publisher.publish(userPayload);
+        });
+
+        bool hasReceived{false};
+        while (!hasReceived)
+        {
+            loopbackSubscriber.take().and_then([&](const void* userPayload) {
+                std::chrono::steady_clock::time_point sendTime;
+                std::memcpy(&sendTime, userPayload, sizeof(sendTime));
+                latencies.push_back(
+                    std::chrono::duration_cast<Latency_t>(std::chrono::steady_clock::now() - sendTime));
+                loopbackSubscriber.release(userPayload);
+                hasReceived = true;
+            });
+            if (std::chrono::steady_clock::now() - start > RECEIVE_TIMEOUT)
+            {
+                std::cerr << "The sample was not forwarded within the timeout!" << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    Latency_t sum{0};
+    for (const auto& latency : latencies)
+    {
+        sum += latency;
+    }
+
+    auto percentile = [&latencies](const uint64_t p) {
+        return latencies[std::min<uint64_t>(latencies.size() - 1U, latencies.size() * p / 100U)].count();
+    };
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(24) << name << std::setw(10) << numberOfForwardingThreads << std::setw(10)
+              << latencies.front().count() << std::setw(10) << sum.count() / static_cast<int64_t>(latencies.size())
+              << std::setw(10) << percentile(50U) << std::setw(10) << percentile(99U) << std::setw(10)
+              << latencies.back().count() << std::endl;
+}
+} // namespace
+
+int main()
+{
+    iox::roudi_env::RouDiEnv roudiEnv;
+    iox::runtime::PoshRuntime::initRuntime("iox-bm-gateway-forwarding-latency");
+
+    std::cout << "Forwarding latency of " << NUMBER_OF_ITERATIONS << " samples over " << NUMBER_OF_CHANNELS
+              << " loopback channels in us" << std::endl;
+    std::cout << std::setw(24) << "forwarding" << std::setw(10) << "threads" << std::setw(10) << "min"
+              << std::setw(10) << "avg" << std::setw(10) << "p50" << std::setw(10) << "p99" << std::setw(10) << "max"
+              << std::endl;
+
+    benchmark<PolledSubscriber>("polled (50ms)", 1U);
+    benchmark<iox::popo::UntypedSubscriber>("event-driven", 1U);
+    benchmark<iox::popo::UntypedSubscriber>("event-driven", 2U);
+
+    return EXIT_SUCCESS;
+}
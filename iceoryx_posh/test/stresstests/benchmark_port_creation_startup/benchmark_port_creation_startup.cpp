@@ -0,0 +1,161 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t NUMBER_OF_ITERATIONS{5U};
+
+using Duration_t = std::chrono::microseconds;
+
+iox::capro::ServiceDescription service(const uint64_t index)
+{
+    const iox::capro::IdString_t instance{iox::TruncateToCapacity, std::to_string(index).c_str()};
+    return {"Benchmark", instance, "Startup"};
+}
+
+/// @brief Marks the ports for destruction and lets RouDi remove them, so that every iteration starts with the same
+/// number of ports
+void destroyPorts(iox::roudi_env::RouDiEnv& roudiEnv,
+                  const std::vector<iox::PublisherPortUserType::MemberType_t*>& publishers,
+                  const std::vector<iox::SubscriberPortUserType::MemberType_t*>& subscribers)
+{
+    for (auto publisher : publishers)
+    {
+        iox::PublisherPortUserType(publisher).destroy();
+    }
+    for (auto subscriber : subscribers)
+    {
+        iox::SubscriberPortUserType(subscriber).destroy();
+    }
+    roudiEnv.triggerDiscoveryLoopAndWaitToFinish();
+}
+
+/// @brief Creates half of the ports as publishers and half as subscribers with one request per port
+Duration_t createPortsOneByOne(iox::roudi_env::RouDiEnv& roudiEnv, const uint64_t numberOfPorts)
+{
+    auto& runtime = iox::runtime::PoshRuntime::getInstance();
+    std::vector<iox::PublisherPortUserType::MemberType_t*> publishers;
+    std::vector<iox::SubscriberPortUserType::MemberType_t*> subscribers;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < numberOfPorts / 2U; ++i)
+    {
+        publishers.push_back(runtime.getMiddlewarePublisher(service(i)));
+        subscribers.push_back(runtime.getMiddlewareSubscriber(service(i)));
+    }
+    const auto duration = std::chrono::duration_cast<Duration_t>(std::chrono::steady_clock::now() - start);
+
+    destroyPorts(roudiEnv, publishers, subscribers);
+    return duration;
+}
+
+/// @brief Creates the same ports as createPortsOneByOne with as few batch requests as possible
+Duration_t createPortsBatched(iox::roudi_env::RouDiEnv& roudiEnv, const uint64_t numberOfPorts)
+{
+    auto& runtime = iox::runtime::PoshRuntime::getInstance();
+    std::vector<iox::PublisherPortUserType::MemberType_t*> publishers;
+    std::vector<iox::SubscriberPortUserType::MemberType_t*> subscribers;
+
+    const auto start = std::chrono::steady_clock::now();
+    iox::runtime::PoshRuntime::PortRequests_t requests;
+    auto requestPorts = [&] {
+        const auto responses = runtime.getMiddlewarePorts(requests);
+        for (uint64_t i = 0U; i < responses.size(); ++i)
+        {
+            if (!responses[i].has_value())
+            {
+                std::cerr << "Unable to create a port!" << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+            const auto& port = responses[i].value();
+            if (port.index() == 0U)
+            {
+                publishers.push_back(*port.get<iox::PublisherPortUserType::MemberType_t*>());
+            }
+            else
+            {
+                subscribers.push_back(*port.get<iox::SubscriberPortUserType::MemberType_t*>());
+            }
+        }
+        requests.clear();
+    };
+    for (uint64_t i = 0U; i < numberOfPorts / 2U; ++i)
+    {
+        requests.emplace_back(service(i), iox::popo::PublisherOptions());
+        requests.emplace_back(service(i), iox::popo::SubscriberOptions());
+        if (requests.size() + 2U > requests.capacity())
+        {
+            requestPorts();
+        }
+    }
+    requestPorts();
+    const auto duration = std::chrono::duration_cast<Duration_t>(std::chrono::steady_clock::now() - start);
+
+    destroyPorts(roudiEnv, publishers, subscribers);
+    return duration;
+}
+
+template <typename CreatePorts>
+void benchmark(const char* name,
+               iox::roudi_env::RouDiEnv& roudiEnv,
+               const uint64_t numberOfPorts,
+               const CreatePorts& createPorts)
+{
+    std::vector<Duration_t> durations;
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        durations.push_back(createPorts(roudiEnv, numberOfPorts));
+    }
+    std::sort(durations.begin(), durations.end());
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(12) << name << std::setw(10) << numberOfPorts << std::setw(12) << durations.front().count()
+              << std::setw(12) << durations[durations.size() / 2U].count() << std::setw(12)
+              << durations.back().count() << std::endl;
+}
+} // namespace
+
+int main()
+{
+    iox::roudi_env::RouDiEnv roudiEnv;
+    iox::runtime::PoshRuntime::initRuntime("iox-bm-port-creation-startup");
+
+    std::cout << "Time to create publisher and subscriber ports in us over " << NUMBER_OF_ITERATIONS << " iterations"
+              << std::endl;
+    std::cout << std::setw(12) << "requests" << std::setw(10) << "ports" << std::setw(12) << "min" << std::setw(12)
+              << "p50" << std::setw(12) << "max" << std::endl;
+
+    for (const uint64_t numberOfPorts : {64U, 256U, 512U})
+    {
+        benchmark("one by one", roudiEnv, numberOfPorts, createPortsOneByOne);
+        benchmark("batched", roudiEnv, numberOfPorts, createPortsBatched);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using iox::capro::IdString_t;
+using iox::capro::ServiceDescription;
+using iox::roudi::ServiceRegistry;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{10000U};
+constexpr uint64_t NUMBER_OF_SERVICES{100U};
+constexpr uint64_t NUMBER_OF_INSTANCES{10U};
+
+IdString_t toId(const std::string& prefix, const uint64_t value)
+{
+    return IdString_t{iox::TruncateToCapacity, (prefix + std::to_string(value)).c_str()};
+}
+
+ServiceDescription serviceDescriptionOf(const uint64_t i)
+{
+    return ServiceDescription{toId("Service", i % NUMBER_OF_SERVICES),
+                              toId("Instance", (i / NUMBER_OF_SERVICES) % NUMBER_OF_INSTANCES),
+                              toId("Event", i)};
+}
+
+/// @brief Measures the average duration of a search in the registry
+/// @param[in] searchCall performs the search for a given iteration and returns the number of matches
+template <typename SearchCall>
+void measure(const char* name, SearchCall searchCall)
+{
+    uint64_t numberOfMatches{0U};
+    const auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        numberOfMatches += searchCall(i);
+    }
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    std::cout << std::setw(30) << name << std::setw(12)
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()
+                     / static_cast<int64_t>(NUMBER_OF_ITERATIONS)
+              << std::setw(12) << numberOfMatches / NUMBER_OF_ITERATIONS << std::endl;
+}
+} // namespace
+
+int main()
+{
+    // the registry is too large for the stack
+    std::unique_ptr<ServiceRegistry> registry{new ServiceRegistry()};
+
+    uint64_t numberOfEntries{0U};
+    while (numberOfEntries < ServiceRegistry::CAPACITY
+           && !registry->addPublisher(serviceDescriptionOf(numberOfEntries)).has_error())
+    {
+        ++numberOfEntries;
+    }
+
+    // the queries are created upfront to measure only the search
+    std::vector<ServiceDescription> serviceDescriptions;
+    for (uint64_t i = 0U; i < numberOfEntries; ++i)
+    {
+        serviceDescriptions.push_back(serviceDescriptionOf(i));
+    }
+    std::vector<IdString_t> services;
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        services.push_back(toId("Service", i));
+    }
+    std::vector<IdString_t> instances;
+    for (uint64_t i = 0U; i < NUMBER_OF_INSTANCES; ++i)
+    {
+        instances.push_back(toId("Instance", i));
+    }
+
+    auto count = [](uint64_t& counter) {
+        return [&counter](const ServiceRegistry::ServiceDescriptionEntry&) { ++counter; };
+    };
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "Average search duration in a service registry with " << numberOfEntries << " entries" << std::endl;
+    std::cout << std::setw(30) << "query" << std::setw(12) << "ns" << std::setw(12) << "matches" << std::endl;
+
+    measure("service/instance/event", [&](const uint64_t i) {
+        uint64_t matches{0U};
+        const auto& sd = serviceDescriptions[i % numberOfEntries];
+        registry->find(sd.getServiceIDString(), sd.getInstanceIDString(), sd.getEventIDString(), count(matches));
+        return matches;
+    });
+
+    measure("service/*/*", [&](const uint64_t i) {
+        uint64_t matches{0U};
+        registry->find(
+            services[i % NUMBER_OF_SERVICES], iox::capro::Wildcard, iox::capro::Wildcard, count(matches));
+        return matches;
+    });
+
+    measure("*/instance/*", [&](const uint64_t i) {
+        uint64_t matches{0U};
+        registry->find(
+            iox::capro::Wildcard, instances[i % NUMBER_OF_INSTANCES], iox::capro::Wildcard, count(matches));
+        return matches;
+    });
+
+    measure("*/*/event", [&](const uint64_t i) {
+        uint64_t matches{0U};
+        registry->find(iox::capro::Wildcard,
+                       iox::capro::Wildcard,
+                       serviceDescriptions[i % numberOfEntries].getEventIDString(),
+                       count(matches));
+        return matches;
+    });
+
+    measure("*/*/*", [&](const uint64_t) {
+        uint64_t matches{0U};
+        registry->find(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, count(matches));
+        return matches;
+    });
+
+    measure("linear scan service/*/*", [&](const uint64_t i) {
+        uint64_t matches{0U};
+        const auto& service = services[i % NUMBER_OF_SERVICES];
+        registry->forEach([&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+            if (entry.serviceDescription.getServiceIDString() == service)
+            {
+                ++matches;
+            }
+        });
+        return matches;
+    });
+
+    return EXIT_SUCCESS;
+}
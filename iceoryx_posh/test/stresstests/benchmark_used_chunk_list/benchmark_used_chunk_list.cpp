@@ -0,0 +1,116 @@
+// Copyright (c) 2023 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace
+{
+using iox::mepoo::ChunkHeader;
+using iox::mepoo::SharedChunk;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{100000U};
+constexpr uint32_t CHUNK_SIZE{128U};
+constexpr uint64_t MEMORY_SIZE{4U << 20U};
+
+/// @brief the capacity of the used chunk list of a subscriber
+using UsedChunkList_t = iox::popo::UsedChunkList<iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U>;
+
+struct HeldChunk
+{
+    const ChunkHeader* chunkHeader;
+    uint32_t slotIndex;
+};
+
+/// @brief Measures the average duration of a removal from the used chunk list while the given chunks are held; the
+/// held chunks are removed in turn and inserted again right afterwards
+template <typename RemoveCall>
+int64_t measure(UsedChunkList_t& usedChunkList, std::vector<HeldChunk>& heldChunks, RemoveCall removeCall)
+{
+    std::chrono::nanoseconds duration{0};
+    for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+    {
+        auto& heldChunk = heldChunks[i % heldChunks.size()];
+        SharedChunk chunk;
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool isRemoved = removeCall(heldChunk, chunk);
+        duration += std::chrono::steady_clock::now() - start;
+
+        if (!isRemoved)
+        {
+            std::cerr << "A held chunk could not be removed!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        heldChunk.slotIndex = usedChunkList.insert(chunk).value();
+    }
+    return duration.count() / static_cast<int64_t>(NUMBER_OF_ITERATIONS);
+}
+} // namespace
+
+int main()
+{
+    iox::mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.addMemPool({CHUNK_SIZE, iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY});
+
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+    iox::BumpAllocator memoryAllocator{memory.get(), MEMORY_SIZE};
+    iox::mepoo::MemoryManager memoryManager;
+    memoryManager.configureMemoryManager(mempoolConfig, memoryAllocator, memoryAllocator);
+
+    auto chunkSettings = iox::mepoo::ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t))
+                             .expect("Valid chunk settings for the benchmark");
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << "Average duration of releasing one of the held chunks in ns" << std::endl;
+    std::cout << std::setw(12) << "held" << std::setw(12) << "search" << std::setw(12) << "slot" << std::endl;
+
+    for (const uint32_t numberOfHeldChunks : {1U, 8U, 32U, 128U, iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY})
+    {
+        // the used chunk list is in shared memory in a real setup and too large for the stack with large capacities
+        std::unique_ptr<UsedChunkList_t> usedChunkList{new UsedChunkList_t()};
+        std::vector<HeldChunk> heldChunks;
+        for (uint32_t i = 0U; i < numberOfHeldChunks; ++i)
+        {
+            auto chunk = memoryManager.getChunk(chunkSettings).expect("Enough chunks for the benchmark");
+            const auto slotIndex = usedChunkList->insert(chunk).value();
+            heldChunks.push_back({chunk.getChunkHeader(), slotIndex});
+        }
+
+        const auto searchDuration = measure(*usedChunkList, heldChunks, [&](const HeldChunk& held, SharedChunk& chunk) {
+            return usedChunkList->remove(held.chunkHeader, chunk);
+        });
+        const auto slotDuration = measure(*usedChunkList, heldChunks, [&](const HeldChunk& held, SharedChunk& chunk) {
+            return usedChunkList->remove(held.slotIndex, held.chunkHeader, chunk);
+        });
+
+        std::cout << std::setw(12) << numberOfHeldChunks << std::setw(12) << searchDuration << std::setw(12)
+                  << slotDuration << std::endl;
+
+        usedChunkList->cleanup();
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -68,6 +68,7 @@ class PoshRuntimeMock : public iox::runtime::PoshRuntime
                  const iox::popo::ServerOptions&,
                  const iox::runtime::PortConfigInfo&),
                 (noexcept, override));
+    MOCK_METHOD(PortResponses_t, getMiddlewarePorts, (const PortRequests_t&), (noexcept, override));
     MOCK_METHOD(iox::popo::InterfacePortData*,
                 getMiddlewareInterface,
                 (const iox::capro::Interfaces, const iox::NodeName_t&),